@@ -0,0 +1,96 @@
+#ifndef CONFIG_EMUNIT_AVRUART_H_INCLUDED
+#define CONFIG_EMUNIT_AVRUART_H_INCLUDED
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief EMUnit AVR USART port configuration
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * File with EMUnit configuration for AVR USART port.
+ * @sa config_emunit_avruart_group
+ */
+
+/**
+ * @defgroup config_emunit_avruart_group <config_emunit_avruart.h> EMUnit AVR USART port configuration
+ * @{
+ * @ingroup config_emunit_group
+ *
+ * Default EMUnit configuration for AVR USART port.
+ * All values here can be overwritten by global definitions.
+ */
+
+/**
+ * @brief USART instance
+ *
+ * The index of the USART used for the output.
+ * The MCUs with the single USART without the index in the registers names use 0.
+ */
+#ifndef EMUNIT_PORT_AVRUART_USART
+#define EMUNIT_PORT_AVRUART_USART 0
+#endif
+
+/**
+ * @brief Baud rate
+ *
+ * The divider is calculated by &lt;util/setbaud.h&gt; from F_CPU.
+ */
+#ifndef EMUNIT_PORT_AVRUART_BAUD
+#define EMUNIT_PORT_AVRUART_BAUD 38400UL
+#endif
+
+/**
+ * @brief The size of every transmit buffer
+ *
+ * There are two buffers: one is transmitted by the interrupt
+ * while the other is filled.
+ * The maximum size is 255.
+ */
+#ifndef EMUNIT_PORT_AVRUART_BUFFER_SIZE
+#define EMUNIT_PORT_AVRUART_BUFFER_SIZE 64
+#endif
+
+/**
+ * @brief Output stream change marker
+ *
+ * Character sent before the stream index digit when the output stream changes.
+ * Used only if @ref EMUNIT_CONF_DISPLAY_MULTI is set.
+ * The default ASCII record separator never appears in the displays output.
+ */
+#ifndef EMUNIT_PORT_AVRUART_STREAM_MARK
+#define EMUNIT_PORT_AVRUART_STREAM_MARK '\x1e'
+#endif
+
+/**
+ * @brief Describe the MCU for simavr
+ *
+ * If set to 1, the simavr MCU description section is placed into the ELF file,
+ * so the test may be run by simavr without any additional parameter.
+ * The simavr include directory has to be in the include path then.
+ */
+#ifndef EMUNIT_PORT_AVRUART_SIMAVR
+#define EMUNIT_PORT_AVRUART_SIMAVR 0
+#endif
+
+/** @} */
+#endif /* CONFIG_EMUNIT_AVRUART_H_INCLUDED */
@@ -50,5 +50,53 @@
 #define SIMULAVR_REGSTDOUT_ADDR 0xFF
 #endif
 
+/**
+ * @brief Output stream change marker
+ *
+ * Character sent before the stream index digit when the output stream changes.
+ * Used only if @ref EMUNIT_CONF_DISPLAY_MULTI is set.
+ * The default ASCII record separator never appears in the displays output.
+ */
+#ifndef EMUNIT_PORT_SIMAVR_STREAM_MARK
+#define EMUNIT_PORT_SIMAVR_STREAM_MARK '\x1e'
+#endif
+
+/**
+ * @brief Restart without the watchdog
+ *
+ * If set to 1, the restart disables the interrupts, resets the peripherals
+ * interrupt configuration and jumps to the reset vector.
+ * The C runtime initialises the stack, .data and .bss while the .noinit
+ * section with the test status is preserved.
+ * It saves at least 15&nbsp;ms of simulated time per restart.
+ *
+ * Set it to 0 to restart using the watchdog, like on the real hardware.
+ */
+#ifndef EMUNIT_PORT_SIMAVR_SOFT_RESET
+#define EMUNIT_PORT_SIMAVR_SOFT_RESET 1
+#endif
+
+/**
+ * @brief Output read by the host runner
+ *
+ * If set to 1, the output is not sent through the console register.
+ * The port only signals the host runner where the data is placed
+ * and the host reads it directly from the simulated memory.
+ * The test has to be run by the emunit simavr host runner then.
+ */
+#ifndef EMUNIT_PORT_SIMAVR_HOST
+#define EMUNIT_PORT_SIMAVR_HOST 0
+#endif
+
+/**
+ * @brief Host runner signal register address
+ *
+ * Used if @ref EMUNIT_PORT_SIMAVR_HOST is set.
+ * The register should not be used by the tested code.
+ */
+#ifndef EMUNIT_PORT_SIMAVR_HOST_SIGNAL_ADDR
+#define EMUNIT_PORT_SIMAVR_HOST_SIGNAL_ADDR 0xFE
+#endif
+
 /** @} */
 #endif /* CONFIG_EMUNIT_SIMAVR_H_INCLUDED */
@@ -0,0 +1,784 @@
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief EMUnit JSON Lines presentation module implementation
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * Every event is presented as a single line with self-contained JSON object.
+ * This way the output can be processed while the test is still running.
+ *
+ * @sa emunit_display_json_group
+ */
+#include <inttypes.h>
+#include <stdlib.h>
+#include "../emunit.h"
+#include "emunit_display_json.h"
+
+/**
+ * @brief String part used as a newline
+ */
+#define NEWLINE EMUNIT_CONF_DISPLAY_NL
+
+/**
+ * @brief Current test case failed
+ *
+ * Set when the failure is displayed, cleared at the test case start.
+ * The whole test case is processed in single run.
+ */
+static bool emunit_display_json_tc_failed;
+
+/**
+ * @brief Hexadecimal digits used by the escape sequences
+ */
+static const __flash char emunit_display_json_hex[] = "0123456789abcdef";
+
+/**
+ * @brief Callback that escapes JSON special characters
+ *
+ * @sa emunit_display_cleanup_fn_t
+ *
+ * @param p_start Start of the buffer to replace
+ * @param len     Length of the buffer to replace
+ *
+ * @note The buffer to replace would always finish by NULL character.
+ */
+static void emunit_display_json_cleanup_escape(char * p_start, size_t len)
+{
+	char c;
+	(void)len;
+	while('\0' != (c = *p_start))
+	{
+		switch(c)
+		{
+		case '"':
+			p_start = emunit_display_replace(p_start, 1, EMUNIT_FLASHSTR("\\\""));
+			break;
+		case '\\':
+			p_start = emunit_display_replace(p_start, 1, EMUNIT_FLASHSTR("\\\\"));
+			break;
+		case '\n':
+			p_start = emunit_display_replace(p_start, 1, EMUNIT_FLASHSTR("\\n"));
+			break;
+		case '\r':
+			p_start = emunit_display_replace(p_start, 1, EMUNIT_FLASHSTR("\\r"));
+			break;
+		case '\t':
+			p_start = emunit_display_replace(p_start, 1, EMUNIT_FLASHSTR("\\t"));
+			break;
+		default:
+			if((unsigned char)c < 0x20U)
+			{
+				char str_u[] = "\\u00XX";
+				str_u[4] = emunit_display_json_hex[((unsigned char)c) >> 4];
+				str_u[5] = emunit_display_json_hex[((unsigned char)c) & 0x0fU];
+				p_start = emunit_display_replace(p_start, 1, str_u);
+			}
+			else
+			{
+				++p_start;
+			}
+			break;
+		}
+	}
+}
+
+/**
+ * @brief Display the event record start
+ *
+ * Prints the opening of the JSON object with event name.
+ *
+ * @param p_event Event name
+ */
+static void emunit_display_json_event(const __flash char * p_event)
+{
+	emunit_display_printf(
+		NULL,
+		EMUNIT_FLASHSTR("{\"event\":\"%"PRIsPGM"\""),
+		p_event
+	);
+}
+
+/**
+ * @brief Display the current test suite name
+ */
+static void emunit_display_json_suite(void)
+{
+	emunit_display_printf(
+		NULL,
+		EMUNIT_FLASHSTR(",\"suite\":\"%"PRIsPGM"\""),
+		emunit_ts_name_get(emunit_ts_current_index_get())
+	);
+}
+
+/**
+ * @brief Display the current test case name
+ */
+static void emunit_display_json_case(void)
+{
+	emunit_display_printf(
+		NULL,
+		EMUNIT_FLASHSTR(",\"case\":\"%"PRIsPGM"\""),
+		emunit_tc_name_get(emunit_ts_current_index_get(), emunit_tc_current_index_get())
+	);
+}
+
+/**
+ * @brief Display the event record end
+ */
+static void emunit_display_json_end(void)
+{
+	emunit_display_puts(NULL, EMUNIT_FLASHSTR("}" NEWLINE));
+}
+
+/**
+ * @brief Display escaped string field
+ *
+ * @param p_name Field name
+ * @param str    String value
+ * @param n      Maximum number of characters
+ */
+static void emunit_display_json_str(
+	const __flash char * p_name,
+	const __memx char * str,
+	size_t n)
+{
+	emunit_display_printf(NULL, EMUNIT_FLASHSTR(",\"%"PRIsPGM"\":\""), p_name);
+	emunit_display_nputs(emunit_display_json_cleanup_escape, str, n);
+	emunit_display_putc('"');
+}
+
+/**
+ * @brief Display assertion failed header
+ *
+ * Function that generates the beginning of every failure record.
+ *
+ * @param p_head     Assertion header
+ * @param p_str_type String that describes the assertion
+ */
+static void emunit_display_json_failed_header(
+	const __flash emunit_assert_head_t * p_head,
+	const __flash char * p_str_type)
+{
+	emunit_display_json_tc_failed = true;
+	emunit_display_json_event(EMUNIT_FLASHSTR("failure"));
+	emunit_display_json_suite();
+	emunit_display_json_case();
+	emunit_display_printf(
+		NULL,
+		EMUNIT_FLASHSTR(",\"type\":\"%"PRIsPGM"\",\"id\":%u,\"line\":%u"),
+		p_str_type,
+		emunit_display_failure_id(),
+		p_head->line
+	);
+	emunit_display_json_str(EMUNIT_FLASHSTR("file"), p_head->p_file, EMUNIT_STRLEN_MAX);
+}
+
+/**
+ * @brief Print the message included in assertion
+ *
+ * @param p_fmt Format strings.
+ *              Can be NULL - then the msg field would not be generated.
+ * @param args  Arguments list
+ */
+static void emunit_display_json_msg(const __flash char * p_fmt, va_list args)
+{
+	if(NULL != p_fmt)
+	{
+		emunit_display_puts(NULL, EMUNIT_FLASHSTR(",\"msg\":\""));
+		emunit_display_vprintf(
+			emunit_display_json_cleanup_escape,
+			p_fmt,
+			args);
+		emunit_display_putc('"');
+	}
+}
+
+/**
+ * @brief Auxiliary function to print the value
+ *
+ * Decimal values are printed as JSON numbers,
+ * hexadecimal values as strings.
+ *
+ * @param type   Type of the value to be printed.
+ * @param p_name The name of the value.
+ * @param val    Value itself.
+ */
+static void emunit_display_json_value(
+	emunit_numtypes_t type,
+	const __flash char * p_name,
+	emunit_num_t val)
+{
+	emunit_display_printf(NULL, EMUNIT_FLASHSTR(",\"%"PRIsPGM"\":"), p_name);
+
+#define EMUNIT_DISPLAY_JSON_CASES(size)                                                            \
+	case EMUNIT_CN2(EMUNIT_NUMTYPE_U, size):                                                       \
+		emunit_display_printf(                                                                     \
+			NULL,                                                                                  \
+			EMUNIT_FLASHSTR("%"EMUNIT_CN2(PRIu, size)),                                            \
+			(EMUNIT_CN3(uint, size, _t))val.u);                                                    \
+		break;                                                                                     \
+	case EMUNIT_CN2(EMUNIT_NUMTYPE_S, size):                                                       \
+		emunit_display_printf(                                                                     \
+			NULL,                                                                                  \
+			EMUNIT_FLASHSTR("%"EMUNIT_CN2(PRId, size)),                                            \
+			(EMUNIT_CN3(int, size, _t))val.s);                                                     \
+		break;                                                                                     \
+	case EMUNIT_CN2(EMUNIT_NUMTYPE_X, size):                                                       \
+		emunit_display_printf(                                                                     \
+			NULL,                                                                                  \
+			EMUNIT_FLASHSTR("\"0x%"EMUNIT_CN2(PRIx, size)"\""),                                    \
+			(EMUNIT_CN3(uint, size, _t))val.u);                                                    \
+		break
+
+	switch(type)
+	{
+	case EMUNIT_NUMTYPE_BOOL:
+		emunit_display_puts(
+			NULL,
+			((bool)val.u) ? EMUNIT_FLASHSTR("true") : EMUNIT_FLASHSTR("false")
+		);
+		break;
+	EMUNIT_DISPLAY_JSON_CASES(8);
+	EMUNIT_DISPLAY_JSON_CASES(16);
+
+#if (EMUNIT_CONF_NUMBER_SIZE > 16) || defined(__DOXYGEN__)
+	EMUNIT_DISPLAY_JSON_CASES(32);
+#endif
+#if (EMUNIT_CONF_NUMBER_SIZE > 32) || defined(__DOXYGEN__)
+	EMUNIT_DISPLAY_JSON_CASES(64);
+#endif
+	default:
+		EMUNIT_IASSERT_MSG(false, "ERROR: Wrong value type");
+		break;
+	}
+}
+
+/**
+ * @brief Auxiliary function to print the string part
+ *
+ * Prints the object with the string length, the index of the first
+ * printed character and the printed part of the string.
+ *
+ * @param p_name     The name of the value.
+ * @param n          Maximum number of characters to be compared.
+ * @param str        The string.
+ * @param start_skip Number of characters skipped at the beginning.
+ */
+static void emunit_display_json_nstr(
+	const __flash char * p_name,
+	size_t n,
+	const __memx char * str,
+	size_t start_skip)
+{
+	size_t len = emunit_strlen(str);
+	if ( len > n )
+		len = n;
+
+	EMUNIT_IASSERT(start_skip <= len);
+	emunit_display_printf(
+		NULL,
+		EMUNIT_FLASHSTR(",\"%"PRIsPGM"\":{\"length\":%u,\"start\":%u,\"val\":\""),
+		p_name,
+		len,
+		start_skip
+	);
+	emunit_display_write(
+		emunit_display_json_cleanup_escape,
+		str + start_skip,
+		EMUNIT_MIN(len - start_skip, EMUNIT_CONF_STRLEN_LIMIT));
+	emunit_display_puts(NULL, EMUNIT_FLASHSTR("\"}"));
+}
+
+static void emunit_display_json_failed_assert_details(
+	const __flash emunit_assert_head_t * p_head,
+	const __flash char * str_expr)
+{
+	(void)p_head;
+	emunit_display_json_str(EMUNIT_FLASHSTR("expression"), str_expr, EMUNIT_STRLEN_MAX);
+}
+
+static void emunit_display_json_failed_equal_details(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_num_t expected,
+	emunit_num_t actual)
+{
+	emunit_display_json_value(p_head->numtype, EMUNIT_FLASHSTR("expected"), expected);
+	emunit_display_json_value(p_head->numtype, EMUNIT_FLASHSTR("actual"),   actual);
+}
+
+static void emunit_display_json_failed_range_details(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_num_t min,
+	emunit_num_t max,
+	emunit_num_t actual)
+{
+	emunit_display_json_value(p_head->numtype, EMUNIT_FLASHSTR("min"),    min);
+	emunit_display_json_value(p_head->numtype, EMUNIT_FLASHSTR("max"),    max);
+	emunit_display_json_value(p_head->numtype, EMUNIT_FLASHSTR("actual"), actual);
+}
+
+static void emunit_display_json_failed_delta_details(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_unum_t delta,
+	emunit_num_t expected,
+	emunit_num_t actual)
+{
+	emunit_numtypes_t delta_numtype =
+		emunit_numtype_hex_check(p_head->numtype)
+		?
+		EMUNIT_CN2(EMUNIT_NUMTYPE_X, EMUNIT_CONF_NUMBER_SIZE)
+		:
+		EMUNIT_CN2(EMUNIT_NUMTYPE_U, EMUNIT_CONF_NUMBER_SIZE);
+	emunit_display_json_value(delta_numtype,   EMUNIT_FLASHSTR("delta"),    (emunit_num_t){.u = delta });
+	emunit_display_json_value(p_head->numtype, EMUNIT_FLASHSTR("expected"), expected);
+	emunit_display_json_value(p_head->numtype, EMUNIT_FLASHSTR("actual"),   actual);
+}
+
+static void emunit_display_json_failed_nstr_details(
+	const __flash emunit_assert_head_t * p_head,
+	size_t n,
+	const __memx char * str_expected,
+	const __memx char * str_actual,
+	size_t err_pos)
+{
+	size_t skip_start = 0;
+	(void)p_head;
+	emunit_display_printf(NULL, EMUNIT_FLASHSTR(",\"err_idx\":%u"), err_pos);
+
+	if(err_pos > EMUNIT_CONF_STRLEN_LIMIT)
+	{
+		skip_start = 1 + err_pos - EMUNIT_CONF_STRLEN_LIMIT;
+	}
+
+	emunit_display_json_nstr(EMUNIT_FLASHSTR("expected"), n, str_expected, skip_start);
+	emunit_display_json_nstr(EMUNIT_FLASHSTR("actual"),   n, str_actual,   skip_start);
+}
+
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+static void emunit_display_json_failed_cycles_details(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t budget,
+	emunit_timestamp_t measured)
+{
+	(void)p_head;
+	emunit_display_printf(
+		NULL,
+		EMUNIT_FLASHSTR(
+			",\"budget\":%"PRIuTIMESTAMP",\"measured\":%"PRIuTIMESTAMP
+			",\"unit\":\"" EMUNIT_TIMESTAMP_UNIT "\""
+		),
+		budget,
+		measured
+	);
+}
+
+static void emunit_display_json_failed_regression_details(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t baseline,
+	emunit_timestamp_t limit,
+	emunit_timestamp_t measured)
+{
+	(void)p_head;
+	emunit_display_printf(
+		NULL,
+		EMUNIT_FLASHSTR(
+			",\"baseline\":%"PRIuTIMESTAMP",\"limit\":%"PRIuTIMESTAMP
+			",\"measured\":%"PRIuTIMESTAMP",\"unit\":\"" EMUNIT_TIMESTAMP_UNIT "\""
+		),
+		baseline,
+		limit,
+		measured
+	);
+}
+#endif
+
+/**
+ * @brief Put escaped string into the panic record
+ *
+ * The panic record cannot use the cleanup functions,
+ * so the string is escaped character by character.
+ *
+ * @param str String to be escaped
+ */
+static void emunit_display_json_panic_escape(const __flash char * str)
+{
+	char c;
+	while('\0' != (c = *str++))
+	{
+		char str_c[] = "\\u00XX";
+		if((unsigned char)c < 0x20U)
+		{
+			str_c[4] = emunit_display_json_hex[((unsigned char)c) >> 4];
+			str_c[5] = emunit_display_json_hex[((unsigned char)c) & 0x0fU];
+		}
+		else if(('"' == c) || ('\\' == c))
+		{
+			str_c[1] = c;
+			str_c[2] = '\0';
+		}
+		else
+		{
+			str_c[0] = c;
+			str_c[1] = '\0';
+		}
+		emunit_display_panic_puts(str_c);
+	}
+}
+
+void emunit_display_json_show_panic(
+	const __flash char * str_file,
+	unsigned int line)
+{
+	emunit_display_panic_puts("{\"event\":\"panic\",\"file\":\"");
+	emunit_display_json_panic_escape(str_file);
+	emunit_display_panic_printf("\",\"line\":%u}"NEWLINE, line);
+}
+
+void emunit_display_json_test_start(void)
+{
+	emunit_display_json_event(EMUNIT_FLASHSTR("test_start"));
+	emunit_display_printf(
+		NULL,
+		EMUNIT_FLASHSTR(",\"name\":\"%"PRIsPGM"\""),
+		emunit_test_name_get()
+	);
+	emunit_display_json_end();
+}
+
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+/**
+ * @brief Print the durations field
+ *
+ * @param p_time Durations to be printed, nothing is printed if NULL
+ */
+static void emunit_display_json_time(const emunit_time_t * p_time)
+{
+	if(NULL != p_time)
+	{
+		emunit_display_printf(
+			NULL,
+			EMUNIT_FLASHSTR(
+				",\"time\":{\"init\":%"PRIuTIMESTAMP",\"test\":%"PRIuTIMESTAMP
+				",\"cleanup\":%"PRIuTIMESTAMP",\"unit\":\"" EMUNIT_TIMESTAMP_UNIT "\"}"
+			),
+			p_time->init,
+			p_time->test,
+			p_time->cleanup
+		);
+	}
+}
+
+/**
+ * @brief Print the benchmark results field
+ *
+ * @param p_bench Benchmark results to be printed, nothing is printed if NULL
+ */
+static void emunit_display_json_bench(const emunit_bench_t * p_bench)
+{
+	if(NULL != p_bench)
+	{
+		emunit_display_printf(
+			NULL,
+			EMUNIT_FLASHSTR(
+				",\"bench\":{\"iterations\":%"PRIu32",\"samples\":%u"
+				",\"min\":%"PRIuTIMESTAMP",\"median\":%"PRIuTIMESTAMP
+				",\"p90\":%"PRIuTIMESTAMP",\"p99\":%"PRIuTIMESTAMP
+				",\"unit\":\"" EMUNIT_TIMESTAMP_UNIT "\"}"
+			),
+			p_bench->iterations,
+			(unsigned int)EMUNIT_CONF_BENCH_SAMPLES,
+			p_bench->min,
+			p_bench->median,
+			p_bench->p90,
+			p_bench->p99
+		);
+	}
+}
+#endif
+
+void emunit_display_json_test_end(void)
+{
+	emunit_display_json_event(EMUNIT_FLASHSTR("summary"));
+	emunit_display_printf(
+		NULL,
+		EMUNIT_FLASHSTR(
+			",\"suites\":{\"total\":%u,\"passed\":%u,\"failed\":%u}"
+			",\"cases\":{\"total\":%u,\"passed\":%u,\"failed\":%u}"
+		),
+		emunit_ts_selected_count(),
+		emunit_ts_passed_get(),
+		emunit_ts_failed_get(),
+		emunit_tc_selected_count(),
+		emunit_tc_passed_get(),
+		emunit_tc_failed_get()
+	);
+#if EMUNIT_CONF_DISPLAY_BUFFER_STAT
+	{
+		const emunit_display_usage_t * p_usage = emunit_display_usage_get();
+		emunit_display_printf(
+			NULL,
+			EMUNIT_FLASHSTR(",\"buffer\":{\"size\":%u,\"used_max\":%u,\"near_overflow\":%u}"),
+			(size_t)EMUNIT_CONF_BUFFER_SIZE,
+			p_usage->used_max,
+			p_usage->tc_n_near_overflow
+		);
+	}
+#endif
+	emunit_display_json_end();
+}
+
+void emunit_display_json_ts_start(void)
+{
+#if !EMUNIT_CONF_DISPLAY_QUIET
+	emunit_display_json_event(EMUNIT_FLASHSTR("ts_start"));
+	emunit_display_json_suite();
+	emunit_display_json_end();
+#endif
+}
+
+void emunit_display_json_ts_end(void)
+{
+#if EMUNIT_CONF_DISPLAY_QUIET
+	if(!emunit_ts_current_failed_get())
+		return;
+#endif
+	emunit_display_json_event(EMUNIT_FLASHSTR("ts_end"));
+	emunit_display_json_suite();
+	emunit_display_printf(
+		NULL,
+		EMUNIT_FLASHSTR(",\"result\":\"%"PRIsPGM"\""),
+		emunit_ts_current_failed_get() ? EMUNIT_FLASHSTR("failed") : EMUNIT_FLASHSTR("passed")
+	);
+#if EMUNIT_CONF_TIMING
+	emunit_display_json_time(emunit_ts_time_get());
+#endif
+	emunit_display_json_end();
+}
+
+void emunit_display_json_tc_start(void)
+{
+	emunit_display_json_tc_failed = false;
+}
+
+void emunit_display_json_tc_end(void)
+{
+	const size_t used = emunit_display_used_size();
+	const bool near_overflow = emunit_display_tc_usage_register();
+	bool failed = emunit_display_json_tc_failed;
+#if EMUNIT_CONF_DISPLAY_DEFER
+	failed = failed || emunit_display_record_pending();
+#endif
+#if EMUNIT_CONF_DISPLAY_QUIET
+	if(!failed)
+		return;
+#endif
+	emunit_display_json_event(EMUNIT_FLASHSTR("tc_end"));
+	emunit_display_json_suite();
+	emunit_display_json_case();
+	emunit_display_printf(
+		NULL,
+		EMUNIT_FLASHSTR(",\"result\":\"%"PRIsPGM"\""),
+		failed ? EMUNIT_FLASHSTR("failed") : EMUNIT_FLASHSTR("passed")
+	);
+#if EMUNIT_CONF_TIMING
+	emunit_display_json_time(emunit_tc_time_get());
+	emunit_display_json_bench(emunit_tc_bench_get());
+#endif
+	if(near_overflow)
+	{
+		emunit_display_printf(NULL, EMUNIT_FLASHSTR(",\"buffer_used\":%u"), used);
+	}
+	emunit_display_json_end();
+}
+
+void emunit_display_json_failed_timeout(void)
+{
+	emunit_display_json_tc_failed = true;
+	emunit_display_json_event(EMUNIT_FLASHSTR("failure"));
+	emunit_display_json_suite();
+	emunit_display_json_case();
+	emunit_display_printf(
+		NULL,
+		EMUNIT_FLASHSTR(",\"type\":\"TIMEOUT\",\"id\":%u"),
+		emunit_display_failure_id()
+	);
+	emunit_display_json_end();
+}
+
+void emunit_display_json_failed_assert(
+	const __flash emunit_assert_head_t * p_head,
+	const __flash char * str_expr)
+{
+	emunit_display_json_failed_header(p_head, EMUNIT_FLASHSTR("ASSERT"));
+	emunit_display_json_failed_assert_details(p_head, str_expr);
+	emunit_display_json_end();
+}
+
+void emunit_display_json_failed_assert_msg(
+	const __flash emunit_assert_head_t * p_head,
+	const __flash char * str_expr,
+	const __flash char * fmt,
+	va_list va_args)
+{
+	emunit_display_json_failed_header(p_head, EMUNIT_FLASHSTR("ASSERT"));
+	emunit_display_json_msg(fmt, va_args);
+	emunit_display_json_failed_assert_details(p_head, str_expr);
+	emunit_display_json_end();
+}
+
+void emunit_display_json_failed_equal(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_num_t expected,
+	emunit_num_t actual)
+{
+	emunit_display_json_failed_header(p_head, EMUNIT_FLASHSTR("EQUAL"));
+	emunit_display_json_failed_equal_details(p_head, expected, actual);
+	emunit_display_json_end();
+}
+
+void emunit_display_json_failed_equal_msg(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_num_t expected,
+	emunit_num_t actual,
+	const __flash char * fmt,
+	va_list va_args)
+{
+	emunit_display_json_failed_header(p_head, EMUNIT_FLASHSTR("EQUAL"));
+	emunit_display_json_msg(fmt, va_args);
+	emunit_display_json_failed_equal_details(p_head, expected, actual);
+	emunit_display_json_end();
+}
+
+void emunit_display_json_failed_range(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_num_t min,
+	emunit_num_t max,
+	emunit_num_t actual)
+{
+	emunit_display_json_failed_header(p_head, EMUNIT_FLASHSTR("RANGE"));
+	emunit_display_json_failed_range_details(p_head, min, max, actual);
+	emunit_display_json_end();
+}
+
+void emunit_display_json_failed_range_msg(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_num_t min,
+	emunit_num_t max,
+	emunit_num_t actual,
+	const __flash char * fmt,
+	va_list va_args)
+{
+	emunit_display_json_failed_header(p_head, EMUNIT_FLASHSTR("RANGE"));
+	emunit_display_json_msg(fmt, va_args);
+	emunit_display_json_failed_range_details(p_head, min, max, actual);
+	emunit_display_json_end();
+}
+
+void emunit_display_json_failed_delta(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_unum_t delta,
+	emunit_num_t expected,
+	emunit_num_t actual)
+{
+	emunit_display_json_failed_header(p_head, EMUNIT_FLASHSTR("DELTA"));
+	emunit_display_json_failed_delta_details(p_head, delta, expected, actual);
+	emunit_display_json_end();
+}
+
+void emunit_display_json_failed_delta_msg(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_unum_t delta,
+	emunit_num_t expected,
+	emunit_num_t actual,
+	const __flash char * fmt,
+	va_list va_args)
+{
+	emunit_display_json_failed_header(p_head, EMUNIT_FLASHSTR("DELTA"));
+	emunit_display_json_msg(fmt, va_args);
+	emunit_display_json_failed_delta_details(p_head, delta, expected, actual);
+	emunit_display_json_end();
+}
+
+void emunit_display_json_failed_nstr(
+	const __flash emunit_assert_head_t * p_head,
+	size_t n,
+	const __memx char * str_expected,
+	const __memx char * str_actual,
+	size_t err_pos)
+{
+	emunit_display_json_failed_header(p_head, EMUNIT_FLASHSTR("STRING"));
+	emunit_display_json_failed_nstr_details(p_head, n, str_expected, str_actual, err_pos);
+	emunit_display_json_end();
+}
+
+void emunit_display_json_failed_nstr_msg(
+	const __flash emunit_assert_head_t * p_head,
+	size_t n,
+	const __memx char * str_expected,
+	const __memx char * str_actual,
+	size_t err_pos,
+	const __flash char * fmt,
+	va_list va_args)
+{
+	emunit_display_json_failed_header(p_head, EMUNIT_FLASHSTR("STRING"));
+	emunit_display_json_msg(fmt, va_args);
+	emunit_display_json_failed_nstr_details(p_head, n, str_expected, str_actual, err_pos);
+	emunit_display_json_end();
+}
+
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+void emunit_display_json_failed_cycles(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t budget,
+	emunit_timestamp_t measured)
+{
+	emunit_display_json_failed_header(p_head, EMUNIT_FLASHSTR("CYCLES"));
+	emunit_display_json_failed_cycles_details(p_head, budget, measured);
+	emunit_display_json_end();
+}
+
+void emunit_display_json_failed_cycles_msg(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t budget,
+	emunit_timestamp_t measured,
+	const __flash char * fmt,
+	va_list va_args)
+{
+	emunit_display_json_failed_header(p_head, EMUNIT_FLASHSTR("CYCLES"));
+	emunit_display_json_msg(fmt, va_args);
+	emunit_display_json_failed_cycles_details(p_head, budget, measured);
+	emunit_display_json_end();
+}
+
+void emunit_display_json_failed_regression(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t baseline,
+	emunit_timestamp_t limit,
+	emunit_timestamp_t measured)
+{
+	emunit_display_json_failed_header(p_head, EMUNIT_FLASHSTR("REGRESSION"));
+	emunit_display_json_failed_regression_details(p_head, baseline, limit, measured);
+	emunit_display_json_end();
+}
+#endif
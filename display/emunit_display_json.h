@@ -0,0 +1,172 @@
+#ifndef EMUNIT_DISPLAY_JSON_H_INCLUDED
+#define EMUNIT_DISPLAY_JSON_H_INCLUDED
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief EMUnit JSON presentation module
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ *
+ * @sa emunit_display_json_group
+ */
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include "emunit_types.h"
+
+/**
+ * @defgroup emunit_display_json_group <emunit_display_json> JSON presentation module
+ * @{
+ * @ingroup emunit_display_group
+ */
+
+/** See @ref emunit_display_show_panic */
+void emunit_display_json_show_panic(
+	const __flash char * str_file,
+	unsigned int line);
+
+/** See @ref emunit_display_test_start */
+void emunit_display_json_test_start(void);
+
+/** See @ref emunit_display_test_end */
+void emunit_display_json_test_end(void);
+
+/** See @ref emunit_display_ts_start */
+void emunit_display_json_ts_start(void);
+
+/** See @ref emunit_display_ts_end */
+void emunit_display_json_ts_end(void);
+
+/** See @ref emunit_display_ts_end */
+void emunit_display_json_tc_start(void);
+
+/** See @ref emunit_display_tc_end */
+void emunit_display_json_tc_end(void);
+
+/** See @ref emunit_display_failed_timeout */
+void emunit_display_json_failed_timeout(void);
+
+
+/** See @ref emunit_display_failed_assert documentation */
+void emunit_display_json_failed_assert(
+	const __flash emunit_assert_head_t * p_head,
+	const __flash char * str_expr);
+
+/** See @ref emunit_display_failed_assert_msg documentation */
+void emunit_display_json_failed_assert_msg(
+	const __flash emunit_assert_head_t * p_head,
+	const __flash char * str_expr,
+	const __flash char * fmt,
+	va_list va_args);
+
+/** See @ref emunit_display_failed_equal documentation */
+void emunit_display_json_failed_equal(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_num_t expected,
+	emunit_num_t actual);
+
+/** See @ref emunit_display_failed_equal_msg documentation */
+void emunit_display_json_failed_equal_msg(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_num_t expected,
+	emunit_num_t actual,
+	const __flash char * fmt,
+	va_list va_args);
+
+/** See @ref emunit_display_failed_range documentation */
+void emunit_display_json_failed_range(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_num_t min,
+	emunit_num_t max,
+	emunit_num_t actual);
+
+/** See @ref emunit_display_failed_range_msg documentation */
+void emunit_display_json_failed_range_msg(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_num_t min,
+	emunit_num_t max,
+	emunit_num_t actual,
+	const __flash char * fmt,
+	va_list args);
+
+/** See @ref emunit_display_failed_delta documentation */
+void emunit_display_json_failed_delta(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_unum_t delta,
+	emunit_num_t expected,
+	emunit_num_t actual);
+
+/** See @ref emunit_display_failed_delta_msg documentation */
+void emunit_display_json_failed_delta_msg(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_unum_t delta,
+	emunit_num_t expected,
+	emunit_num_t actual,
+	const __flash char * fmt,
+	va_list va_args);
+
+/** See @ref emunit_display_failed_str documentation */
+void emunit_display_json_failed_nstr(
+	const __flash emunit_assert_head_t * p_head,
+	size_t n,
+	const __memx char * str_expected,
+	const __memx char * str_actual,
+	size_t err_pos);
+
+/** See @ref emunit_display_failed_str_msg documentation */
+void emunit_display_json_failed_nstr_msg(
+	const __flash emunit_assert_head_t * p_head,
+	size_t n,
+	const __memx char * str_expected,
+	const __memx char * str_actual,
+	size_t err_pos,
+	const __flash char * fmt,
+	va_list va_args);
+
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+/** See @ref emunit_display_failed_cycles documentation */
+void emunit_display_json_failed_cycles(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t budget,
+	emunit_timestamp_t measured);
+
+/** See @ref emunit_display_failed_cycles_msg documentation */
+void emunit_display_json_failed_cycles_msg(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t budget,
+	emunit_timestamp_t measured,
+	const __flash char * fmt,
+	va_list va_args);
+
+/** See @ref emunit_display_failed_regression documentation */
+void emunit_display_json_failed_regression(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t baseline,
+	emunit_timestamp_t limit,
+	emunit_timestamp_t measured);
+#endif
+
+/** @} */
+#endif /* EMUNIT_DISPLAY_JSON_H_INCLUDED */
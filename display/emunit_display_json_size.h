@@ -0,0 +1,177 @@
+#ifndef EMUNIT_DISPLAY_JSON_SIZE_H_INCLUDED
+#define EMUNIT_DISPLAY_JSON_SIZE_H_INCLUDED
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief EMUnit JSON Lines presentation module worst-case output sizes
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * Constant expressions that gives the maximum number of bytes
+ * placed in the display buffer by the assertion failure report.
+ * This file is included by the assertion macros, so it cannot contain
+ * anything but preprocessor definitions.
+ *
+ * @sa emunit_display_json_size_group
+ */
+#include "config_emunit.h"
+#include "emunit_macros.h"
+
+/**
+ * @defgroup emunit_display_json_size_group <emunit_display_json_size> JSON worst-case output sizes
+ * @{
+ * @ingroup emunit_display_json_group
+ */
+
+/**
+ * @name Basic elements sizes
+ * @{
+ */
+/** Size of the string literal without terminating zero */
+#define EMUNIT_DISPLAY_JSON_SIZE_LIT(s) (sizeof(s) - 1U)
+/** Size of the newline */
+#define EMUNIT_DISPLAY_JSON_SIZE_NL EMUNIT_DISPLAY_JSON_SIZE_LIT(EMUNIT_CONF_DISPLAY_NL)
+/** Maximum size of unsigned value printed by @c \%u */
+#define EMUNIT_DISPLAY_JSON_SIZE_UINT ((sizeof(unsigned int) > 2U) ? 10U : 5U)
+/** Maximum size of the number printed in assertion details, hex values are quoted */
+#define EMUNIT_DISPLAY_JSON_SIZE_NUM                \
+	((EMUNIT_CONF_NUMBER_SIZE > 32) ? 20U :         \
+	((EMUNIT_CONF_NUMBER_SIZE > 16) ? 12U : 7U))
+/** Maximum size of the value name used in assertion details */
+#define EMUNIT_DISPLAY_JSON_SIZE_NAME EMUNIT_DISPLAY_JSON_SIZE_LIT("expected")
+/** Maximum size of the assertion type name */
+#define EMUNIT_DISPLAY_JSON_SIZE_TYPE EMUNIT_DISPLAY_JSON_SIZE_LIT("STRING")
+/** Maximum size of single character after escaping */
+#define EMUNIT_DISPLAY_JSON_SIZE_ESCAPE EMUNIT_DISPLAY_JSON_SIZE_LIT("\\u0000")
+/** @} */
+
+/**
+ * @name Failure record parts
+ * @{
+ */
+/**
+ * @brief Failure record header size
+ *
+ * The file name is assumed to require escaping of path separators.
+ *
+ * @param file_size Size of the file name including terminating zero
+ */
+#define EMUNIT_DISPLAY_JSON_SIZE_HEADER(file_size)                                        \
+	(EMUNIT_DISPLAY_JSON_SIZE_LIT("{\"event\":\"failure\",\"suite\":\"\",\"case\":\"\"") +    \
+	 EMUNIT_DISPLAY_JSON_SIZE_LIT(",\"type\":\"\",\"id\":,\"line\":") +                      \
+	 EMUNIT_DISPLAY_JSON_SIZE_TYPE + 2U * EMUNIT_DISPLAY_JSON_SIZE_UINT +                    \
+	 EMUNIT_DISPLAY_JSON_SIZE_LIT(",\"file\":\"\"") + 2U * ((file_size) - 1U))
+
+/** Record end size */
+#define EMUNIT_DISPLAY_JSON_SIZE_FOOTER                                                   \
+	(EMUNIT_DISPLAY_JSON_SIZE_LIT("}") + EMUNIT_DISPLAY_JSON_SIZE_NL)
+
+/** Message field size without the message itself */
+#define EMUNIT_DISPLAY_JSON_SIZE_MSG EMUNIT_DISPLAY_JSON_SIZE_LIT(",\"msg\":\"\"")
+
+/**
+ * @brief Expression field size
+ *
+ * @param text_size Size of the expression including terminating zero
+ */
+#define EMUNIT_DISPLAY_JSON_SIZE_EXPR(text_size)                                          \
+	(EMUNIT_DISPLAY_JSON_SIZE_LIT(",\"expression\":\"\"") +                                 \
+	 ((text_size) - 1U) * EMUNIT_DISPLAY_JSON_SIZE_ESCAPE)
+
+/** Single value field size */
+#define EMUNIT_DISPLAY_JSON_SIZE_VALUE                                                    \
+	(EMUNIT_DISPLAY_JSON_SIZE_LIT(",\"\":") + EMUNIT_DISPLAY_JSON_SIZE_NAME +               \
+	 EMUNIT_DISPLAY_JSON_SIZE_NUM)
+
+/** Single string object size */
+#define EMUNIT_DISPLAY_JSON_SIZE_NSTR                                                     \
+	(EMUNIT_DISPLAY_JSON_SIZE_LIT(",\"\":{\"length\":,\"start\":,\"val\":\"\"}") +          \
+	 EMUNIT_DISPLAY_JSON_SIZE_NAME + 2U * EMUNIT_DISPLAY_JSON_SIZE_UINT +                  \
+	 EMUNIT_CONF_STRLEN_LIMIT * EMUNIT_DISPLAY_JSON_SIZE_ESCAPE)
+
+/** String error index field size */
+#define EMUNIT_DISPLAY_JSON_SIZE_ERR_IDX                                                  \
+	(EMUNIT_DISPLAY_JSON_SIZE_LIT(",\"err_idx\":") + EMUNIT_DISPLAY_JSON_SIZE_UINT)
+
+/**
+ * @brief Cycle budget fields size
+ *
+ * 64 bit timestamp values are assumed.
+ */
+#define EMUNIT_DISPLAY_JSON_SIZE_CYCLES                                                   \
+	(EMUNIT_DISPLAY_JSON_SIZE_LIT(",\"budget\":,\"measured\":,\"unit\":\"cycles\"") +   \
+	 2U * 20U)
+/** @} */
+
+/**
+ * @name Worst-case record size for every assertion function
+ *
+ * The assertion expression is counted by its literal size.
+ * The texts that are known only at runtime are not counted:
+ * the message and the suite name.
+ * @{
+ */
+#define EMUNIT_DISPLAY_JSON_SIZE_ut_assert(file_size, text_size)                          \
+	(EMUNIT_DISPLAY_JSON_SIZE_HEADER(file_size) + EMUNIT_DISPLAY_JSON_SIZE_EXPR(text_size) + \
+	 EMUNIT_DISPLAY_JSON_SIZE_FOOTER)
+
+#define EMUNIT_DISPLAY_JSON_SIZE_ut_assert_equal(file_size, text_size)                    \
+	(EMUNIT_DISPLAY_JSON_SIZE_HEADER(file_size) + 2U * EMUNIT_DISPLAY_JSON_SIZE_VALUE +     \
+	 EMUNIT_DISPLAY_JSON_SIZE_FOOTER)
+
+#define EMUNIT_DISPLAY_JSON_SIZE_ut_assert_range(file_size, text_size)                    \
+	(EMUNIT_DISPLAY_JSON_SIZE_HEADER(file_size) + 3U * EMUNIT_DISPLAY_JSON_SIZE_VALUE +     \
+	 EMUNIT_DISPLAY_JSON_SIZE_FOOTER)
+
+#define EMUNIT_DISPLAY_JSON_SIZE_ut_assert_delta(file_size, text_size)                    \
+	(EMUNIT_DISPLAY_JSON_SIZE_HEADER(file_size) + 3U * EMUNIT_DISPLAY_JSON_SIZE_VALUE +     \
+	 EMUNIT_DISPLAY_JSON_SIZE_FOOTER)
+
+#define EMUNIT_DISPLAY_JSON_SIZE_ut_assert_nstr(file_size, text_size)                     \
+	(EMUNIT_DISPLAY_JSON_SIZE_HEADER(file_size) + EMUNIT_DISPLAY_JSON_SIZE_ERR_IDX +        \
+	 2U * EMUNIT_DISPLAY_JSON_SIZE_NSTR + EMUNIT_DISPLAY_JSON_SIZE_FOOTER)
+
+#define EMUNIT_DISPLAY_JSON_SIZE_ut_assert_cycles_max(file_size, text_size)               \
+	(EMUNIT_DISPLAY_JSON_SIZE_HEADER(file_size) + EMUNIT_DISPLAY_JSON_SIZE_CYCLES +         \
+	 EMUNIT_DISPLAY_JSON_SIZE_FOOTER)
+/** @} */
+
+/**
+ * @brief Worst-case failure record size
+ *
+ * The generic interface used by the assertion macros.
+ * The display name is added to the macro name,
+ * so the sizes of multiple displays may be compared.
+ *
+ * @param func      Assertion function name
+ * @param file_size Size of the file name including terminating zero
+ * @param text_size Size of the assertion text including terminating zero
+ * @param tc_size   Size of the test case name including terminating zero
+ * @param msg       1 if the message field is present, 0 otherwise
+ */
+#define EMUNIT_DISPLAY_SIZE_json(func, file_size, text_size, tc_size, msg)                \
+	(((tc_size) - 1U) + EMUNIT_CN2(EMUNIT_DISPLAY_JSON_SIZE_, func)(file_size, text_size) + \
+	 ((msg) ? EMUNIT_DISPLAY_JSON_SIZE_MSG : 0U))
+
+/** @} */
+#endif /* EMUNIT_DISPLAY_JSON_SIZE_H_INCLUDED */
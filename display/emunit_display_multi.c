@@ -0,0 +1,293 @@
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief EMUnit multiple displays presentation module implementation
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * Every event is passed to all the selected displays.
+ * Before the display is called, its own buffer region is selected.
+ *
+ * @note The selected displays have to be different.
+ *
+ * @sa emunit_display_multi_group
+ */
+#include "../emunit.h"
+#include "emunit_display_multi.h"
+
+#include EMUNIT_DISPLAY_FILE_OF(EMUNIT_CONF_DISPLAY_MULTI_0, , c)
+#if EMUNIT_CONF_DISPLAY_MULTI > 1
+#include EMUNIT_DISPLAY_FILE_OF(EMUNIT_CONF_DISPLAY_MULTI_1, , c)
+#endif
+#if EMUNIT_CONF_DISPLAY_MULTI > 2
+#include EMUNIT_DISPLAY_FILE_OF(EMUNIT_CONF_DISPLAY_MULTI_2, , c)
+#endif
+#if EMUNIT_CONF_DISPLAY_MULTI > 3
+#include EMUNIT_DISPLAY_FILE_OF(EMUNIT_CONF_DISPLAY_MULTI_3, , c)
+#endif
+
+/**
+ * @brief Call the function of the given display
+ *
+ * The display region is selected before the call.
+ *
+ * @param idx       Display index
+ * @param name      The base name of the display function
+ * @param call_args Calling arguments in brackets
+ */
+#define EMUNIT_DISPLAY_MULTI_CALL(idx, name, call_args)                                    \
+	emunit_display_region_select(idx);                                                     \
+	EMUNIT_DISPLAY_NAME_OF(EMUNIT_CN2(EMUNIT_CONF_DISPLAY_MULTI_, idx), name) call_args;
+
+/**
+ * @brief Call the function of the given display with the message arguments
+ *
+ * Every display consumes the argument list,
+ * so every display gets its own copy of @c va_args, named @c va_args_copy.
+ *
+ * @param idx       Display index
+ * @param name      The base name of the display function
+ * @param call_args Calling arguments in brackets
+ */
+#define EMUNIT_DISPLAY_MULTI_CALL_VA(idx, name, call_args)                                 \
+	{                                                                                      \
+		va_list va_args_copy;                                                              \
+		va_copy(va_args_copy, va_args);                                                    \
+		EMUNIT_DISPLAY_MULTI_CALL(idx, name, call_args)                                    \
+		va_end(va_args_copy);                                                              \
+	}
+
+/**
+ * @name Calls of the optional displays
+ * @{
+ */
+#if EMUNIT_CONF_DISPLAY_MULTI > 1
+#define EMUNIT_DISPLAY_MULTI_CALL_1(call, name, call_args) call(1, name, call_args)
+#else
+#define EMUNIT_DISPLAY_MULTI_CALL_1(call, name, call_args)
+#endif
+#if EMUNIT_CONF_DISPLAY_MULTI > 2
+#define EMUNIT_DISPLAY_MULTI_CALL_2(call, name, call_args) call(2, name, call_args)
+#else
+#define EMUNIT_DISPLAY_MULTI_CALL_2(call, name, call_args)
+#endif
+#if EMUNIT_CONF_DISPLAY_MULTI > 3
+#define EMUNIT_DISPLAY_MULTI_CALL_3(call, name, call_args) call(3, name, call_args)
+#else
+#define EMUNIT_DISPLAY_MULTI_CALL_3(call, name, call_args)
+#endif
+/** @} */
+
+/**
+ * @brief Call the function of all the selected displays
+ *
+ * @param call      @ref EMUNIT_DISPLAY_MULTI_CALL or @ref EMUNIT_DISPLAY_MULTI_CALL_VA
+ * @param name      The base name of the display function
+ * @param call_args Calling arguments in brackets
+ */
+#define EMUNIT_DISPLAY_MULTI_FOREACH(call, name, call_args)                                \
+	call(0, name, call_args)                                                               \
+	EMUNIT_DISPLAY_MULTI_CALL_1(call, name, call_args)                                     \
+	EMUNIT_DISPLAY_MULTI_CALL_2(call, name, call_args)                                     \
+	EMUNIT_DISPLAY_MULTI_CALL_3(call, name, call_args)
+
+void emunit_display_multi_show_panic(
+	const __flash char * str_file,
+	unsigned int line)
+{
+	EMUNIT_DISPLAY_MULTI_FOREACH(EMUNIT_DISPLAY_MULTI_CALL, show_panic, (str_file, line))
+}
+
+void emunit_display_multi_test_start(void)
+{
+	EMUNIT_DISPLAY_MULTI_FOREACH(EMUNIT_DISPLAY_MULTI_CALL, test_start, ())
+}
+
+void emunit_display_multi_test_end(void)
+{
+	EMUNIT_DISPLAY_MULTI_FOREACH(EMUNIT_DISPLAY_MULTI_CALL, test_end, ())
+}
+
+void emunit_display_multi_ts_start(void)
+{
+	EMUNIT_DISPLAY_MULTI_FOREACH(EMUNIT_DISPLAY_MULTI_CALL, ts_start, ())
+}
+
+void emunit_display_multi_ts_end(void)
+{
+	EMUNIT_DISPLAY_MULTI_FOREACH(EMUNIT_DISPLAY_MULTI_CALL, ts_end, ())
+}
+
+void emunit_display_multi_tc_start(void)
+{
+	emunit_display_status.tc_near_overflow = false;
+	EMUNIT_DISPLAY_MULTI_FOREACH(EMUNIT_DISPLAY_MULTI_CALL, tc_start, ())
+}
+
+void emunit_display_multi_tc_end(void)
+{
+	EMUNIT_DISPLAY_MULTI_FOREACH(EMUNIT_DISPLAY_MULTI_CALL, tc_end, ())
+}
+
+void emunit_display_multi_failed_timeout(void)
+{
+	EMUNIT_DISPLAY_MULTI_FOREACH(EMUNIT_DISPLAY_MULTI_CALL, failed_timeout, ())
+}
+
+void emunit_display_multi_failed_assert(
+	const __flash emunit_assert_head_t * p_head,
+	const __flash char * str_expr)
+{
+	EMUNIT_DISPLAY_MULTI_FOREACH(EMUNIT_DISPLAY_MULTI_CALL, failed_assert,
+		(p_head, str_expr))
+}
+
+void emunit_display_multi_failed_assert_msg(
+	const __flash emunit_assert_head_t * p_head,
+	const __flash char * str_expr,
+	const __flash char * fmt,
+	va_list va_args)
+{
+	EMUNIT_DISPLAY_MULTI_FOREACH(EMUNIT_DISPLAY_MULTI_CALL_VA, failed_assert_msg,
+		(p_head, str_expr, fmt, va_args_copy))
+}
+
+void emunit_display_multi_failed_equal(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_num_t expected,
+	emunit_num_t actual)
+{
+	EMUNIT_DISPLAY_MULTI_FOREACH(EMUNIT_DISPLAY_MULTI_CALL, failed_equal,
+		(p_head, expected, actual))
+}
+
+void emunit_display_multi_failed_equal_msg(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_num_t expected,
+	emunit_num_t actual,
+	const __flash char * fmt,
+	va_list va_args)
+{
+	EMUNIT_DISPLAY_MULTI_FOREACH(EMUNIT_DISPLAY_MULTI_CALL_VA, failed_equal_msg,
+		(p_head, expected, actual, fmt, va_args_copy))
+}
+
+void emunit_display_multi_failed_range(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_num_t min,
+	emunit_num_t max,
+	emunit_num_t actual)
+{
+	EMUNIT_DISPLAY_MULTI_FOREACH(EMUNIT_DISPLAY_MULTI_CALL, failed_range,
+		(p_head, min, max, actual))
+}
+
+void emunit_display_multi_failed_range_msg(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_num_t min,
+	emunit_num_t max,
+	emunit_num_t actual,
+	const __flash char * fmt,
+	va_list va_args)
+{
+	EMUNIT_DISPLAY_MULTI_FOREACH(EMUNIT_DISPLAY_MULTI_CALL_VA, failed_range_msg,
+		(p_head, min, max, actual, fmt, va_args_copy))
+}
+
+void emunit_display_multi_failed_delta(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_unum_t delta,
+	emunit_num_t expected,
+	emunit_num_t actual)
+{
+	EMUNIT_DISPLAY_MULTI_FOREACH(EMUNIT_DISPLAY_MULTI_CALL, failed_delta,
+		(p_head, delta, expected, actual))
+}
+
+void emunit_display_multi_failed_delta_msg(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_unum_t delta,
+	emunit_num_t expected,
+	emunit_num_t actual,
+	const __flash char * fmt,
+	va_list va_args)
+{
+	EMUNIT_DISPLAY_MULTI_FOREACH(EMUNIT_DISPLAY_MULTI_CALL_VA, failed_delta_msg,
+		(p_head, delta, expected, actual, fmt, va_args_copy))
+}
+
+void emunit_display_multi_failed_nstr(
+	const __flash emunit_assert_head_t * p_head,
+	size_t n,
+	const __memx char * str_expected,
+	const __memx char * str_actual,
+	size_t err_pos)
+{
+	EMUNIT_DISPLAY_MULTI_FOREACH(EMUNIT_DISPLAY_MULTI_CALL, failed_nstr,
+		(p_head, n, str_expected, str_actual, err_pos))
+}
+
+void emunit_display_multi_failed_nstr_msg(
+	const __flash emunit_assert_head_t * p_head,
+	size_t n,
+	const __memx char * str_expected,
+	const __memx char * str_actual,
+	size_t err_pos,
+	const __flash char * fmt,
+	va_list va_args)
+{
+	EMUNIT_DISPLAY_MULTI_FOREACH(EMUNIT_DISPLAY_MULTI_CALL_VA, failed_nstr_msg,
+		(p_head, n, str_expected, str_actual, err_pos, fmt, va_args_copy))
+}
+
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+void emunit_display_multi_failed_cycles(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t budget,
+	emunit_timestamp_t measured)
+{
+	EMUNIT_DISPLAY_MULTI_FOREACH(EMUNIT_DISPLAY_MULTI_CALL, failed_cycles,
+		(p_head, budget, measured))
+}
+
+void emunit_display_multi_failed_cycles_msg(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t budget,
+	emunit_timestamp_t measured,
+	const __flash char * fmt,
+	va_list va_args)
+{
+	EMUNIT_DISPLAY_MULTI_FOREACH(EMUNIT_DISPLAY_MULTI_CALL_VA, failed_cycles_msg,
+		(p_head, budget, measured, fmt, va_args_copy))
+}
+
+void emunit_display_multi_failed_regression(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t baseline,
+	emunit_timestamp_t limit,
+	emunit_timestamp_t measured)
+{
+	EMUNIT_DISPLAY_MULTI_FOREACH(EMUNIT_DISPLAY_MULTI_CALL, failed_regression,
+		(p_head, baseline, limit, measured))
+}
+#endif
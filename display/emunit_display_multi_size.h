@@ -0,0 +1,106 @@
+#ifndef EMUNIT_DISPLAY_MULTI_SIZE_H_INCLUDED
+#define EMUNIT_DISPLAY_MULTI_SIZE_H_INCLUDED
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief EMUnit multiple displays worst-case output sizes
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * Every display has to fit its failure report into its own region
+ * of the display buffer.
+ * This file is included by the assertion macros, so it cannot contain
+ * anything but preprocessor definitions.
+ *
+ * @sa emunit_display_multi_size_group
+ */
+#include "config_emunit.h"
+#include "emunit_macros.h"
+
+#include EMUNIT_DISPLAY_FILE_OF(EMUNIT_CONF_DISPLAY_MULTI_0, _size, h)
+#if EMUNIT_CONF_DISPLAY_MULTI > 1
+#include EMUNIT_DISPLAY_FILE_OF(EMUNIT_CONF_DISPLAY_MULTI_1, _size, h)
+#endif
+#if EMUNIT_CONF_DISPLAY_MULTI > 2
+#include EMUNIT_DISPLAY_FILE_OF(EMUNIT_CONF_DISPLAY_MULTI_2, _size, h)
+#endif
+#if EMUNIT_CONF_DISPLAY_MULTI > 3
+#include EMUNIT_DISPLAY_FILE_OF(EMUNIT_CONF_DISPLAY_MULTI_3, _size, h)
+#endif
+
+/**
+ * @defgroup emunit_display_multi_size_group <emunit_display_multi_size> Multiple displays worst-case output sizes
+ * @{
+ * @ingroup emunit_display_multi_group
+ */
+
+/**
+ * @name Worst-case report size of every display
+ *
+ * Unused displays give 0.
+ * @{
+ */
+#define EMUNIT_DISPLAY_MULTI_SIZE_0(func, file_size, text_size, tc_size, msg) \
+	EMUNIT_CN2(EMUNIT_DISPLAY_SIZE_, EMUNIT_CONF_DISPLAY_MULTI_0)(func, file_size, text_size, tc_size, msg)
+#if EMUNIT_CONF_DISPLAY_MULTI > 1
+#define EMUNIT_DISPLAY_MULTI_SIZE_1(func, file_size, text_size, tc_size, msg) \
+	EMUNIT_CN2(EMUNIT_DISPLAY_SIZE_, EMUNIT_CONF_DISPLAY_MULTI_1)(func, file_size, text_size, tc_size, msg)
+#else
+#define EMUNIT_DISPLAY_MULTI_SIZE_1(func, file_size, text_size, tc_size, msg) 0U
+#endif
+#if EMUNIT_CONF_DISPLAY_MULTI > 2
+#define EMUNIT_DISPLAY_MULTI_SIZE_2(func, file_size, text_size, tc_size, msg) \
+	EMUNIT_CN2(EMUNIT_DISPLAY_SIZE_, EMUNIT_CONF_DISPLAY_MULTI_2)(func, file_size, text_size, tc_size, msg)
+#else
+#define EMUNIT_DISPLAY_MULTI_SIZE_2(func, file_size, text_size, tc_size, msg) 0U
+#endif
+#if EMUNIT_CONF_DISPLAY_MULTI > 3
+#define EMUNIT_DISPLAY_MULTI_SIZE_3(func, file_size, text_size, tc_size, msg) \
+	EMUNIT_CN2(EMUNIT_DISPLAY_SIZE_, EMUNIT_CONF_DISPLAY_MULTI_3)(func, file_size, text_size, tc_size, msg)
+#else
+#define EMUNIT_DISPLAY_MULTI_SIZE_3(func, file_size, text_size, tc_size, msg) 0U
+#endif
+/** @} */
+
+/**
+ * @brief Worst-case failure report size
+ *
+ * The largest report of all the displays, with the terminating zero,
+ * multiplied by the number of displays.
+ * This way it can be compared with the whole buffer size.
+ *
+ * @param func      Assertion function name
+ * @param file_size Size of the file name including terminating zero
+ * @param text_size Size of the assertion text including terminating zero
+ * @param tc_size   Size of the test case name including terminating zero
+ * @param msg       1 if the message is present, 0 otherwise
+ */
+#define EMUNIT_DISPLAY_SIZE_multi(func, file_size, text_size, tc_size, msg)   \
+	(EMUNIT_CONF_DISPLAY_MULTI * (EMUNIT_MAX(                                       \
+		EMUNIT_MAX(EMUNIT_DISPLAY_MULTI_SIZE_0(func, file_size, text_size, tc_size, msg), \
+		           EMUNIT_DISPLAY_MULTI_SIZE_1(func, file_size, text_size, tc_size, msg)), \
+		EMUNIT_MAX(EMUNIT_DISPLAY_MULTI_SIZE_2(func, file_size, text_size, tc_size, msg), \
+		           EMUNIT_DISPLAY_MULTI_SIZE_3(func, file_size, text_size, tc_size, msg))) + 1U))
+
+/** @} */
+#endif /* EMUNIT_DISPLAY_MULTI_SIZE_H_INCLUDED */
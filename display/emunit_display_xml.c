@@ -38,6 +38,18 @@
  */
 #define NEWLINE EMUNIT_CONF_DISPLAY_NL
 
+/**
+ * @brief String part used as a single indentation level
+ *
+ * Expands to empty string if indentation is disabled.
+ * @sa EMUNIT_CONF_DISPLAY_TABS
+ */
+#if EMUNIT_CONF_DISPLAY_TABS || defined(__DOXYGEN__)
+#define TAB "\t"
+#else
+#define TAB ""
+#endif
+
 /**
  * @brief String error marker start
  *
@@ -63,6 +75,45 @@ static const __flash char emunit_display_xml_strerr_end[] = "</err>";
  */
 static const __flash char emunit_display_xml_skip_pat[] = "<skip cnt=\"%u\" />";
 
+/**
+ * @brief Buffer warning pattern
+ *
+ * Pattern contains hooks for the number of bytes used
+ * and the total size of the display buffer.
+ */
+static const __flash char emunit_display_xml_buffer_warning_pat[] =
+	TAB TAB TAB "<buffer-warning used=\"%u\" size=\"%u\" />" NEWLINE;
+
+/**
+ * @brief Test case footer
+ */
+static const __flash char emunit_display_xml_tc_footer[] =
+	TAB TAB "</testcase>" NEWLINE;
+
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+/**
+ * @brief Durations pattern
+ *
+ * Pattern contains hooks for the init, test and cleanup durations.
+ * It is preceded by the indentation.
+ */
+static const __flash char emunit_display_xml_time_pat[] =
+	"<time init=\"%"PRIuTIMESTAMP"\" test=\"%"PRIuTIMESTAMP"\" cleanup=\"%"PRIuTIMESTAMP"\""
+	" unit=\"" EMUNIT_TIMESTAMP_UNIT "\" />" NEWLINE;
+
+/**
+ * @brief Benchmark results pattern
+ *
+ * Pattern contains hooks for the iterations, samples and the statistic
+ * of the single operation duration.
+ */
+static const __flash char emunit_display_xml_bench_pat[] =
+	TAB TAB TAB "<bench iterations=\"%"PRIu32"\" samples=\"%u\""
+	" min=\"%"PRIuTIMESTAMP"\" median=\"%"PRIuTIMESTAMP"\""
+	" p90=\"%"PRIuTIMESTAMP"\" p99=\"%"PRIuTIMESTAMP"\""
+	" unit=\"" EMUNIT_TIMESTAMP_UNIT "\" />" NEWLINE;
+#endif
+
 /**
  * @brief Callback that replaces xml special characters by entities
  *
@@ -103,10 +154,65 @@ static void emunit_display_xml_cleanup_entities(char * p_start, size_t len)
  */
 static void emunit_display_xml_tabs(size_t tabs)
 {
+#if EMUNIT_CONF_DISPLAY_TABS
 	while(0 != tabs--)
 	{
 		emunit_display_putc('\t');
 	}
+#else
+	(void)tabs;
+#endif
+}
+
+/**
+ * @brief Display test suite opening element
+ *
+ * Prints the opening tag of the current test suite.
+ */
+static void emunit_display_xml_ts_header(void)
+{
+	emunit_display_printf(
+		NULL,
+		EMUNIT_FLASHSTR(
+			TAB "<testsuite name=\"%"PRIsPGM"\">" NEWLINE
+		),
+		emunit_ts_name_get(emunit_ts_current_index_get())
+	);
+}
+
+/**
+ * @brief Display test case opening element
+ *
+ * Prints the opening tag of the current test case.
+ */
+static void emunit_display_xml_tc_header(void)
+{
+	emunit_display_printf(
+		NULL,
+		EMUNIT_FLASHSTR(TAB TAB "<testcase name=\"%"PRIsPGM"\">" NEWLINE),
+		emunit_tc_name_get(emunit_ts_current_index_get(), emunit_tc_current_index_get())
+	);
+}
+
+/**
+ * @brief Prepare the place for the failure report
+ *
+ * In quiet mode suite and case headers are printed only when failure occurs.
+ * This function prints them before the first failure in the test case.
+ */
+static void emunit_display_xml_failed_open(void)
+{
+#if EMUNIT_CONF_DISPLAY_QUIET
+	if(!emunit_display_status.tc_opened)
+	{
+		if(!emunit_ts_current_failed_get())
+		{
+			emunit_display_xml_ts_header();
+		}
+		emunit_display_xml_tc_header();
+		emunit_display_status.tc_opened = true;
+	}
+#endif
 }
 
 /**
@@ -126,15 +232,16 @@ static void emunit_display_xml_failed_header(
 	const __flash emunit_assert_head_t * p_head,
 	const __flash char * p_str_type)
 {
+	emunit_display_xml_failed_open();
 	emunit_display_printf(
 		NULL,
 		EMUNIT_FLASHSTR(
-			"\t\t\t<failure type=\"%"PRIsPGM"\" id=\"%u\">" NEWLINE
-			"\t\t\t\t<file>%"PRIsPGM"</file>"               NEWLINE
-			"\t\t\t\t<line>%u</line>"                       NEWLINE
+			TAB TAB TAB     "<failure type=\"%"PRIsPGM"\" id=\"%u\">" NEWLINE
+			TAB TAB TAB TAB "<file>%"PRIsPGM"</file>"               NEWLINE
+			TAB TAB TAB TAB "<line>%u</line>"                       NEWLINE
 		),
 		p_str_type,
-		emunit_tc_failed_get() + 1,
+		emunit_display_failure_id(),
 		p_head->p_file,
 		p_head->line
 	);
@@ -153,7 +260,7 @@ static void emunit_display_xml_failed_footer(const __flash emunit_assert_head_t
 	emunit_display_puts(
 		NULL,
 		EMUNIT_FLASHSTR(
-			"\t\t\t</failure>" NEWLINE
+			TAB TAB TAB "</failure>" NEWLINE
 		)
 	);
 }
@@ -199,7 +306,7 @@ static void emunit_display_xml_value(
 {
 	emunit_display_printf(
 		NULL,
-		EMUNIT_FLASHSTR("\t\t\t\t\t<%"PRIsPGM">"),
+		EMUNIT_FLASHSTR(TAB TAB TAB TAB TAB "<%"PRIsPGM">"),
 		p_name
 	);
 
@@ -265,8 +372,8 @@ static void emunit_display_xml_nstr(
 
 	emunit_display_printf(
 		NULL,
-		EMUNIT_FLASHSTR("\t\t\t\t\t<%"PRIsPGM"><length>%u</length>" NEWLINE
-		                "\t\t\t\t\t\t<val>"),
+		EMUNIT_FLASHSTR(TAB TAB TAB TAB TAB "<%"PRIsPGM"><length>%u</length>" NEWLINE
+		                TAB TAB TAB TAB TAB TAB "<val>"),
 		p_name,
 		len
 	);
@@ -330,11 +437,11 @@ static void emunit_display_xml_failed_assert_details(
 	const __flash char * str_expr)
 {
 	(void)p_head;
-	emunit_display_puts(NULL, EMUNIT_FLASHSTR("\t\t\t\t<details>"  NEWLINE));
-	emunit_display_puts(NULL, EMUNIT_FLASHSTR("\t\t\t\t\t<expression>"));
+	emunit_display_puts(NULL, EMUNIT_FLASHSTR(TAB TAB TAB TAB "<details>" NEWLINE));
+	emunit_display_puts(NULL, EMUNIT_FLASHSTR(TAB TAB TAB TAB TAB "<expression>"));
 	emunit_display_puts(emunit_display_xml_cleanup_entities, str_expr);
 	emunit_display_puts(NULL, EMUNIT_FLASHSTR("</expression>"      NEWLINE));
-	emunit_display_puts(NULL, EMUNIT_FLASHSTR("\t\t\t\t</details>" NEWLINE));
+	emunit_display_puts(NULL, EMUNIT_FLASHSTR(TAB TAB TAB TAB "</details>" NEWLINE));
 }
 
 static void emunit_display_xml_failed_equal_details(
@@ -342,10 +449,10 @@ static void emunit_display_xml_failed_equal_details(
 	emunit_num_t expected,
 	emunit_num_t actual)
 {
-	emunit_display_puts(NULL, EMUNIT_FLASHSTR("\t\t\t\t<details>" NEWLINE));
+	emunit_display_puts(NULL, EMUNIT_FLASHSTR(TAB TAB TAB TAB "<details>" NEWLINE));
 	emunit_display_xml_value(p_head->numtype, EMUNIT_FLASHSTR("expected"), expected);
 	emunit_display_xml_value(p_head->numtype, EMUNIT_FLASHSTR("actual"),   actual);
-	emunit_display_puts(NULL, EMUNIT_FLASHSTR("\t\t\t\t</details>" NEWLINE));
+	emunit_display_puts(NULL, EMUNIT_FLASHSTR(TAB TAB TAB TAB "</details>" NEWLINE));
 }
 
 static void emunit_display_xml_failed_range_details(
@@ -354,11 +461,11 @@ static void emunit_display_xml_failed_range_details(
 	emunit_num_t max,
 	emunit_num_t actual)
 {
-	emunit_display_puts(NULL, EMUNIT_FLASHSTR("\t\t\t\t<details>" NEWLINE));
+	emunit_display_puts(NULL, EMUNIT_FLASHSTR(TAB TAB TAB TAB "<details>" NEWLINE));
 	emunit_display_xml_value(p_head->numtype, EMUNIT_FLASHSTR("min"),    min);
 	emunit_display_xml_value(p_head->numtype, EMUNIT_FLASHSTR("max"),    max);
 	emunit_display_xml_value(p_head->numtype, EMUNIT_FLASHSTR("actual"), actual);
-	emunit_display_puts(NULL, EMUNIT_FLASHSTR("\t\t\t\t</details>" NEWLINE));
+	emunit_display_puts(NULL, EMUNIT_FLASHSTR(TAB TAB TAB TAB "</details>" NEWLINE));
 }
 
 static void emunit_display_xml_failed_delta_details(
@@ -373,11 +480,11 @@ static void emunit_display_xml_failed_delta_details(
 		EMUNIT_CN2(EMUNIT_NUMTYPE_X, EMUNIT_CONF_NUMBER_SIZE)
 		:
 		EMUNIT_CN2(EMUNIT_NUMTYPE_U, EMUNIT_CONF_NUMBER_SIZE);
-	emunit_display_puts(NULL, EMUNIT_FLASHSTR("\t\t\t\t<details>" NEWLINE));
+	emunit_display_puts(NULL, EMUNIT_FLASHSTR(TAB TAB TAB TAB "<details>" NEWLINE));
 	emunit_display_xml_value(delta_numtype,   EMUNIT_FLASHSTR("delta"),    (emunit_num_t){.u = delta });
 	emunit_display_xml_value(p_head->numtype, EMUNIT_FLASHSTR("expected"), expected);
 	emunit_display_xml_value(p_head->numtype, EMUNIT_FLASHSTR("actual"),   actual);
-	emunit_display_puts(NULL, EMUNIT_FLASHSTR("\t\t\t\t</details>" NEWLINE));
+	emunit_display_puts(NULL, EMUNIT_FLASHSTR(TAB TAB TAB TAB "</details>" NEWLINE));
 }
 
 static void emunit_display_xml_failed_nstr_details(
@@ -388,10 +495,10 @@ static void emunit_display_xml_failed_nstr_details(
 	size_t err_pos)
 {
 	size_t skip_start = 0;
-	emunit_display_puts(NULL, EMUNIT_FLASHSTR("\t\t\t\t<details>" NEWLINE));
+	emunit_display_puts(NULL, EMUNIT_FLASHSTR(TAB TAB TAB TAB "<details>" NEWLINE));
 	emunit_display_printf(
 		NULL,
-		EMUNIT_FLASHSTR("\t\t\t\t\t<err_idx>%u</err_idx>" NEWLINE),
+		EMUNIT_FLASHSTR(TAB TAB TAB TAB TAB "<err_idx>%u</err_idx>" NEWLINE),
 		err_pos);
 
 	if(err_pos > EMUNIT_CONF_STRLEN_LIMIT)
@@ -403,24 +510,148 @@ static void emunit_display_xml_failed_nstr_details(
 	emunit_display_xml_nstr(EMUNIT_FLASHSTR("actual"),   n, str_actual,   skip_start, err_pos);
 
 
-	emunit_display_puts(NULL, EMUNIT_FLASHSTR("\t\t\t\t</details>" NEWLINE));
+	emunit_display_puts(NULL, EMUNIT_FLASHSTR(TAB TAB TAB TAB "</details>" NEWLINE));
+}
+
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+static void emunit_display_xml_failed_cycles_details(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t budget,
+	emunit_timestamp_t measured)
+{
+	(void)p_head;
+	emunit_display_puts(NULL, EMUNIT_FLASHSTR(TAB TAB TAB TAB "<details>" NEWLINE));
+	emunit_display_printf(
+		NULL,
+		EMUNIT_FLASHSTR(
+			TAB TAB TAB TAB TAB "<budget>%"PRIuTIMESTAMP"</budget>" NEWLINE
+			TAB TAB TAB TAB TAB "<measured>%"PRIuTIMESTAMP"</measured>" NEWLINE
+			TAB TAB TAB TAB TAB "<unit>" EMUNIT_TIMESTAMP_UNIT "</unit>" NEWLINE),
+		budget,
+		measured);
+	emunit_display_puts(NULL, EMUNIT_FLASHSTR(TAB TAB TAB TAB "</details>" NEWLINE));
+}
+
+static void emunit_display_xml_failed_regression_details(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t baseline,
+	emunit_timestamp_t limit,
+	emunit_timestamp_t measured)
+{
+	(void)p_head;
+	emunit_display_puts(NULL, EMUNIT_FLASHSTR(TAB TAB TAB TAB "<details>" NEWLINE));
+	emunit_display_printf(
+		NULL,
+		EMUNIT_FLASHSTR(
+			TAB TAB TAB TAB TAB "<baseline>%"PRIuTIMESTAMP"</baseline>" NEWLINE
+			TAB TAB TAB TAB TAB "<limit>%"PRIuTIMESTAMP"</limit>" NEWLINE
+			TAB TAB TAB TAB TAB "<measured>%"PRIuTIMESTAMP"</measured>" NEWLINE
+			TAB TAB TAB TAB TAB "<unit>" EMUNIT_TIMESTAMP_UNIT "</unit>" NEWLINE),
+		baseline,
+		limit,
+		measured);
+	emunit_display_puts(NULL, EMUNIT_FLASHSTR(TAB TAB TAB TAB "</details>" NEWLINE));
+}
+
+/**
+ * @brief Show the durations
+ *
+ * @param tabs   Number of tabulators before the element
+ * @param p_time Durations to be shown, nothing is shown if NULL
+ */
+static void emunit_display_xml_time(size_t tabs, const emunit_time_t * p_time)
+{
+	if(NULL != p_time)
+	{
+		emunit_display_xml_tabs(tabs);
+		emunit_display_printf(
+			NULL,
+			emunit_display_xml_time_pat,
+			p_time->init,
+			p_time->test,
+			p_time->cleanup
+		);
+	}
 }
 
+/**
+ * @brief Show the current test case durations
+ *
+ * The benchmark results are shown too, if the test case is a benchmark.
+ * In quiet mode the durations are shown only if the test case header is printed.
+ */
+static void emunit_display_xml_tc_time(void)
+{
+	const emunit_bench_t * p_bench;
+#if EMUNIT_CONF_DISPLAY_QUIET
+	if(!emunit_display_status.tc_opened)
+		return;
+#endif
+	emunit_display_xml_time(3, emunit_tc_time_get());
+	p_bench = emunit_tc_bench_get();
+	if(NULL != p_bench)
+	{
+		emunit_display_printf(
+			NULL,
+			emunit_display_xml_bench_pat,
+			p_bench->iterations,
+			(unsigned int)EMUNIT_CONF_BENCH_SAMPLES,
+			p_bench->min,
+			p_bench->median,
+			p_bench->p90,
+			p_bench->p99
+		);
+	}
+}
+#endif
+
+#if EMUNIT_CONF_DISPLAY_BUFFER_STAT || defined(__DOXYGEN__)
+/**
+ * @brief Show the display buffer usage statistic
+ *
+ * Internal function that prints buffer statistic in the test summary.
+ */
+static void emunit_display_xml_buffer_stat(void)
+{
+	const emunit_display_usage_t * p_usage = emunit_display_usage_get();
+	emunit_display_printf(
+		NULL,
+		EMUNIT_FLASHSTR(
+			TAB TAB     "<buffer-stat>"                    NEWLINE
+			TAB TAB TAB "<size>%u</size>"                  NEWLINE
+			TAB TAB TAB "<used-max>%u</used-max>"          NEWLINE
+			TAB TAB TAB "<near-overflow>%u</near-overflow>" NEWLINE
+		),
+		(size_t)EMUNIT_CONF_BUFFER_SIZE,
+		p_usage->used_max,
+		p_usage->tc_n_near_overflow
+	);
+	if(EMUNIT_IDX_INVALID != p_usage->tc_used_max_ts)
+	{
+		emunit_display_printf(
+			NULL,
+			EMUNIT_FLASHSTR(
+				TAB TAB TAB "<testcase-max suite=\"%"PRIsPGM"\" name=\"%"PRIsPGM"\">%u</testcase-max>" NEWLINE
+			),
+			emunit_ts_name_get(p_usage->tc_used_max_ts),
+			emunit_tc_name_get(p_usage->tc_used_max_ts, p_usage->tc_used_max_tc),
+			p_usage->tc_used_max
+		);
+	}
+	emunit_display_puts(NULL, EMUNIT_FLASHSTR(TAB TAB "</buffer-stat>" NEWLINE));
+}
+#endif
+
 void emunit_display_xml_show_panic(
 	const __flash char * str_file,
 	unsigned int line)
 {
-	char str_line[12];
-	ltoa(line, str_line, 10);
-
 	emunit_display_panic_puts(NEWLINE"<panic>"NEWLINE);
-	emunit_display_panic_puts("\t<file>");
+	emunit_display_panic_puts(TAB "<file>");
 	emunit_display_panic_puts(str_file);
 	emunit_display_panic_puts("</file>"NEWLINE);
 
-	emunit_display_panic_puts("\t<line>");
-	emunit_display_panic_puts(str_line);
-	emunit_display_panic_puts("</line>"NEWLINE"</panic>"NEWLINE);
+	emunit_display_panic_printf(TAB "<line>%u</line>"NEWLINE"</panic>"NEWLINE, line);
 }
 
 void emunit_display_xml_test_start(void)
@@ -440,62 +671,105 @@ void emunit_display_xml_test_end(void)
 	emunit_display_printf(
 		NULL,
 		EMUNIT_FLASHSTR(
-			"\t<testsummary>"           NEWLINE
-			"\t\t<testsuite-stat>"      NEWLINE
-			"\t\t\t<total>%u</total>"   NEWLINE
-			"\t\t\t<passed>%u</passed>" NEWLINE
-			"\t\t\t<failed>%u</failed>" NEWLINE
-			"\t\t</testsuite-stat>"     NEWLINE
-			"\t\t<testcase-stat>"       NEWLINE
-			"\t\t\t<total>%u</total>"   NEWLINE
-			"\t\t\t<passed>%u</passed>" NEWLINE
-			"\t\t\t<failed>%u</failed>" NEWLINE
-			"\t\t</testcase-stat>"      NEWLINE
-			"\t</testsummary>"          NEWLINE
-			"</test>"                   NEWLINE
+			TAB         "<testsummary>"      NEWLINE
+			TAB TAB     "<testsuite-stat>"   NEWLINE
+			TAB TAB TAB "<total>%u</total>"   NEWLINE
+			TAB TAB TAB "<passed>%u</passed>" NEWLINE
+			TAB TAB TAB "<failed>%u</failed>" NEWLINE
+			TAB TAB     "</testsuite-stat>"  NEWLINE
+			TAB TAB     "<testcase-stat>"    NEWLINE
+			TAB TAB TAB "<total>%u</total>"   NEWLINE
+			TAB TAB TAB "<passed>%u</passed>" NEWLINE
+			TAB TAB TAB "<failed>%u</failed>" NEWLINE
+			TAB TAB     "</testcase-stat>"   NEWLINE
 		),
-		emunit_ts_total_count(),
+		emunit_ts_selected_count(),
 		emunit_ts_passed_get(),
 		emunit_ts_failed_get(),
-		emunit_tc_total_count(),
+		emunit_tc_selected_count(),
 		emunit_tc_passed_get(),
 		emunit_tc_failed_get()
 	);
+#if EMUNIT_CONF_DISPLAY_BUFFER_STAT
+	emunit_display_xml_buffer_stat();
+#endif
+	emunit_display_puts(
+		NULL,
+		EMUNIT_FLASHSTR(
+			TAB         "</testsummary>"     NEWLINE
+			            "</test>"            NEWLINE
+		)
+	);
 }
 
 void emunit_display_xml_ts_start(void)
 {
-	emunit_display_printf(
-		NULL,
-		EMUNIT_FLASHSTR(
-			"\t<testsuite name=\"%"PRIsPGM"\">" NEWLINE
-		),
-		emunit_ts_name_get(emunit_ts_current_index_get())
-	);
+#if !EMUNIT_CONF_DISPLAY_QUIET
+	emunit_display_xml_ts_header();
+#endif
 }
 
 void emunit_display_xml_ts_end(void)
 {
+#if EMUNIT_CONF_DISPLAY_QUIET
+	if(!emunit_ts_current_failed_get())
+		return;
+#endif
+#if EMUNIT_CONF_TIMING
+	emunit_display_xml_time(2, emunit_ts_time_get());
+#endif
 	emunit_display_puts(
 		NULL,
-		EMUNIT_FLASHSTR("\t</testsuite>" NEWLINE)
+		EMUNIT_FLASHSTR(TAB "</testsuite>" NEWLINE)
 	);
 }
 
 void emunit_display_xml_tc_start(void)
 {
-	emunit_display_printf(
-		NULL,
-		EMUNIT_FLASHSTR("\t\t<testcase name=\"%"PRIsPGM"\">" NEWLINE),
-		emunit_tc_name_get(emunit_ts_current_index_get(), emunit_tc_current_index_get())
-	);
+#if EMUNIT_CONF_DISPLAY_QUIET
+	emunit_display_status.tc_opened = false;
+#else
+	emunit_display_xml_tc_header();
+#endif
 }
 
 void emunit_display_xml_tc_end(void)
 {
-	emunit_display_puts(
+#if EMUNIT_CONF_TIMING
+	/* The durations are counted in the test case buffer usage */
+	emunit_display_xml_tc_time();
+#endif
+	const size_t used = emunit_display_used_size();
+	const bool near_overflow = emunit_display_tc_usage_register();
+#if EMUNIT_CONF_DISPLAY_QUIET
+	if(!emunit_display_status.tc_opened)
+		return;
+#endif
+	/* Show the warning only if there is still a place for it */
+	if(near_overflow && (emunit_display_max_size() >
+		sizeof(emunit_display_xml_buffer_warning_pat) + 2 * 10 +
+		sizeof(emunit_display_xml_tc_footer)))
+	{
+		emunit_display_printf(
+			NULL,
+			emunit_display_xml_buffer_warning_pat,
+			used,
+			(size_t)EMUNIT_CONF_BUFFER_SIZE
+		);
+	}
+	emunit_display_puts(NULL, emunit_display_xml_tc_footer);
+}
+
+void emunit_display_xml_failed_timeout(void)
+{
+	emunit_display_xml_failed_open();
+	emunit_display_printf(
 		NULL,
-		EMUNIT_FLASHSTR("\t\t</testcase>" NEWLINE)
+		EMUNIT_FLASHSTR(
+			TAB TAB TAB "<failure type=\"TIMEOUT\" id=\"%u\">" NEWLINE
+			TAB TAB TAB "</failure>"                             NEWLINE
+		),
+		emunit_display_failure_id()
 	);
 }
 
@@ -619,3 +893,39 @@ void emunit_display_xml_failed_nstr_msg(
 	emunit_display_xml_failed_nstr_details(p_head, n, str_expected, str_actual, err_pos);
 	emunit_display_xml_failed_footer(p_head);
 }
+
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+void emunit_display_xml_failed_cycles(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t budget,
+	emunit_timestamp_t measured)
+{
+	emunit_display_xml_failed_header(p_head, EMUNIT_FLASHSTR("CYCLES"));
+	emunit_display_xml_failed_cycles_details(p_head, budget, measured);
+	emunit_display_xml_failed_footer(p_head);
+}
+
+void emunit_display_xml_failed_cycles_msg(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t budget,
+	emunit_timestamp_t measured,
+	const __flash char * fmt,
+	va_list va_args)
+{
+	emunit_display_xml_failed_header(p_head, EMUNIT_FLASHSTR("CYCLES"));
+	emunit_display_xml_msg(4, fmt, va_args);
+	emunit_display_xml_failed_cycles_details(p_head, budget, measured);
+	emunit_display_xml_failed_footer(p_head);
+}
+
+void emunit_display_xml_failed_regression(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t baseline,
+	emunit_timestamp_t limit,
+	emunit_timestamp_t measured)
+{
+	emunit_display_xml_failed_header(p_head, EMUNIT_FLASHSTR("REGRESSION"));
+	emunit_display_xml_failed_regression_details(p_head, baseline, limit, measured);
+	emunit_display_xml_failed_footer(p_head);
+}
+#endif
@@ -65,6 +65,9 @@ void emunit_display_xml_tc_start(void);
 /** See @ref emunit_display_tc_end */
 void emunit_display_xml_tc_end(void);
 
+/** See @ref emunit_display_failed_timeout */
+void emunit_display_xml_failed_timeout(void);
+
 
 /** See @ref emunit_display_failed_assert documentation */
 void emunit_display_xml_failed_assert(
@@ -142,5 +145,28 @@ void emunit_display_xml_failed_nstr_msg(
 	const __flash char * fmt,
 	va_list va_args);
 
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+/** See @ref emunit_display_failed_cycles documentation */
+void emunit_display_xml_failed_cycles(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t budget,
+	emunit_timestamp_t measured);
+
+/** See @ref emunit_display_failed_cycles_msg documentation */
+void emunit_display_xml_failed_cycles_msg(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t budget,
+	emunit_timestamp_t measured,
+	const __flash char * fmt,
+	va_list va_args);
+
+/** See @ref emunit_display_failed_regression documentation */
+void emunit_display_xml_failed_regression(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t baseline,
+	emunit_timestamp_t limit,
+	emunit_timestamp_t measured);
+#endif
+
 /** @} */
 #endif /* EMUNIT_DISPLAY_XML_H_INCLUDED */
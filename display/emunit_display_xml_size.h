@@ -0,0 +1,230 @@
+#ifndef EMUNIT_DISPLAY_XML_SIZE_H_INCLUDED
+#define EMUNIT_DISPLAY_XML_SIZE_H_INCLUDED
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief EMUnit XML presentation module worst-case output sizes
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * Constant expressions that gives the maximum number of bytes
+ * placed in the display buffer by the assertion failure report.
+ * This file is included by the assertion macros, so it cannot contain
+ * anything but preprocessor definitions.
+ *
+ * @sa emunit_display_xml_size_group
+ */
+#include "config_emunit.h"
+#include "emunit_macros.h"
+
+/**
+ * @defgroup emunit_display_xml_size_group <emunit_display_xml_size> XML worst-case output sizes
+ * @{
+ * @ingroup emunit_display_xml_group
+ */
+
+/**
+ * @name Basic elements sizes
+ * @{
+ */
+/** Size of the string literal without terminating zero */
+#define EMUNIT_DISPLAY_XML_SIZE_LIT(s) (sizeof(s) - 1U)
+/** Size of @c n indentation levels */
+#define EMUNIT_DISPLAY_XML_SIZE_TABS(n) ((n) * (EMUNIT_CONF_DISPLAY_TABS ? 1U : 0U))
+/** Size of the newline */
+#define EMUNIT_DISPLAY_XML_SIZE_NL EMUNIT_DISPLAY_XML_SIZE_LIT(EMUNIT_CONF_DISPLAY_NL)
+/** Maximum size of unsigned value printed by @c \%u */
+#define EMUNIT_DISPLAY_XML_SIZE_UINT ((sizeof(unsigned int) > 2U) ? 10U : 5U)
+/** Maximum size of the number printed in assertion details */
+#define EMUNIT_DISPLAY_XML_SIZE_NUM                \
+	((EMUNIT_CONF_NUMBER_SIZE > 32) ? 20U :        \
+	((EMUNIT_CONF_NUMBER_SIZE > 16) ? 11U : 6U))
+/** Maximum size of the value name used in assertion details */
+#define EMUNIT_DISPLAY_XML_SIZE_NAME EMUNIT_DISPLAY_XML_SIZE_LIT("expected")
+/** Maximum size of the assertion type name */
+#define EMUNIT_DISPLAY_XML_SIZE_TYPE EMUNIT_DISPLAY_XML_SIZE_LIT("ASSERT")
+/** Maximum size of single character after entity replacement */
+#define EMUNIT_DISPLAY_XML_SIZE_ENTITY EMUNIT_DISPLAY_XML_SIZE_LIT("&amp;")
+/** @} */
+
+/**
+ * @name Failure report parts
+ * @{
+ */
+/**
+ * @brief Failure header size
+ *
+ * @param file_size Size of the file name including terminating zero
+ */
+#define EMUNIT_DISPLAY_XML_SIZE_HEADER(file_size)                                     \
+	(EMUNIT_DISPLAY_XML_SIZE_TABS(3) + EMUNIT_DISPLAY_XML_SIZE_LIT("<failure type=\"\" id=\"\">") + \
+	 EMUNIT_DISPLAY_XML_SIZE_TYPE + EMUNIT_DISPLAY_XML_SIZE_UINT + EMUNIT_DISPLAY_XML_SIZE_NL + \
+	 EMUNIT_DISPLAY_XML_SIZE_TABS(4) + EMUNIT_DISPLAY_XML_SIZE_LIT("<file></file>") +        \
+	 ((file_size) - 1U) + EMUNIT_DISPLAY_XML_SIZE_NL +                                     \
+	 EMUNIT_DISPLAY_XML_SIZE_TABS(4) + EMUNIT_DISPLAY_XML_SIZE_LIT("<line></line>") +        \
+	 EMUNIT_DISPLAY_XML_SIZE_UINT + EMUNIT_DISPLAY_XML_SIZE_NL)
+
+/**
+ * @brief Test case durations element size
+ *
+ * The timestamp type is not known here, 64 bit values are assumed.
+ */
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+#define EMUNIT_DISPLAY_XML_SIZE_TIME                                                 \
+	(EMUNIT_DISPLAY_XML_SIZE_TABS(3) +                                                    \
+	 EMUNIT_DISPLAY_XML_SIZE_LIT("<time init=\"\" test=\"\" cleanup=\"\" unit=\"cycles\" />") + \
+	 3U * 20U + EMUNIT_DISPLAY_XML_SIZE_NL)
+#else
+#define EMUNIT_DISPLAY_XML_SIZE_TIME 0U
+#endif
+
+/**
+ * @brief Test case opening element size
+ *
+ * The element is already in the buffer when the failure is reported.
+ * In quiet mode it is printed with the failure,
+ * together with the suite opening element, whose name is not known here.
+ *
+ * @param tc_size Size of the test case name including terminating zero
+ */
+#define EMUNIT_DISPLAY_XML_SIZE_TC_HEADER(tc_size)                                   \
+	(EMUNIT_DISPLAY_XML_SIZE_TABS(2) + EMUNIT_DISPLAY_XML_SIZE_LIT("<testcase name=\"\">") + \
+	 ((tc_size) - 1U) + EMUNIT_DISPLAY_XML_SIZE_NL +                                 \
+	 (EMUNIT_CONF_DISPLAY_QUIET ?                                                         \
+	  (EMUNIT_DISPLAY_XML_SIZE_TABS(1) + EMUNIT_DISPLAY_XML_SIZE_LIT("<testsuite name=\"\">") + \
+	   EMUNIT_DISPLAY_XML_SIZE_NL) : 0U))
+
+/** Failure footer size, including the test case end */
+#define EMUNIT_DISPLAY_XML_SIZE_FOOTER                                               \
+	(EMUNIT_DISPLAY_XML_SIZE_TABS(3) + EMUNIT_DISPLAY_XML_SIZE_LIT("</failure>") +          \
+	 EMUNIT_DISPLAY_XML_SIZE_NL + EMUNIT_DISPLAY_XML_SIZE_TIME +                           \
+	 EMUNIT_DISPLAY_XML_SIZE_TABS(2) + EMUNIT_DISPLAY_XML_SIZE_LIT("</testcase>") +         \
+	 EMUNIT_DISPLAY_XML_SIZE_NL)
+
+/** Message element size without the message itself */
+#define EMUNIT_DISPLAY_XML_SIZE_MSG                                                  \
+	(EMUNIT_DISPLAY_XML_SIZE_TABS(4) + EMUNIT_DISPLAY_XML_SIZE_LIT("<msg></msg>") +        \
+	 EMUNIT_DISPLAY_XML_SIZE_NL)
+
+/** Details element size without its contents */
+#define EMUNIT_DISPLAY_XML_SIZE_DETAILS                                              \
+	(2U * EMUNIT_DISPLAY_XML_SIZE_TABS(4) +                                               \
+	 EMUNIT_DISPLAY_XML_SIZE_LIT("<details></details>") + 2U * EMUNIT_DISPLAY_XML_SIZE_NL)
+
+/**
+ * @brief Expression element size
+ *
+ * Every character of the expression may be replaced by the entity.
+ *
+ * @param text_size Size of the expression including terminating zero
+ */
+#define EMUNIT_DISPLAY_XML_SIZE_EXPR(text_size)                                      \
+	(EMUNIT_DISPLAY_XML_SIZE_TABS(5) + EMUNIT_DISPLAY_XML_SIZE_LIT("<expression></expression>") + \
+	 ((text_size) - 1U) * EMUNIT_DISPLAY_XML_SIZE_ENTITY + EMUNIT_DISPLAY_XML_SIZE_NL)
+
+/** Single value element size */
+#define EMUNIT_DISPLAY_XML_SIZE_VALUE                                                \
+	(EMUNIT_DISPLAY_XML_SIZE_TABS(5) + EMUNIT_DISPLAY_XML_SIZE_LIT("<></>") +              \
+	 2U * EMUNIT_DISPLAY_XML_SIZE_NAME + EMUNIT_DISPLAY_XML_SIZE_NUM +                    \
+	 EMUNIT_DISPLAY_XML_SIZE_NL)
+
+/** Single string element size */
+#define EMUNIT_DISPLAY_XML_SIZE_NSTR                                                 \
+	(EMUNIT_DISPLAY_XML_SIZE_TABS(5) + EMUNIT_DISPLAY_XML_SIZE_LIT("<><length></length>") + \
+	 EMUNIT_DISPLAY_XML_SIZE_NAME + EMUNIT_DISPLAY_XML_SIZE_UINT + EMUNIT_DISPLAY_XML_SIZE_NL + \
+	 EMUNIT_DISPLAY_XML_SIZE_TABS(6) + EMUNIT_DISPLAY_XML_SIZE_LIT("<val><err></err></val></>") + \
+	 EMUNIT_DISPLAY_XML_SIZE_NAME + EMUNIT_DISPLAY_XML_SIZE_NL +                          \
+	 2U * (EMUNIT_DISPLAY_XML_SIZE_LIT("<skip cnt=\"\" />") + EMUNIT_DISPLAY_XML_SIZE_UINT) + \
+	 EMUNIT_CONF_STRLEN_LIMIT * EMUNIT_DISPLAY_XML_SIZE_ENTITY)
+
+/** String error index element size */
+#define EMUNIT_DISPLAY_XML_SIZE_ERR_IDX                                              \
+	(EMUNIT_DISPLAY_XML_SIZE_TABS(5) + EMUNIT_DISPLAY_XML_SIZE_LIT("<err_idx></err_idx>") + \
+	 EMUNIT_DISPLAY_XML_SIZE_UINT + EMUNIT_DISPLAY_XML_SIZE_NL)
+
+/**
+ * @brief Cycle budget details size
+ *
+ * Budget, measured and unit elements.
+ * 64 bit timestamp values are assumed.
+ */
+#define EMUNIT_DISPLAY_XML_SIZE_CYCLES                                                  \
+	(3U * EMUNIT_DISPLAY_XML_SIZE_TABS(5) + 3U * EMUNIT_DISPLAY_XML_SIZE_NL +           \
+	 EMUNIT_DISPLAY_XML_SIZE_LIT("<budget></budget><measured></measured>") + 2U * 20U + \
+	 EMUNIT_DISPLAY_XML_SIZE_LIT("<unit>cycles</unit>"))
+/** @} */
+
+/**
+ * @name Worst-case report size for every assertion function
+ *
+ * The assertion expression is counted by its literal size.
+ * The texts that are known only at runtime are not counted:
+ * the message and the suite name.
+ * @{
+ */
+#define EMUNIT_DISPLAY_XML_SIZE_ut_assert(file_size, text_size)                      \
+	(EMUNIT_DISPLAY_XML_SIZE_HEADER(file_size) + EMUNIT_DISPLAY_XML_SIZE_DETAILS +         \
+	 EMUNIT_DISPLAY_XML_SIZE_EXPR(text_size) + EMUNIT_DISPLAY_XML_SIZE_FOOTER)
+
+#define EMUNIT_DISPLAY_XML_SIZE_ut_assert_equal(file_size, text_size)                \
+	(EMUNIT_DISPLAY_XML_SIZE_HEADER(file_size) + EMUNIT_DISPLAY_XML_SIZE_DETAILS +         \
+	 2U * EMUNIT_DISPLAY_XML_SIZE_VALUE + EMUNIT_DISPLAY_XML_SIZE_FOOTER)
+
+#define EMUNIT_DISPLAY_XML_SIZE_ut_assert_range(file_size, text_size)                \
+	(EMUNIT_DISPLAY_XML_SIZE_HEADER(file_size) + EMUNIT_DISPLAY_XML_SIZE_DETAILS +         \
+	 3U * EMUNIT_DISPLAY_XML_SIZE_VALUE + EMUNIT_DISPLAY_XML_SIZE_FOOTER)
+
+#define EMUNIT_DISPLAY_XML_SIZE_ut_assert_delta(file_size, text_size)                \
+	(EMUNIT_DISPLAY_XML_SIZE_HEADER(file_size) + EMUNIT_DISPLAY_XML_SIZE_DETAILS +         \
+	 3U * EMUNIT_DISPLAY_XML_SIZE_VALUE + EMUNIT_DISPLAY_XML_SIZE_FOOTER)
+
+#define EMUNIT_DISPLAY_XML_SIZE_ut_assert_nstr(file_size, text_size)                 \
+	(EMUNIT_DISPLAY_XML_SIZE_HEADER(file_size) + EMUNIT_DISPLAY_XML_SIZE_DETAILS +         \
+	 EMUNIT_DISPLAY_XML_SIZE_ERR_IDX + 2U * EMUNIT_DISPLAY_XML_SIZE_NSTR +                \
+	 EMUNIT_DISPLAY_XML_SIZE_FOOTER)
+
+#define EMUNIT_DISPLAY_XML_SIZE_ut_assert_cycles_max(file_size, text_size)           \
+	(EMUNIT_DISPLAY_XML_SIZE_HEADER(file_size) + EMUNIT_DISPLAY_XML_SIZE_DETAILS +         \
+	 EMUNIT_DISPLAY_XML_SIZE_CYCLES + EMUNIT_DISPLAY_XML_SIZE_FOOTER)
+/** @} */
+
+/**
+ * @brief Worst-case failure report size
+ *
+ * The generic interface used by the assertion macros.
+ * The display name is added to the macro name,
+ * so the sizes of multiple displays may be compared.
+ *
+ * @param func      Assertion function name
+ * @param file_size Size of the file name including terminating zero
+ * @param text_size Size of the assertion text including terminating zero
+ * @param tc_size   Size of the test case name including terminating zero
+ * @param msg       1 if the message element is present, 0 otherwise
+ */
+#define EMUNIT_DISPLAY_SIZE_xml(func, file_size, text_size, tc_size, msg)            \
+	(EMUNIT_DISPLAY_XML_SIZE_TC_HEADER(tc_size) +                                    \
+	 EMUNIT_CN2(EMUNIT_DISPLAY_XML_SIZE_, func)(file_size, text_size) +              \
+	 ((msg) ? EMUNIT_DISPLAY_XML_SIZE_MSG : 0U))
+
+/** @} */
+#endif /* EMUNIT_DISPLAY_XML_SIZE_H_INCLUDED */
@@ -104,6 +104,29 @@ static inline bool emunit_tc_eol_check(const __flash emunit_test_desc_t * p_tc)
 	return (NULL == p_tc->p_fnc);
 }
 
+/**
+ * @brief Check if the test case is counted in the results
+ *
+ * Benchmarks without the budget are not counted as passed or failed.
+ * The benchmark compared with its baseline is counted only when it runs,
+ * see @ref emunit_tc_current_counted_check.
+ *
+ * @param[in] p_tc test case descriptor pointer
+ *
+ * @retval true  Normal test case or benchmark with budget
+ * @retval false Benchmark without budget
+ */
+static inline bool emunit_tc_counted_check(const __flash emunit_test_desc_t * p_tc)
+{
+#if EMUNIT_CONF_TIMING
+	return (NULL == p_tc->p_bench) ||
+		(EMUNIT_BENCH_BUDGET_NONE != p_tc->p_bench->budget);
+#else
+	(void)p_tc;
+	return true;
+#endif
+}
+
 
 /**
  * @brief Get selected test case
@@ -129,6 +152,26 @@ const __flash emunit_test_desc_t * emunit_tc_current_get(void)
 	return emunit_tc_get(emunit_ts_current_index_get(), emunit_tc_current_index_get());
 }
 
+/**
+ * @brief Check if the current test case is counted in the results
+ *
+ * The benchmark without the budget is counted
+ * if the port has given its baseline.
+ *
+ * @retval true  The current test case is counted
+ * @retval false Benchmark without budget and baseline
+ */
+static inline bool emunit_tc_current_counted_check(void)
+{
+#if EMUNIT_CONF_TIMING
+	if(emunit_status.tc_bench_compared)
+	{
+		return true;
+	}
+#endif
+	return emunit_tc_counted_check(emunit_tc_current_get());
+}
+
 /**
  * @brief Prepare next test suite
  *
@@ -251,6 +294,325 @@ static void emunit_current_cleanup_run(void)
 	emunit_ts_special_run(emunit_status.ts_n_current, EMUNIT_TS_IDX_CLEANUP);
 }
 
+/**
+ * @name Test case timing
+ *
+ * Functions that measure the durations of the test case parts.
+ * They do nothing if @ref EMUNIT_CONF_TIMING is not set.
+ * @{
+ */
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+EMUNIT_ARCH_TIMESTAMP_VARIABLES()
+
+/**
+ * @brief Duration of the currently measured part
+ *
+ * NULL if nothing is measured.
+ * It does not have to be retained between restarts -
+ * the measurement after the reset is not valid anyway.
+ */
+static emunit_timestamp_t * emunit_time_p_part;
+
+/**
+ * @brief Finish the current part and start the next one
+ *
+ * @param p_next The duration of the next part or NULL to stop the measurement
+ */
+static void emunit_time_switch(emunit_timestamp_t * p_next)
+{
+	const emunit_timestamp_t now = emunit_arch_timestamp();
+	if(NULL != emunit_time_p_part)
+	{
+		*emunit_time_p_part += now - emunit_status.time_start;
+	}
+	emunit_status.time_start = now;
+	emunit_time_p_part = p_next;
+}
+#endif
+
+/**
+ * @brief Clear the suite durations
+ *
+ * Called when the suite starts.
+ */
+static inline void emunit_time_ts_begin(void)
+{
+#if EMUNIT_CONF_TIMING
+	memset(&emunit_status.ts_time, 0, sizeof(emunit_status.ts_time));
+#endif
+}
+
+/**
+ * @brief Start the test case measurement
+ *
+ * The test initialisation is measured from now.
+ */
+static inline void emunit_time_tc_begin(void)
+{
+#if EMUNIT_CONF_TIMING
+	memset(&emunit_status.tc_time, 0, sizeof(emunit_status.tc_time));
+	emunit_status.tc_time_valid = true;
+	emunit_status.tc_bench_valid = false;
+	emunit_status.tc_bench_compared = false;
+	emunit_time_switch(&emunit_status.tc_time.init);
+#endif
+}
+
+/**
+ * @brief Start measuring the test function
+ */
+static inline void emunit_time_test_begin(void)
+{
+#if EMUNIT_CONF_TIMING
+	emunit_time_switch(&emunit_status.tc_time.test);
+#endif
+}
+
+/**
+ * @brief Start measuring the test cleanup
+ *
+ * If the assertion fails, the time till now is added to the part
+ * where it has failed.
+ */
+static inline void emunit_time_cleanup_begin(void)
+{
+#if EMUNIT_CONF_TIMING
+	if(NULL != emunit_time_p_part)
+	{
+		emunit_time_switch(&emunit_status.tc_time.cleanup);
+	}
+#endif
+}
+
+/**
+ * @brief Finish the test case measurement
+ *
+ * The test case durations are added to the suite durations.
+ * If nothing is measured in this run (test case interrupted by the reset
+ * or failure outside of the test case) the durations are marked invalid.
+ */
+static inline void emunit_time_tc_end(void)
+{
+#if EMUNIT_CONF_TIMING
+	if(NULL == emunit_time_p_part)
+	{
+		emunit_status.tc_time_valid = false;
+	}
+	else
+	{
+		emunit_time_switch(NULL);
+		emunit_status.ts_time.init    += emunit_status.tc_time.init;
+		emunit_status.ts_time.test    += emunit_status.tc_time.test;
+		emunit_status.ts_time.cleanup += emunit_status.tc_time.cleanup;
+	}
+#endif
+}
+
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+/**
+ * @brief Number of empty measurements used for the overhead calibration
+ *
+ * The shortest one is taken as the overhead.
+ */
+#define EMUNIT_CYCLES_CALIBRATION_CNT 8U
+
+/** The start of the current cycle measurement */
+static emunit_timestamp_t emunit_cycles_start;
+/** Measurement overhead subtracted from every result */
+static emunit_timestamp_t emunit_cycles_overhead;
+/**
+ * @brief Overhead calibrated flag
+ *
+ * Cleared at every start, so the calibration is repeated after the restart.
+ */
+static bool emunit_cycles_calibrated;
+
+/**
+ * @brief Calibrate the measurement overhead
+ *
+ * Measures empty statement using the same functions that are used by the
+ * assertions, so the cost of the calls and of the timestamp reading itself
+ * is included.
+ */
+static void emunit_cycles_calibrate(void)
+{
+	emunit_timestamp_t overhead = (emunit_timestamp_t)~(emunit_timestamp_t)0;
+	uint_fast8_t n;
+
+	emunit_cycles_calibrated = true;
+	emunit_cycles_overhead = 0;
+	for(n = 0; n < EMUNIT_CYCLES_CALIBRATION_CNT; ++n)
+	{
+		emunit_timestamp_t measured;
+		emunit_cycles_begin();
+		measured = emunit_cycles_end();
+		if(measured < overhead)
+		{
+			overhead = measured;
+		}
+	}
+	emunit_cycles_overhead = overhead;
+}
+
+/**
+ * @brief Maximum number of the benchmark function calls in a single sample
+ */
+#define EMUNIT_BENCH_ITERATIONS_MAX (1UL << 24)
+
+/**
+ * @brief Index of the percentile in the sorted samples
+ *
+ * Nearest rank method.
+ *
+ * @param p Percentile
+ */
+#define EMUNIT_BENCH_RANK(p) \
+	((((p) * (EMUNIT_CONF_BENCH_SAMPLES)) + 99U) / 100U - 1U)
+
+#if EMUNIT_CONF_BENCH_SAMPLES < 1
+#error "EMUNIT_CONF_BENCH_SAMPLES has to be at least 1"
+#endif
+
+#if EMUNIT_CONF_BENCH_BASELINE || defined(__DOXYGEN__)
+/**
+ * @brief Check the benchmark against its baseline
+ *
+ * The median may exceed the baseline median by
+ * @ref EMUNIT_CONF_BENCH_THRESHOLD percent or
+ * @ref EMUNIT_CONF_BENCH_NOISE baseline spreads, whichever is larger.
+ * The regression is reported as a failure in the line of the benchmark entry.
+ * Nothing is checked if the port has no baseline for the benchmark.
+ * The benchmark without the budget that has the baseline
+ * is counted as a normal test case.
+ *
+ * @param p_bench The benchmark descriptor
+ */
+static void emunit_bench_baseline_check(const __flash emunit_bench_desc_t * p_bench)
+{
+	emunit_bench_t baseline;
+	emunit_timestamp_t margin;
+	emunit_timestamp_t noise;
+	emunit_timestamp_t limit;
+
+	if(!emunit_port_bench_baseline(&baseline))
+	{
+		return;
+	}
+	if(EMUNIT_BENCH_BUDGET_NONE == p_bench->budget)
+	{
+		emunit_status.tc_bench_compared = true;
+		++(emunit_status.tc_n_compared);
+	}
+	/* Divide first to avoid the overflow of the 32 bit timestamp */
+	margin = (baseline.median / 100U) * (EMUNIT_CONF_BENCH_THRESHOLD) +
+		((baseline.median % 100U) * (EMUNIT_CONF_BENCH_THRESHOLD)) / 100U;
+	noise = (baseline.p90 > baseline.median) ?
+		(baseline.p90 - baseline.median) * (EMUNIT_CONF_BENCH_NOISE) : 0U;
+	limit = baseline.median + EMUNIT_MAX(margin, noise);
+	if(limit < baseline.median)
+	{
+		/* Overflow - nothing can regress */
+		return;
+	}
+	if(emunit_status.tc_bench.median > limit)
+	{
+		emunit_display_failed_regression(
+			p_bench->p_head,
+			baseline.median,
+			limit,
+			emunit_status.tc_bench.median);
+		emunit_assert_failed();
+	}
+}
+#endif
+
+/**
+ * @brief Measure single benchmark sample
+ *
+ * @param fnc        Benchmarked function
+ * @param iterations Number of the function calls
+ *
+ * @return Duration of all the calls
+ */
+static emunit_timestamp_t emunit_bench_sample(emunit_test_fnc fnc, uint32_t iterations)
+{
+	emunit_cycles_begin();
+	do
+	{
+		fnc();
+	}while(0U != --iterations);
+	return emunit_cycles_end();
+}
+
+/**
+ * @brief Run the benchmark
+ *
+ * Calibrates the number of calls, measures all the samples and stores
+ * the statistic in the status.
+ * Then the median is checked against the budget, if it is given,
+ * and against the baseline.
+ *
+ * @param p_tc The benchmark descriptor
+ */
+static void emunit_bench_run(const __flash emunit_test_desc_t * p_tc)
+{
+	emunit_timestamp_t samples[EMUNIT_CONF_BENCH_SAMPLES];
+	const __flash emunit_bench_desc_t * p_bench = p_tc->p_bench;
+	const emunit_test_fnc fnc = p_tc->p_fnc;
+	uint32_t iterations = 1;
+	size_t n;
+
+	while((emunit_bench_sample(fnc, iterations) < (emunit_timestamp_t)(EMUNIT_CONF_BENCH_TARGET)) &&
+		(iterations < EMUNIT_BENCH_ITERATIONS_MAX))
+	{
+		iterations *= 2U;
+	}
+	for(n = 0; n < EMUNIT_CONF_BENCH_SAMPLES; ++n)
+	{
+		const emunit_timestamp_t op = emunit_bench_sample(fnc, iterations) / iterations;
+		size_t i = n;
+		/* Insertion sort */
+		while((i > 0U) && (samples[i - 1U] > op))
+		{
+			samples[i] = samples[i - 1U];
+			--i;
+		}
+		samples[i] = op;
+	}
+
+	emunit_status.tc_bench.iterations = iterations;
+	emunit_status.tc_bench.min    = samples[0];
+	emunit_status.tc_bench.median = samples[EMUNIT_BENCH_RANK(50U)];
+	emunit_status.tc_bench.p90    = samples[EMUNIT_BENCH_RANK(90U)];
+	emunit_status.tc_bench.p99    = samples[EMUNIT_BENCH_RANK(99U)];
+	emunit_status.tc_bench_valid  = true;
+
+	if(EMUNIT_BENCH_BUDGET_NONE != p_bench->budget)
+	{
+		ut_assert_cycles_max(p_bench->p_head, p_bench->budget, emunit_status.tc_bench.median);
+	}
+#if EMUNIT_CONF_BENCH_BASELINE
+	emunit_bench_baseline_check(p_bench);
+#endif
+}
+#endif
+/** @} */
+
+/**
+ * @brief Finish the current test case and switch to the next one
+ *
+ * The result of the test case has to be counted already
+ * and the cleanup has to be run.
+ */
+static void emunit_tc_finish(void) __attribute__ ((noreturn));
+static void emunit_tc_finish(void)
+{
+	emunit_time_tc_end();
+	emunit_port_tc_end();
+	emunit_display_tc_end();
+	emunit_restart(EMUNIT_RR_RUNNEXT);
+}
+
 /**
  * @name Condition checks
  *
@@ -369,6 +731,23 @@ static void emunit_current_cleanup_run(void)
 		return result;
 	}
 
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+	/**
+	 * @brief Check if the measured duration fits in the budget
+	 *
+	 * @param budget   Maximum duration allowed
+	 * @param measured Measured duration
+	 * @retval true  Duration fits in the budget
+	 * @retval false Budget exceeded
+	 */
+	static bool ut_assert_cycles_max_check(
+		const emunit_timestamp_t budget,
+		const emunit_timestamp_t measured)
+	{
+		return (measured <= budget);
+	}
+#endif
+
 /** @} */
 
 /** @} */
@@ -379,6 +758,9 @@ static void emunit_current_cleanup_run(void)
 void emunit_early_init(void)
 {
 	emunit_port_early_init(&emunit_status.key_valid);
+#if EMUNIT_CONF_TIMING
+	emunit_arch_timestamp_init();
+#endif
 	if(EMUNIT_STATUS_KEY_VALID != emunit_status.key_valid)
 	{
 		emunit_display_clear();
@@ -403,7 +785,7 @@ int emunit_run(void)
 
 		case EMUNIT_RR_FINISH:
 			EMUNIT_IASSERT_MSG(
-				(emunit_ts_failed_get() + emunit_ts_passed_get()) != 0,
+				(emunit_ts_failed_get() + emunit_ts_passed_get()) == emunit_ts_selected_count(),
 				"Unexpected test suites final status");
 			return (int)emunit_ts_failed_get();
 
@@ -411,10 +793,25 @@ int emunit_run(void)
 			return -1;
 
 		case EMUNIT_RR_TIMEOUT:
-			/** @todo Show timeout message */
-			// if()
-
+			/* Test case has been interrupted - count it as failed and continue */
+			if(EMUNIT_TC_RESULT_FAILED == emunit_status.tc_current_result)
+			{
+				/* Interrupted while finishing the failed test case - it is counted already */
+				emunit_tc_finish();
+			}
+			if(EMUNIT_TC_RESULT_PASSED == emunit_status.tc_current_result)
+			{
+				/* Interrupted while finishing the passed test case - it fails now */
+				if(emunit_tc_current_counted_check())
+				{
+					--(emunit_status.tc_n_passed);
+				}
+				emunit_status.tc_current_result = EMUNIT_TC_RESULT_NONE;
+			}
+			emunit_display_failed_timeout();
+			emunit_assert_failed();
 			break;
+
 		case EMUNIT_RR_RUNNEXT:
 			emunit_tc_next_switch();
 			/* Intentional fallthrough */
@@ -426,9 +823,17 @@ int emunit_run(void)
 				emunit_restart(EMUNIT_RR_FINISH);
 			}
 
+			if((0 == emunit_status.tc_n_current) &&
+				!emunit_port_ts_selected(emunit_ts_current_index_get()))
+			{
+				/* The suite is not selected by the port: skip it without any output */
+				emunit_ts_next_switch();
+				emunit_restart(EMUNIT_RR_RUN);
+			}
 			if(0 == emunit_status.tc_n_current)
 			{
 				/* If tc_n_current is 0, the test suite header should be generated */
+				emunit_time_ts_begin();
 				emunit_display_ts_start();
 				/* First test index */
 				emunit_status.tc_n_current = EMUNIT_TS_IDX_FIRST-1;
@@ -456,12 +861,31 @@ int emunit_run(void)
 			{
 				/* Normal test run */
 				emunit_display_tc_start();
+				/* Any reset without emunit_restart call from now would mean timeout */
+				emunit_status.tc_current_result = EMUNIT_TC_RESULT_NONE;
+				emunit_status.rr = EMUNIT_RR_TIMEOUT;
+				emunit_port_tc_begin();
+				emunit_time_tc_begin();
 				emunit_current_init_run();
-				p_tc->p_fnc();
-				++(emunit_status.tc_n_passed);
+				emunit_time_test_begin();
+#if EMUNIT_CONF_TIMING
+				if(NULL != p_tc->p_bench)
+				{
+					emunit_bench_run(p_tc);
+				}
+				else
+#endif
+				{
+					p_tc->p_fnc();
+				}
+				if(emunit_tc_current_counted_check())
+				{
+					++(emunit_status.tc_n_passed);
+				}
+				emunit_status.tc_current_result = EMUNIT_TC_RESULT_PASSED;
+				emunit_time_cleanup_begin();
 				emunit_current_cleanup_run();
-				emunit_display_tc_end();
-				emunit_restart(EMUNIT_RR_RUNNEXT);
+				emunit_tc_finish();
 			}
 
 			break;
@@ -509,6 +933,20 @@ size_t emunit_ts_total_count(void)
 	return n;
 }
 
+size_t emunit_ts_selected_count(void)
+{
+	size_t n = 0;
+	size_t suite_idx;
+	for(suite_idx = 0; !emunit_ts_eol_check(suite_idx); ++suite_idx)
+	{
+		if(emunit_port_ts_selected(suite_idx))
+		{
+			++n;
+		}
+	}
+	return n;
+}
+
 size_t emunit_ts_failed_get(void)
 {
 	return emunit_status.ts_n_failed;
@@ -519,6 +957,11 @@ size_t emunit_ts_passed_get(void)
 	return emunit_status.ts_n_passed;
 }
 
+bool emunit_ts_current_failed_get(void)
+{
+	return emunit_status.ts_current_failed;
+}
+
 size_t emunit_tc_current_index_get(void)
 {
 	size_t tc_idx = emunit_status.tc_n_current;
@@ -564,18 +1007,85 @@ size_t emunit_tc_total_count(void)
 	{
 		p_tc += EMUNIT_TS_IDX_FIRST;
 
-		while(!emunit_tc_eol_check(p_tc++))
+		while(!emunit_tc_eol_check(p_tc))
 		{
-			++n;
+			if(emunit_tc_counted_check(p_tc))
+			{
+				++n;
+			}
+			++p_tc;
+		}
+	}
+#if EMUNIT_CONF_TIMING
+	n += emunit_status.tc_n_compared;
+#endif
+	return n;
+}
+
+size_t emunit_tc_selected_count(void)
+{
+	size_t n = 0;
+	size_t suite_idx;
+	for(suite_idx = 0; !emunit_ts_eol_check(suite_idx); ++suite_idx)
+	{
+		emunit_test_desc_t const __flash * p_tc;
+		if(!emunit_port_ts_selected(suite_idx))
+		{
+			continue;
+		}
+		for(p_tc = emunit_main_ts[suite_idx] + EMUNIT_TS_IDX_FIRST; !emunit_tc_eol_check(p_tc); ++p_tc)
+		{
+			if(emunit_tc_counted_check(p_tc))
+			{
+				++n;
+			}
 		}
 	}
+#if EMUNIT_CONF_TIMING
+	n += emunit_status.tc_n_compared;
+#endif
 	return n;
 }
 
+#if EMUNIT_CONF_TIMING
+const emunit_time_t * emunit_tc_time_get(void)
+{
+	return emunit_status.tc_time_valid ? &emunit_status.tc_time : NULL;
+}
+
+const emunit_time_t * emunit_ts_time_get(void)
+{
+	return &emunit_status.ts_time;
+}
+
+const emunit_bench_t * emunit_tc_bench_get(void)
+{
+	return emunit_status.tc_bench_valid ? &emunit_status.tc_bench : NULL;
+}
+#endif
+
 /* ----------------------------------------------------------------------------
  * Public API
  */
 
+#if EMUNIT_CONF_TIMING
+void emunit_cycles_begin(void)
+{
+	if(!emunit_cycles_calibrated)
+	{
+		emunit_cycles_calibrate();
+	}
+	emunit_arch_timestamp_align();
+	emunit_cycles_start = emunit_arch_timestamp();
+}
+
+emunit_timestamp_t emunit_cycles_end(void)
+{
+	const emunit_timestamp_t measured = emunit_arch_timestamp() - emunit_cycles_start;
+	return (measured > emunit_cycles_overhead) ? (measured - emunit_cycles_overhead) : 0U;
+}
+#endif
+
 void emunit_assert_passed(void)
 {
 	/* Nothing to do now */
@@ -586,11 +1096,15 @@ void emunit_assert_failed(void)
 	/* Mark current suite has failed test */
 	emunit_status.ts_current_failed = true;
 	/* Count failed test, switch to next and restart */
-	++(emunit_status.tc_n_failed);
+	if(emunit_tc_current_counted_check())
+	{
+		++(emunit_status.tc_n_failed);
+	}
+	emunit_status.tc_current_result = EMUNIT_TC_RESULT_FAILED;
+	emunit_time_cleanup_begin();
 	if(emunit_status.tc_current_cleanup_required)
 		emunit_current_cleanup_run();
-	emunit_display_tc_end();
-	emunit_restart(EMUNIT_RR_RUNNEXT);
+	emunit_tc_finish();
 }
 
 void ut_assert(
@@ -796,3 +1310,42 @@ void ut_assert_nstr_msg(
 		emunit_assert_passed();
 	}
 }
+
+#if EMUNIT_CONF_TIMING
+void ut_assert_cycles_max(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t budget,
+	emunit_timestamp_t measured)
+{
+	if(!ut_assert_cycles_max_check(budget, measured))
+	{
+		emunit_display_failed_cycles(p_head, budget, measured);
+		emunit_assert_failed();
+	}
+	else
+	{
+		emunit_assert_passed();
+	}
+}
+
+void ut_assert_cycles_max_msg(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t budget,
+	emunit_timestamp_t measured,
+	const __flash char * fmt,
+	...)
+{
+	if(!ut_assert_cycles_max_check(budget, measured))
+	{
+		va_list va;
+		va_start(va, fmt);
+		emunit_display_failed_cycles_msg(p_head, budget, measured, fmt, va);
+		va_end(va);
+		emunit_assert_failed();
+	}
+	else
+	{
+		emunit_assert_passed();
+	}
+}
+#endif
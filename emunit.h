@@ -57,6 +57,34 @@ void emunit_assert_passed(void);
  */
 void emunit_assert_failed(void);
 
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+/**
+ * @name Cycle measurement
+ *
+ * Functions used by the cycle budget assertions.
+ * Available only if @ref EMUNIT_CONF_TIMING is set.
+ * @{
+ */
+
+/**
+ * @brief Start the cycle measurement
+ *
+ * The measurement overhead is calibrated at the first call after the start.
+ * Measurements cannot be nested.
+ */
+void emunit_cycles_begin(void);
+
+/**
+ * @brief Finish the cycle measurement
+ *
+ * @return Duration since the last @ref emunit_cycles_begin call
+ *         with the calibrated overhead subtracted.
+ */
+emunit_timestamp_t emunit_cycles_end(void);
+
+/** @} */
+#endif
+
 /**
  * @name Assertion functions
  *
@@ -239,6 +267,42 @@ void ut_assert_nstr_msg(
 	const __flash char * fmt,
 	...);
 
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+/**
+ * @brief Check if the measured duration fits in the budget
+ *
+ * Function checks if:
+ * (measured <= budget)
+ *
+ * @param p_head   Assertion header
+ * @param budget   Maximum duration allowed
+ * @param measured Measured duration
+ */
+void ut_assert_cycles_max(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t budget,
+	emunit_timestamp_t measured);
+
+/**
+ * @brief Check if the measured duration fits in the budget
+ *
+ * Function checks if:
+ * (measured <= budget)
+ *
+ * @param p_head   Assertion header
+ * @param budget   Maximum duration allowed
+ * @param measured Measured duration
+ * @param fmt      Message format string
+ * @param ...      Message parameters
+ */
+void ut_assert_cycles_max_msg(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_timestamp_t budget,
+	emunit_timestamp_t measured,
+	const __flash char * fmt,
+	...);
+#endif
+
 /** @} */
 
 /** @} */
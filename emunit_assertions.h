@@ -24,6 +24,7 @@
 #include "emunit_macros.h"
 #include "emunit_types.h"
 #include "emunit_port.h"
+#include EMUNIT_DISPLAY_FILE(_size, h)
 
 #include "emunit_assertions_delta.h"
 #include "emunit_assertions_equal.h"
@@ -54,6 +55,33 @@
  * @{
  */
 
+/**
+ * @brief Static check of the failure report size
+ *
+ * Generates compilation error if the worst-case failure report generated
+ * by the selected display for given assertion does not fit into the
+ * display buffer.
+ * The name of the function with the assertion is taken
+ * as the test case name that is placed in the buffer before the report.
+ *
+ * @param[in] func    Assertion function
+ * @param[in] file    The array with the file name
+ * @param[in] text    The assertion text literal, like the expression, empty if none
+ * @param[in] msg     1 if the assertion has a message, 0 otherwise
+ *
+ * @sa EMUNIT_CONF_ASSERT_SIZE_CHECK
+ */
+#if EMUNIT_CONF_ASSERT_SIZE_CHECK || defined(__DOXYGEN__)
+#define EMUNIT_CALL_ASSERT_SIZE_CHECK(func, file, text, msg)                  \
+	EMUNIT_STATIC_ASSERT(                                                     \
+		EMUNIT_CN2(EMUNIT_DISPLAY_SIZE_, EMUNIT_DISPLAY_SELECTED)(            \
+			func, sizeof(file), sizeof(text), sizeof(__func__), msg) <        \
+			EMUNIT_CONF_BUFFER_SIZE,                                          \
+		"Failure report does not fit into the display buffer")
+#else
+#define EMUNIT_CALL_ASSERT_SIZE_CHECK(func, file, text, msg)
+#endif
+
 /**
  * @brief The auxiliary macro to call assertion function
  *
@@ -64,7 +92,22 @@
  * @param[in] func    Assertion function
  * @param[in] params  Arguments for the assertion function in brackets
  */
-#define EMUNIT_CALL_ASSERT(nt, func, params)                          \
+#define EMUNIT_CALL_ASSERT(nt, func, params) \
+	EMUNIT_CALL_ASSERT_TEXT(nt, func, "", params)
+
+/**
+ * @brief The auxiliary macro to call assertion function with the text
+ *
+ * The version of @ref EMUNIT_CALL_ASSERT for the assertions
+ * that place the text literal, like the expression, in the failure report.
+ * The text is counted by the failure report size check.
+ *
+ * @param[in] nt      Numeric type
+ * @param[in] func    Assertion function
+ * @param[in] text    The text literal passed in @c params
+ * @param[in] params  Arguments for the assertion function in brackets
+ */
+#define EMUNIT_CALL_ASSERT_TEXT(nt, func, text, params)               \
 	do{                                                               \
 		static const __flash char emunit_ca_file[] = __FILE__;        \
 		static const __flash emunit_assert_head_t                     \
@@ -73,6 +116,7 @@
 				.line   = __LINE__,                                   \
 				.numtype = nt                                         \
 			};                                                        \
+		EMUNIT_CALL_ASSERT_SIZE_CHECK(func, emunit_ca_file, text, 0); \
 		func(&emunit_ca_head, EMUNIT_DEBRACKET(params));              \
 	}while(0)
 
@@ -88,7 +132,22 @@
  * @param[in] fmt
  * @param[in] ...     Message format string followed by message parameters
  */
-#define EMUNIT_CALL_ASSERT_MSG(nt, func, params, ...)                         \
+#define EMUNIT_CALL_ASSERT_MSG(nt, func, params, ...) \
+	EMUNIT_CALL_ASSERT_TEXT_MSG(nt, func, "", params, __VA_ARGS__)
+
+/**
+ * @brief The auxiliary macro to call assertion function with the text and message
+ *
+ * The message version of @ref EMUNIT_CALL_ASSERT_TEXT.
+ *
+ * @param[in] nt      Numeric type
+ * @param[in] func    Assertion function
+ * @param[in] text    The text literal passed in @c params
+ * @param[in] params  Arguments for the assertion function in brackets
+ * @param[in] fmt
+ * @param[in] ...     Message format string followed by message parameters
+ */
+#define EMUNIT_CALL_ASSERT_TEXT_MSG(nt, func, text, params, ...)              \
 	do{                                                                       \
 		static const __flash char emunit_ca_file[] = __FILE__;                \
 		static const __flash char emunit_ca_msg[] = EMUNIT_ARG1(__VA_ARGS__); \
@@ -98,6 +157,7 @@
 				.line   = __LINE__,                                           \
 				.numtype = nt                                                 \
 			};                                                                \
+		EMUNIT_CALL_ASSERT_SIZE_CHECK(func, emunit_ca_file, text, 1);         \
 		EMUNIT_IF_ARGCNT1((__VA_ARGS__),                                      \
 			func ## _msg(                                                     \
 				&emunit_ca_head,                                              \
@@ -133,7 +193,7 @@
  *
  * @param exp The expression
  */
-#define UT_ASSERT(         exp)  EMUNIT_CALL_ASSERT(EMUNIT_NUMTYPE_BOOL, ut_assert, (EMUNIT_FLASHSTR(#exp), (exp)))
+#define UT_ASSERT(         exp)  EMUNIT_CALL_ASSERT_TEXT(EMUNIT_NUMTYPE_BOOL, ut_assert, #exp, (EMUNIT_FLASHSTR(#exp), (exp)))
 /**
  * @brief Expect true
  *
@@ -176,7 +236,7 @@
  *
  * @param ptr The pointer to be checked
  */
-#define UT_ASSERT_NOT_NULL(ptr)  EMUNIT_CALL_ASSERT(EMUNIT_NUMTYPE_BOOL, ut_assert, (EMUNIT_FLASHSTR("(" #ptr ") != NULL"), ((ptr) != NULL)))
+#define UT_ASSERT_NOT_NULL(ptr)  EMUNIT_CALL_ASSERT_TEXT(EMUNIT_NUMTYPE_BOOL, ut_assert, "(" #ptr ") != NULL", (EMUNIT_FLASHSTR("(" #ptr ") != NULL"), ((ptr) != NULL)))
 
 /**
  * @brief Base assertion with message
@@ -187,7 +247,7 @@
  * @param ... Format string followed by the format values.
  *            Standard @c printf format is used.
  */
-#define UT_ASSERT_MSG(         exp, ...)  EMUNIT_CALL_ASSERT_MSG(EMUNIT_NUMTYPE_BOOL, ut_assert, (EMUNIT_FLASHSTR(#exp), (exp)), __VA_ARGS__)
+#define UT_ASSERT_MSG(         exp, ...)  EMUNIT_CALL_ASSERT_TEXT_MSG(EMUNIT_NUMTYPE_BOOL, ut_assert, #exp, (EMUNIT_FLASHSTR(#exp), (exp)), __VA_ARGS__)
 /**
  * @brief Expect true with message
  *
@@ -227,7 +287,7 @@
  * @param ... Format string followed by the format values.
  *            Standard @c printf format is used.
  */
-#define UT_ASSERT_NOT_NULL_MSG(ptr, ...)  EMUNIT_CALL_ASSERT_MSG(EMUNIT_NUMTYPE_BOOL, ut_assert, (EMUNIT_FLASHSTR("(" #ptr ") != NULL"), ((ptr) != NULL)), __VA_ARGS__)
+#define UT_ASSERT_NOT_NULL_MSG(ptr, ...)  EMUNIT_CALL_ASSERT_TEXT_MSG(EMUNIT_NUMTYPE_BOOL, ut_assert, "(" #ptr ") != NULL", (EMUNIT_FLASHSTR("(" #ptr ") != NULL"), ((ptr) != NULL)), __VA_ARGS__)
 /** @} <!-- emunit_assertions_bool_group --> */
 
 /**
@@ -288,5 +348,92 @@
 
 /** @} <!-- emunit_assertions_str_group --> */
 
+/**
+ * @defgroup emunit_assertions_cycles_group <emunit_assertions_cycles> Cycle budget assertions
+ * @{
+ *
+ * Assertions that fail if the code runs longer than expected.
+ *
+ * The duration is measured by the architecture timestamp,
+ * the unit is given by @c EMUNIT_TIMESTAMP_UNIT.
+ * The measurement overhead is calibrated and subtracted.
+ * Requires @ref EMUNIT_CONF_TIMING to be set.
+ *
+ * @note
+ * Measurements cannot be nested.
+ */
+
+/**
+ * @brief Start the measured block
+ *
+ * The block has to be finished by @ref UT_ASSERT_CYCLES_END.
+ */
+#define UT_CYCLES_BEGIN()                                                     \
+	do{                                                                       \
+		EMUNIT_STATIC_ASSERT(EMUNIT_CONF_TIMING,                              \
+			"Cycle budget assertions require EMUNIT_CONF_TIMING");            \
+		emunit_cycles_begin();                                                \
+	}while(0)
+
+/**
+ * @brief Finish the measured block and check its duration
+ *
+ * @param budget Maximum duration allowed since @ref UT_CYCLES_BEGIN
+ */
+#define UT_ASSERT_CYCLES_END(budget)                                          \
+	do{                                                                       \
+		const emunit_timestamp_t emunit_cycles_measured = emunit_cycles_end(); \
+		EMUNIT_CALL_ASSERT(EMUNIT_CN2(EMUNIT_NUMTYPE_U, EMUNIT_CONF_NUMBER_SIZE), \
+			ut_assert_cycles_max, ((budget), emunit_cycles_measured));        \
+	}while(0)
+
+/**
+ * @brief Finish the measured block and check its duration with message
+ *
+ * The message version of @ref UT_ASSERT_CYCLES_END.
+ *
+ * @param budget Maximum duration allowed since @ref UT_CYCLES_BEGIN
+ * @param ...    Format string followed by the format values.
+ *               Standard @c printf format is used.
+ */
+#define UT_ASSERT_CYCLES_END_MSG(budget, ...)                                 \
+	do{                                                                       \
+		const emunit_timestamp_t emunit_cycles_measured = emunit_cycles_end(); \
+		EMUNIT_CALL_ASSERT_MSG(EMUNIT_CN2(EMUNIT_NUMTYPE_U, EMUNIT_CONF_NUMBER_SIZE), \
+			ut_assert_cycles_max, ((budget), emunit_cycles_measured), __VA_ARGS__); \
+	}while(0)
+
+/**
+ * @brief Expect the statement to fit in the budget
+ *
+ * @param budget    Maximum duration allowed
+ * @param statement The statement to be measured
+ */
+#define UT_ASSERT_CYCLES_MAX(budget, statement)                               \
+	do{                                                                       \
+		UT_CYCLES_BEGIN();                                                    \
+		statement;                                                            \
+		UT_ASSERT_CYCLES_END(budget);                                         \
+	}while(0)
+
+/**
+ * @brief Expect the statement to fit in the budget with message
+ *
+ * The message version of @ref UT_ASSERT_CYCLES_MAX.
+ *
+ * @param budget    Maximum duration allowed
+ * @param statement The statement to be measured
+ * @param ...       Format string followed by the format values.
+ *                  Standard @c printf format is used.
+ */
+#define UT_ASSERT_CYCLES_MAX_MSG(budget, statement, ...)                      \
+	do{                                                                       \
+		UT_CYCLES_BEGIN();                                                    \
+		statement;                                                            \
+		UT_ASSERT_CYCLES_END_MSG(budget, __VA_ARGS__);                        \
+	}while(0)
+
+/** @} <!-- emunit_assertions_cycles_group --> */
+
 /** @} <!-- emunit_assertions_group --> */
 #endif /* EMUNIT_ASSERTIONS_H_INCLUDED */
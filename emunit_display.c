@@ -62,6 +62,22 @@ extern emunit_display_status_t emunit_display_status;
  */
 static const char * emunit_display_buffer_end =
 	&(emunit_display_status.buffer[EMUNIT_CONF_BUFFER_SIZE]);
+
+#if EMUNIT_CONF_DISPLAY_MULTI || defined(__DOXYGEN__)
+/**
+ * @brief Size of the buffer region used by single display
+ */
+#define EMUNIT_DISPLAY_REGION_SIZE (EMUNIT_CONF_BUFFER_SIZE / EMUNIT_CONF_DISPLAY_MULTI)
+#endif
+
+#if EMUNIT_CONF_DISPLAY_DEFER || defined(__DOXYGEN__)
+/**
+ * @brief Deferred failure report is being formatted
+ *
+ * Set while the failure record is replayed after the restart.
+ */
+static bool emunit_display_replaying;
+#endif
 /** @} */
 
 /**
@@ -97,6 +113,79 @@ static const char * emunit_display_buffer_end =
  */
 typedef void (*emunit_display_cleanup_fn_t)(char * p_start, size_t len);
 
+/**
+ * @brief Get the start of the current buffer region
+ *
+ * Every display used by @ref EMUNIT_CONF_DISPLAY_MULTI writes into
+ * its own region of the buffer.
+ * Otherwise the region is the whole buffer.
+ *
+ * @return The pointer to the first byte of the region
+ */
+static inline char * emunit_display_region_begin(void)
+{
+#if EMUNIT_CONF_DISPLAY_MULTI
+	return emunit_display_status.buffer +
+		(size_t)emunit_display_status.region * EMUNIT_DISPLAY_REGION_SIZE;
+#else
+	return emunit_display_status.buffer;
+#endif
+}
+
+/**
+ * @brief Get the end of the current buffer region
+ *
+ * @return The pointer just after the last byte of the region
+ *
+ * @sa emunit_display_region_begin
+ */
+static inline const char * emunit_display_region_end(void)
+{
+#if EMUNIT_CONF_DISPLAY_MULTI
+	return emunit_display_region_begin() + EMUNIT_DISPLAY_REGION_SIZE;
+#else
+	return emunit_display_buffer_end;
+#endif
+}
+
+#if EMUNIT_CONF_DISPLAY_MULTI || defined(__DOXYGEN__)
+/**
+ * @brief Select the buffer region to write to
+ *
+ * Stores the write pointer of the current region and
+ * restores the one of the selected region.
+ *
+ * @param idx Region index, the same as the display index
+ */
+static void emunit_display_region_select(uint8_t idx)
+{
+	emunit_display_status.region_w_ptr[emunit_display_status.region] =
+		emunit_display_status.w_ptr;
+	emunit_display_status.region = idx;
+	emunit_display_status.w_ptr = emunit_display_status.region_w_ptr[idx];
+}
+#endif
+
+/**
+ * @brief Get the current write limit
+ *
+ * In drain mode the write pointer cannot reach the read pointer
+ * after the buffer wraps.
+ *
+ * @return The pointer just after the last byte that can be written
+ */
+static inline const char * emunit_display_limit(void)
+{
+#if EMUNIT_CONF_DISPLAY_DRAIN
+	char * const r_ptr = emunit_display_status.r_ptr;
+	if(emunit_display_status.w_ptr < r_ptr)
+	{
+		return r_ptr - 1;
+	}
+#endif
+	return emunit_display_region_end();
+}
+
 /**
  * @brief Get the buffer size left
  *
@@ -106,7 +195,244 @@ typedef void (*emunit_display_cleanup_fn_t)(char * p_start, size_t len);
  */
 static inline size_t emunit_display_max_size(void)
 {
-	return (emunit_display_buffer_end - emunit_display_status.w_ptr);
+	const char * const limit = emunit_display_limit();
+	if(limit <= emunit_display_status.w_ptr)
+	{
+		return 0;
+	}
+	return (size_t)(limit - emunit_display_status.w_ptr);
+}
+
+/**
+ * @brief Get the buffer size used
+ *
+ * Internal function used to count the number of bytes already
+ * placed in the buffer.
+ *
+ * @return Number of bytes used in the buffer
+ */
+static inline size_t emunit_display_used_size(void)
+{
+#if EMUNIT_CONF_DISPLAY_DRAIN
+	char * const r_ptr = emunit_display_status.r_ptr;
+	if(emunit_display_status.w_ptr < r_ptr)
+	{
+		return (size_t)(emunit_display_status.e_ptr - r_ptr) +
+			(size_t)(emunit_display_status.w_ptr - emunit_display_status.buffer);
+	}
+	return (size_t)(emunit_display_status.w_ptr - r_ptr);
+#else
+	return (size_t)(emunit_display_status.w_ptr - emunit_display_region_begin());
+#endif
+}
+
+/**
+ * @brief Make place for the next message
+ *
+ * Makes sure that @c size bytes and terminating zero can be placed
+ * in the buffer in one piece.
+ * In drain mode it wraps the write pointer to the buffer start
+ * or waits for the port to drain the buffer.
+ * Otherwise it generates assertion failure if there is no place.
+ *
+ * @note In drain mode it can be called only between messages,
+ *       when all the written data is committed.
+ *
+ * @param size Number of bytes to be placed
+ */
+static void emunit_display_reserve(size_t size)
+{
+#if EMUNIT_CONF_DISPLAY_DRAIN
+	EMUNIT_IASSERT(size + 1U < EMUNIT_CONF_BUFFER_SIZE);
+	while(emunit_display_max_size() <= size)
+	{
+		char * const r_ptr = emunit_display_status.r_ptr;
+		if((r_ptr <= emunit_display_status.w_ptr) &&
+			(emunit_display_status.w_ptr != emunit_display_status.buffer) &&
+			((r_ptr == emunit_display_status.w_ptr) ||
+			((size_t)(r_ptr - emunit_display_status.buffer) > size + 1U)))
+		{
+			/* Mark the data end before the consumer sees the wrapped pointer */
+			emunit_display_status.e_ptr = emunit_display_status.w_ptr;
+			EMUNIT_MEMORY_BARRIER();
+			emunit_display_status.w_ptr = emunit_display_status.buffer;
+			emunit_display_status.c_ptr = emunit_display_status.buffer;
+		}
+		else
+		{
+			emunit_port_out_wait();
+		}
+	}
+#else
+	EMUNIT_IASSERT(emunit_display_max_size() > size);
+#endif
+}
+
+#if EMUNIT_CONF_DISPLAY_DRAIN || defined(__DOXYGEN__)
+/**
+ * @brief Make place for the growing message
+ *
+ * Drain mode function used when the message that is not committed yet
+ * has to grow, while the clean up function replaces its parts.
+ * It waits for the data to be drained or moves the message
+ * to the buffer start.
+ *
+ * @param p_pos Position inside the message that has to be kept valid
+ * @param extra Number of bytes the message would grow
+ *
+ * @return The @c p_pos after the message is moved
+ */
+static char * emunit_display_grow(char * p_pos, size_t extra)
+{
+	char * const buffer = emunit_display_status.buffer;
+	while(emunit_display_max_size() <= extra)
+	{
+		char * const r_ptr = emunit_display_status.r_ptr;
+		char * const c_ptr = emunit_display_status.c_ptr;
+		const size_t msg_len = (size_t)(emunit_display_status.w_ptr - c_ptr);
+		EMUNIT_IASSERT(msg_len + extra + 1U < EMUNIT_CONF_BUFFER_SIZE);
+		if((r_ptr <= c_ptr) && (c_ptr != buffer) &&
+			((r_ptr == c_ptr) || ((size_t)(r_ptr - buffer) > msg_len + extra + 1U)))
+		{
+			memmove(buffer, c_ptr, msg_len + 1U);
+			/* Mark the data end before the consumer sees the wrapped pointer */
+			emunit_display_status.e_ptr = c_ptr;
+			EMUNIT_MEMORY_BARRIER();
+			emunit_display_status.c_ptr = buffer;
+			emunit_display_status.w_ptr = buffer + msg_len;
+			p_pos -= (c_ptr - buffer);
+		}
+		else
+		{
+			emunit_port_out_wait();
+		}
+	}
+	return p_pos;
+}
+#endif
+
+/**
+ * @brief Commit written data
+ *
+ * In drain mode it makes the data written till now visible to the port.
+ * The data is committed after the clean up function finishes its work.
+ */
+static inline void emunit_display_commit(void)
+{
+#if EMUNIT_CONF_DISPLAY_DRAIN
+	EMUNIT_MEMORY_BARRIER();
+	emunit_display_status.c_ptr = emunit_display_status.w_ptr;
+#endif
+}
+
+#if EMUNIT_CONF_DISPLAY_DEFER || defined(__DOXYGEN__)
+/**
+ * @brief Check if there is deferred failure record waiting
+ *
+ * @retval true  Current test case has failed and its report is deferred.
+ * @retval false No failure record is waiting.
+ */
+static inline bool emunit_display_record_pending(void)
+{
+	return (EMUNIT_DISPLAY_RECORD_NONE != emunit_display_status.record.type);
+}
+#endif
+
+/**
+ * @brief Update the test case buffer usage statistic
+ *
+ * @param used      Number of bytes used by the current test case
+ * @param free_size Number of bytes left free in the buffer
+ *
+ * @retval true  Less than @ref EMUNIT_CONF_BUFFER_MARGIN bytes left free.
+ * @retval false There is still enough free space in the buffer.
+ */
+static bool emunit_display_tc_usage_update(size_t used, size_t free_size)
+{
+	emunit_display_usage_t * const p_usage = &emunit_display_status.usage;
+
+	if((EMUNIT_IDX_INVALID == p_usage->tc_used_max_ts) || (used > p_usage->tc_used_max))
+	{
+		p_usage->tc_used_max    = used;
+		p_usage->tc_used_max_ts = emunit_ts_current_index_get();
+		p_usage->tc_used_max_tc = emunit_tc_current_index_get();
+	}
+	return (free_size <= EMUNIT_CONF_BUFFER_MARGIN);
+}
+
+/**
+ * @brief Register buffer usage of the current test case
+ *
+ * Function to be called by the display in the test case end function,
+ * before the test case footer is placed in the buffer.
+ * It updates the buffer usage statistic.
+ *
+ * If the failure report is deferred, the usage without the report
+ * is remembered and the report size is added when it is formatted.
+ * With multiple displays every display registers the usage of its own
+ * buffer region, but the test case near the overflow is counted once.
+ *
+ * @retval true  Current test case has left less than
+ *               @ref EMUNIT_CONF_BUFFER_MARGIN bytes free in the buffer.
+ * @retval false There is still enough free space in the buffer.
+ */
+static bool emunit_display_tc_usage_register(void)
+{
+	const size_t used = emunit_display_used_size();
+	const size_t free_size = emunit_display_max_size();
+#if EMUNIT_CONF_DISPLAY_DEFER
+	if(emunit_display_record_pending())
+	{
+		emunit_display_record_t * const p_rec = &emunit_display_status.record;
+		p_rec->tc_registered = true;
+		p_rec->tc_used = used;
+		p_rec->tc_free = free_size;
+	}
+#endif
+	if(emunit_display_tc_usage_update(used, free_size))
+	{
+#if EMUNIT_CONF_DISPLAY_MULTI
+		/* Every display registers its own region, the test case is counted once */
+		if(!emunit_display_status.tc_near_overflow)
+		{
+			emunit_display_status.tc_near_overflow = true;
+			++(emunit_display_status.usage.tc_n_near_overflow);
+		}
+#else
+		++(emunit_display_status.usage.tc_n_near_overflow);
+#endif
+		return true;
+	}
+	return false;
+}
+
+/**
+ * @brief Get the identifier of the failure being displayed
+ *
+ * The identifier is the number of failed test cases including the current one.
+ * Deferred failure report is formatted after the failure counter is updated.
+ *
+ * @return Failure identifier
+ */
+static inline size_t emunit_display_failure_id(void)
+{
+#if EMUNIT_CONF_DISPLAY_DEFER
+	if(emunit_display_replaying)
+	{
+		return emunit_tc_failed_get();
+	}
+#endif
+	return emunit_tc_failed_get() + 1U;
+}
+
+/**
+ * @brief Get the buffer usage statistic
+ *
+ * @return Pointer to the buffer usage statistic collected till now.
+ */
+static inline const emunit_display_usage_t * emunit_display_usage_get(void)
+{
+	return &emunit_display_status.usage;
 }
 
 /**
@@ -119,8 +445,10 @@ static inline size_t emunit_display_max_size(void)
  */
 static void emunit_display_putc(char c)
 {
-	EMUNIT_IASSERT(emunit_display_max_size() > 1);
+	emunit_display_reserve(1);
 	*(emunit_display_status.w_ptr++)= c;
+	*(emunit_display_status.w_ptr) = '\0';
+	emunit_display_commit();
 }
 
 /**
@@ -138,15 +466,16 @@ static void emunit_display_putc(char c)
  */
 static void emunit_display_write(emunit_display_cleanup_fn_t cleanup, char const __memx * s, size_t size)
 {
-	const size_t max_size = emunit_display_max_size();
 	char * ptr_start;
-	EMUNIT_IASSERT(size < max_size);
+	emunit_display_reserve(size);
 
 	emunit_memcpy(emunit_display_status.w_ptr, s, size);
 	ptr_start = emunit_display_status.w_ptr;
 	emunit_display_status.w_ptr += size;
+	*(emunit_display_status.w_ptr) = '\0';
 	if(NULL != cleanup)
 		cleanup(ptr_start, size);
+	emunit_display_commit();
 }
 
 /**
@@ -187,9 +516,13 @@ static void emunit_display_puts(emunit_display_cleanup_fn_t cleanup, char const
  */
 static void emunit_display_vprintf(emunit_display_cleanup_fn_t cleanup, char const __memx * fmt, va_list args)
 {
-	const size_t max_size = emunit_display_max_size();
+	size_t max_size = emunit_display_max_size();
 	size_t printed_size;
 	char * ptr_start;
+#if EMUNIT_CONF_DISPLAY_DRAIN
+	va_list args_retry;
+	va_copy(args_retry, args);
+#endif
 
 	printed_size = emunit_vsnprintf(
 		emunit_display_status.w_ptr,
@@ -197,11 +530,26 @@ static void emunit_display_vprintf(emunit_display_cleanup_fn_t cleanup, char con
 		fmt,
 		args);
 
+#if EMUNIT_CONF_DISPLAY_DRAIN
+	if(printed_size >= max_size)
+	{
+		/* Not enough place - try again when the buffer is drained */
+		emunit_display_reserve(printed_size);
+		max_size = emunit_display_max_size();
+		printed_size = emunit_vsnprintf(
+			emunit_display_status.w_ptr,
+			max_size,
+			fmt,
+			args_retry);
+	}
+	va_end(args_retry);
+#endif
 	EMUNIT_IASSERT(printed_size < max_size);
 	ptr_start = emunit_display_status.w_ptr;
 	emunit_display_status.w_ptr += printed_size;
 	if(NULL != cleanup)
 		cleanup(ptr_start, printed_size);
+	emunit_display_commit();
 }
 
 /**
@@ -250,6 +598,37 @@ static void emunit_display_panic_puts(char const __memx * s)
 	}
 	emunit_memcpy(emunit_display_status.w_ptr, s, size);
 	emunit_display_status.w_ptr += size;
+	emunit_display_commit();
+}
+
+/**
+ * @brief Formatted output in panic message printing
+ *
+ * Specialised function to be used in panic display.
+ * Like @ref emunit_display_panic_puts it never asserts the fact
+ * if the output fits the buffer, it is just truncated.
+ *
+ * @param[in]  fmt Format string.
+ * @param[in]  ... Parameters.
+ */
+static void emunit_display_panic_printf(char const __memx * fmt, ...)
+{
+	const size_t max_size = emunit_display_max_size();
+	size_t size;
+	va_list args;
+	va_start(args, fmt);
+	size = emunit_vsnprintf(
+		emunit_display_status.w_ptr,
+		max_size,
+		fmt,
+		args);
+	va_end(args);
+	if(size >= max_size)
+	{
+		size = max_size - 1;
+	}
+	emunit_display_status.w_ptr += size;
+	emunit_display_commit();
 }
 
 /**
@@ -273,14 +652,20 @@ static void emunit_display_panic_puts(char const __memx * s)
  */
 static char* emunit_display_replace(char * p_start, size_t len, const char __memx * s)
 {
-	EMUNIT_IASSERT((emunit_display_status.buffer <= p_start) &&
-		(p_start < emunit_display_buffer_end));
+	EMUNIT_IASSERT((emunit_display_region_begin() <= p_start) &&
+		(p_start < emunit_display_limit()));
 	EMUNIT_IASSERT(p_start + len <= emunit_display_status.w_ptr);
 	size_t s_len = emunit_strlen(s);
+#if EMUNIT_CONF_DISPLAY_DRAIN
+	if(s_len > len)
+	{
+		p_start = emunit_display_grow(p_start, s_len - len);
+	}
+#endif
 	if(s_len != len)
 	{
 		EMUNIT_IASSERT((s_len <= len) ||
-			(emunit_display_status.w_ptr + s_len - len < emunit_display_buffer_end));
+			(emunit_display_status.w_ptr + s_len - len < emunit_display_limit()));
 		/* Move with trailing zero */
 		char * p_to = p_start + s_len;
 		char * p_from = p_start + len;
@@ -297,27 +682,328 @@ static char* emunit_display_replace(char * p_start, size_t len, const char __mem
 
 /** @} */
 
-void emunit_display_clear(void)
+#if EMUNIT_CONF_DISPLAY_COMPRESS || defined(__DOXYGEN__)
+#include "emunit_display_lz.c"
+#endif
+
+/**
+ * @brief Clear the buffer contents
+ *
+ * Internal function that clears only the buffer itself,
+ * keeping the usage statistic untouched.
+ */
+static void emunit_display_buffer_clear(void)
 {
-	memset(&emunit_display_status, 0, sizeof(emunit_display_status));
+	memset(emunit_display_status.buffer, 0, sizeof(emunit_display_status.buffer));
 	emunit_display_status.w_ptr = emunit_display_status.buffer;
+#if EMUNIT_CONF_DISPLAY_DRAIN
+	emunit_display_status.c_ptr = emunit_display_status.buffer;
+	emunit_display_status.r_ptr = emunit_display_status.buffer;
+	emunit_display_status.e_ptr = NULL;
+#endif
+#if EMUNIT_CONF_DISPLAY_DEFER
+	emunit_display_status.record.type = EMUNIT_DISPLAY_RECORD_NONE;
+#endif
+#if EMUNIT_CONF_DISPLAY_MULTI
+	for(uint8_t idx = 0; idx < EMUNIT_CONF_DISPLAY_MULTI; ++idx)
+	{
+		emunit_display_status.region_w_ptr[idx] =
+			emunit_display_status.buffer + (size_t)idx * EMUNIT_DISPLAY_REGION_SIZE;
+	}
+	emunit_display_status.region = 0;
+#endif
+}
+
+void emunit_display_clear(void)
+{
+	memset(&emunit_display_status.usage, 0, sizeof(emunit_display_status.usage));
+	emunit_display_status.usage.tc_used_max_ts = EMUNIT_IDX_INVALID;
+	emunit_display_status.usage.tc_used_max_tc = EMUNIT_IDX_INVALID;
+	emunit_display_buffer_clear();
+}
+
+#if EMUNIT_CONF_DISPLAY_DRAIN || defined(__DOXYGEN__)
+size_t emunit_display_drain_get(char const ** pp_data)
+{
+	char * r_ptr = emunit_display_status.r_ptr;
+	char * const c_ptr = emunit_display_status.c_ptr;
+	EMUNIT_MEMORY_BARRIER();
+	if(r_ptr > c_ptr)
+	{
+		/* Buffer wrapped */
+		char * const e_ptr = emunit_display_status.e_ptr;
+		if(r_ptr < e_ptr)
+		{
+			*pp_data = r_ptr;
+			return (size_t)(e_ptr - r_ptr);
+		}
+		r_ptr = emunit_display_status.buffer;
+		emunit_display_status.r_ptr = r_ptr;
+	}
+	*pp_data = r_ptr;
+	return (size_t)(c_ptr - r_ptr);
+}
+
+void emunit_display_drain_release(size_t n)
+{
+	EMUNIT_MEMORY_BARRIER();
+	emunit_display_status.r_ptr += n;
+}
+#endif
+
+
+#if EMUNIT_CONF_DISPLAY_DEFER || defined(__DOXYGEN__)
+/**
+ * @defgroup emunit_display_defer_group Deferred failure formatting
+ * @ingroup emunit_display_internal_group
+ *
+ * Failure path stores only the raw record.
+ * The report is formatted after the restart, at the end of the buffer,
+ * and moved into the position where the failure occurred.
+ * @{
+ */
+
+/**
+ * @brief Start new failure record
+ *
+ * @param p_head Assertion header
+ * @param type   Record type
+ *
+ * @return Pointer to the record to be filled
+ */
+static emunit_display_record_t * emunit_display_record_start(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_display_record_type_t type)
+{
+	emunit_display_record_t * const p_rec = &emunit_display_status.record;
+	EMUNIT_IASSERT(EMUNIT_DISPLAY_RECORD_NONE == p_rec->type);
+	p_rec->p_head = p_head;
+	p_rec->pos    = emunit_display_used_size();
+	p_rec->type   = type;
+	p_rec->tc_registered = false;
+	return p_rec;
+}
+
+/**
+ * @brief Reverse the buffer part in place
+ *
+ * @param p_start The first character
+ * @param p_end   The pointer just after the last character
+ */
+static void emunit_display_reverse(char * p_start, char * p_end)
+{
+	while(p_start < --p_end)
+	{
+		char c = *p_start;
+		*(p_start++) = *p_end;
+		*p_end = c;
+	}
+}
+
+/**
+ * @brief Format the deferred failure report
+ *
+ * The report is formatted at the end of the buffer and then
+ * swapped with everything that was written after the failure.
+ * Its size is added to the test case buffer usage registered
+ * at the test case end.
+ */
+static void emunit_display_record_replay(void)
+{
+	emunit_display_record_t * const p_rec = &emunit_display_status.record;
+	char * const p_tail = emunit_display_status.buffer + p_rec->pos;
+	char * const p_report = emunit_display_status.w_ptr;
+
+	if(EMUNIT_DISPLAY_RECORD_NONE == p_rec->type)
+	{
+		return;
+	}
+	emunit_display_replaying = true;
+	switch(p_rec->type)
+	{
+	case EMUNIT_DISPLAY_RECORD_ASSERT:
+		EMUNIT_DISPLAY_NAME(failed_assert)(p_rec->p_head, p_rec->str_expr);
+		break;
+	case EMUNIT_DISPLAY_RECORD_EQUAL:
+		EMUNIT_DISPLAY_NAME(failed_equal)(p_rec->p_head, p_rec->val[0], p_rec->val[1]);
+		break;
+	case EMUNIT_DISPLAY_RECORD_RANGE:
+		EMUNIT_DISPLAY_NAME(failed_range)(p_rec->p_head, p_rec->val[0], p_rec->val[1], p_rec->val[2]);
+		break;
+	case EMUNIT_DISPLAY_RECORD_DELTA:
+		EMUNIT_DISPLAY_NAME(failed_delta)(p_rec->p_head, p_rec->val[0].u, p_rec->val[1], p_rec->val[2]);
+		break;
+	default:
+		EMUNIT_IASSERT_MSG(false, "ERROR: Wrong record type");
+		break;
+	}
+	emunit_display_replaying = false;
+	p_rec->type = EMUNIT_DISPLAY_RECORD_NONE;
+
+	if(p_rec->tc_registered)
+	{
+		const size_t report_len = (size_t)(emunit_display_status.w_ptr - p_report);
+		const size_t free_size = (p_rec->tc_free > report_len) ? (p_rec->tc_free - report_len) : 0U;
+		/* Near overflow without the report is already counted */
+		if(emunit_display_tc_usage_update(p_rec->tc_used + report_len, free_size) &&
+			(p_rec->tc_free > EMUNIT_CONF_BUFFER_MARGIN))
+		{
+			++(emunit_display_status.usage.tc_n_near_overflow);
+		}
+	}
+
+	/* Move the report before the data written after the failure */
+	emunit_display_reverse(p_tail, p_report);
+	emunit_display_reverse(p_report, emunit_display_status.w_ptr);
+	emunit_display_reverse(p_tail, emunit_display_status.w_ptr);
+}
+
+void emunit_display_defer_failed_assert(
+	const __flash emunit_assert_head_t * p_head,
+	const __flash char * str_expr)
+{
+	emunit_display_record_t * const p_rec =
+		emunit_display_record_start(p_head, EMUNIT_DISPLAY_RECORD_ASSERT);
+	p_rec->str_expr = str_expr;
+}
+
+void emunit_display_defer_failed_equal(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_num_t expected,
+	emunit_num_t actual)
+{
+	emunit_display_record_t * const p_rec =
+		emunit_display_record_start(p_head, EMUNIT_DISPLAY_RECORD_EQUAL);
+	p_rec->val[0] = expected;
+	p_rec->val[1] = actual;
+}
+
+void emunit_display_defer_failed_range(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_num_t min,
+	emunit_num_t max,
+	emunit_num_t actual)
+{
+	emunit_display_record_t * const p_rec =
+		emunit_display_record_start(p_head, EMUNIT_DISPLAY_RECORD_RANGE);
+	p_rec->val[0] = min;
+	p_rec->val[1] = max;
+	p_rec->val[2] = actual;
 }
 
+void emunit_display_defer_failed_delta(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_unum_t delta,
+	emunit_num_t expected,
+	emunit_num_t actual)
+{
+	emunit_display_record_t * const p_rec =
+		emunit_display_record_start(p_head, EMUNIT_DISPLAY_RECORD_DELTA);
+	p_rec->val[0].u = delta;
+	p_rec->val[1] = expected;
+	p_rec->val[2] = actual;
+}
+/** @} */
+#endif /* EMUNIT_CONF_DISPLAY_DEFER */
+
+/**
+ * @brief Send the buffer part to the port
+ *
+ * Compresses the data if @ref EMUNIT_CONF_DISPLAY_COMPRESS is set.
+ *
+ * @param p_data Data to be sent
+ * @param len    Number of bytes to be sent
+ */
+static inline void emunit_display_out_write(char const * p_data, size_t len)
+{
+#if EMUNIT_CONF_DISPLAY_COMPRESS
+	emunit_display_lz_write(p_data, len);
+#else
+	emunit_port_out_write(p_data, len);
+#endif
+}
+
+#if EMUNIT_CONF_DISPLAY_MULTI || defined(__DOXYGEN__)
+/**
+ * @brief Send all the buffer regions
+ *
+ * Every region is sent to the port stream with the same index
+ * as the display that generated it.
+ */
+static void emunit_display_regions_present(void)
+{
+	size_t used = 0;
+	uint8_t idx;
+
+	for(idx = 0; idx < EMUNIT_CONF_DISPLAY_MULTI; ++idx)
+	{
+		emunit_display_region_select(idx);
+		used = EMUNIT_MAX(used, emunit_display_used_size());
+	}
+	/* Present only if there is anything to present */
+	if(used > 0U)
+	{
+		if(used > emunit_display_status.usage.used_max)
+		{
+			emunit_display_status.usage.used_max = used;
+		}
+		emunit_port_out_init();
+		for(idx = 0; idx < EMUNIT_CONF_DISPLAY_MULTI; ++idx)
+		{
+			emunit_display_region_select(idx);
+			if(emunit_display_used_size() > 0U)
+			{
+				emunit_port_out_select(idx);
+				emunit_display_out_write(
+					emunit_display_region_begin(),
+					emunit_display_used_size());
+			}
+		}
+		emunit_port_out_deinit();
+	}
+	emunit_display_buffer_clear();
+}
+#endif
 
 void emunit_display_present(void)
 {
 	EMUNIT_IASSERT(emunit_display_status.w_ptr >= emunit_display_status.buffer);
 	EMUNIT_IASSERT((emunit_display_status.w_ptr - emunit_display_status.buffer) <= EMUNIT_CONF_BUFFER_SIZE);
+#if EMUNIT_CONF_DISPLAY_DEFER
+	emunit_display_record_replay();
+#endif
+#if EMUNIT_CONF_DISPLAY_MULTI
+	emunit_display_regions_present();
+#else
 	/* Present only if there is anything to present */
-	if(emunit_display_status.w_ptr > emunit_display_status.buffer)
+	if(emunit_display_used_size() > 0U)
 	{
+		if(emunit_display_used_size() > emunit_display_status.usage.used_max)
+		{
+			emunit_display_status.usage.used_max = emunit_display_used_size();
+		}
 		emunit_port_out_init();
-		emunit_port_out_write(
+#if EMUNIT_CONF_DISPLAY_DRAIN
+		char const * p_data;
+		size_t len;
+		while(0U != (len = emunit_display_drain_get(&p_data)))
+		{
+			emunit_display_out_write(p_data, len);
+			emunit_display_drain_release(len);
+		}
+#else
+		emunit_display_out_write(
 			emunit_display_status.buffer,
 			emunit_display_status.w_ptr - emunit_display_status.buffer);
+#endif
 		emunit_port_out_deinit();
-		emunit_display_clear();
+#if EMUNIT_CONF_DISPLAY_DRAIN
+		/* Rewind only if there is no message in progress */
+		if(emunit_display_status.w_ptr == emunit_display_status.c_ptr)
+#endif
+		emunit_display_buffer_clear();
 	}
+#endif
 }
 
 
@@ -325,7 +1011,7 @@ void emunit_display_panic(
 	const __flash char * str_file,
 	unsigned int line)
 {
-	emunit_display_clear();
+	emunit_display_buffer_clear();
 	EMUNIT_DISPLAY_NAME(show_panic)(str_file, line);
 }
 
@@ -54,6 +54,29 @@
  */
 void emunit_display_clear(void);
 
+#if EMUNIT_CONF_DISPLAY_DRAIN || defined(__DOXYGEN__)
+/**
+ * @brief Get the data ready to be drained
+ *
+ * Function to be used by the port that sends the data in the background.
+ * It is the only consumer of the display buffer and may run concurrently
+ * with the tests.
+ *
+ * @param[out] pp_data The pointer to the data ready to be sent.
+ *
+ * @return Number of bytes that can be sent in one piece.
+ *         0 if there is nothing to send.
+ */
+size_t emunit_display_drain_get(char const ** pp_data);
+
+/**
+ * @brief Release drained data
+ *
+ * @param n Number of bytes sent after @ref emunit_display_drain_get call.
+ */
+void emunit_display_drain_release(size_t n);
+#endif
+
 /**
  * @brief Send the whole buffer to be displayed
  *
@@ -83,6 +106,49 @@ void emunit_display_panic(
 	const __flash char * str_file,
 	unsigned int line);
 
+#if EMUNIT_CONF_DISPLAY_DEFER || defined(__DOXYGEN__)
+#if EMUNIT_CONF_DISPLAY_QUIET || EMUNIT_CONF_DISPLAY_DRAIN
+#error "EMUNIT_CONF_DISPLAY_DEFER cannot be used with EMUNIT_CONF_DISPLAY_QUIET or EMUNIT_CONF_DISPLAY_DRAIN"
+#endif
+/**
+ * @name Deferred failure records
+ *
+ * Functions that store raw failure record instead of formatting the report.
+ * The report is formatted by @ref emunit_display_present after the restart
+ * and placed where the failure occurred.
+ * Assertions with message and string assertions are always formatted
+ * immediately, as their arguments may not survive the restart.
+ * @{
+ */
+/** Deferred version of @ref emunit_display_failed_assert */
+void emunit_display_defer_failed_assert(
+	const __flash emunit_assert_head_t * p_head,
+	const __flash char * str_expr);
+/** Deferred version of @ref emunit_display_failed_equal */
+void emunit_display_defer_failed_equal(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_num_t expected,
+	emunit_num_t actual);
+/** Deferred version of @ref emunit_display_failed_range */
+void emunit_display_defer_failed_range(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_num_t min,
+	emunit_num_t max,
+	emunit_num_t actual);
+/** Deferred version of @ref emunit_display_failed_delta */
+void emunit_display_defer_failed_delta(
+	const __flash emunit_assert_head_t * p_head,
+	emunit_unum_t delta,
+	emunit_num_t expected,
+	emunit_num_t actual);
+/** @} */
+
+/** Map the failure display functions that can be deferred */
+#define EMUNIT_DISPLAY_MAP_FAILED EMUNIT_DISPLAY_MAP_ASSERT_DEFER
+#else
+#define EMUNIT_DISPLAY_MAP_FAILED EMUNIT_DISPLAY_MAP_ASSERT
+#endif
+
 /**
  * @name Displaying functions
  *
@@ -154,13 +220,21 @@ EMUNIT_DISPLAY_MAP_VFUNC(tc_start, (void), ())
  */
 EMUNIT_DISPLAY_MAP_VFUNC(tc_end, (void), ())
 
+/**
+ * @brief Display test case interrupted
+ *
+ * Function called after the reset that was not requested by the engine
+ * in the middle of the test case, like watchdog or the crash of the process.
+ */
+EMUNIT_DISPLAY_MAP_VFUNC(failed_timeout, (void), ())
+
 /**
  * @brief Display assertion failed
  *
  * @param[in] p_head   Assertion header.
  * @param[in] str_expr String representing the expression.
  */
-EMUNIT_DISPLAY_MAP_ASSERT(failed_assert,
+EMUNIT_DISPLAY_MAP_FAILED(failed_assert,
 		(
 			const __flash emunit_assert_head_t * p_head,
 			const __flash char * str_expr
@@ -178,7 +252,7 @@ EMUNIT_DISPLAY_MAP_ASSERT(failed_assert,
  * @param expected Expected value.
  * @param actual   Actual value.
  */
-EMUNIT_DISPLAY_MAP_ASSERT(failed_equal,
+EMUNIT_DISPLAY_MAP_FAILED(failed_equal,
 		(
 			const __flash emunit_assert_head_t * p_head,
 			emunit_num_t expected,
@@ -199,7 +273,7 @@ EMUNIT_DISPLAY_MAP_ASSERT(failed_equal,
  * @param max    Maximal expected value.
  * @param actual Actual value.
  */
-EMUNIT_DISPLAY_MAP_ASSERT(failed_range,
+EMUNIT_DISPLAY_MAP_FAILED(failed_range,
 		(
 			const __flash emunit_assert_head_t * p_head,
 			emunit_num_t min,
@@ -222,7 +296,7 @@ EMUNIT_DISPLAY_MAP_ASSERT(failed_range,
  * @param expected The middle of the expected range.
  * @param actual   Actual value.
  */
-EMUNIT_DISPLAY_MAP_ASSERT(failed_delta,
+EMUNIT_DISPLAY_MAP_FAILED(failed_delta,
 		(
 			const __flash emunit_assert_head_t * p_head,
 			emunit_unum_t delta,
@@ -263,6 +337,51 @@ EMUNIT_DISPLAY_MAP_ASSERT(failed_nstr,
 			err_pos
 		)
 	)
+
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+/**
+ * @brief Display cycle budget assertion failed
+ *
+ * @param p_head   Assertion header.
+ * @param budget   Maximum duration allowed.
+ * @param measured Measured duration.
+ */
+EMUNIT_DISPLAY_MAP_ASSERT(failed_cycles,
+		(
+			const __flash emunit_assert_head_t * p_head,
+			emunit_timestamp_t budget,
+			emunit_timestamp_t measured
+		),
+		(
+			p_head,
+			budget,
+			measured
+		)
+	)
+
+/**
+ * @brief Display benchmark regression failed
+ *
+ * @param p_head   Benchmark entry header.
+ * @param baseline Baseline median.
+ * @param limit    Maximum median allowed.
+ * @param measured Measured median.
+ */
+EMUNIT_DISPLAY_MAP_VFUNC(failed_regression,
+		(
+			const __flash emunit_assert_head_t * p_head,
+			emunit_timestamp_t baseline,
+			emunit_timestamp_t limit,
+			emunit_timestamp_t measured
+		),
+		(
+			p_head,
+			baseline,
+			limit,
+			measured
+		)
+	)
+#endif
 /** @} */
 
 /** @} */
@@ -0,0 +1,193 @@
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief EMUnit output stream compression
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * This file is included by emunit_display.c, it is not compiled separately.
+ * The compressor uses only the port output function,
+ * so the host side tests may include it on its own.
+ *
+ * @sa emunit_display_lz_group
+ */
+/**
+ * @defgroup emunit_display_lz_group Output stream compression
+ * @ingroup emunit_display_internal_group
+ *
+ * Simple LZ compression of the display buffer before it is sent to the port.
+ *
+ * The compressed stream uses only printable ASCII and bytes above 0x7f,
+ * so the port conversion of the control characters never touches it:
+ *
+ * - 0x20 - 0x7f:           literal byte,
+ * - 0x80, b:               literal byte b (b >= 0x80),
+ * - 0x80, 0x40:            literal NUL character,
+ * - 0x81 - 0x9f:           literal control character (value - 0x80),
+ * - 0xa0 - 0xff, 0x80 | d: copy (value - 0xa0 + 3) bytes
+ *                          from (d + 1) bytes back in the output.
+ *
+ * The window is the display buffer itself, so the only RAM required
+ * is the hash table and output chunk placed on the stack.
+ * Matches never cross the flushed buffer boundary, so the decompressor
+ * can keep its history across the restarts.
+ * @{
+ */
+
+/** Minimal match length */
+#define EMUNIT_DISPLAY_LZ_MATCH_MIN 3
+/** Maximal match length */
+#define EMUNIT_DISPLAY_LZ_MATCH_MAX (EMUNIT_DISPLAY_LZ_MATCH_MIN + 0x5f)
+/** Maximal distance of the match */
+#define EMUNIT_DISPLAY_LZ_WINDOW    0x80
+/** First value of the match token */
+#define EMUNIT_DISPLAY_LZ_MATCH     0xa0
+/** Literal escape token */
+#define EMUNIT_DISPLAY_LZ_ESC       0x80
+/** Escaped NUL character, the escape token itself would collide with it */
+#define EMUNIT_DISPLAY_LZ_NUL       0x40
+/** Number of entries in the hash table */
+#define EMUNIT_DISPLAY_LZ_HASH_SIZE (1U << EMUNIT_CONF_DISPLAY_COMPRESS_HASH_BITS)
+
+/**
+ * @brief Compressor state
+ */
+typedef struct
+{
+	/** Last position + 1 of the given hash, 0 for none */
+	size_t hash[EMUNIT_DISPLAY_LZ_HASH_SIZE];
+	/** Output chunk */
+	char out[EMUNIT_CONF_DISPLAY_COMPRESS_CHUNK];
+	/** Number of bytes in the output chunk */
+	size_t out_n;
+}emunit_display_lz_t;
+
+/**
+ * @brief Put byte into compressor output
+ *
+ * @param p_lz Compressor state
+ * @param c    Byte to be sent
+ */
+static void emunit_display_lz_out(emunit_display_lz_t * p_lz, uint8_t c)
+{
+	p_lz->out[p_lz->out_n++] = (char)c;
+	if(sizeof(p_lz->out) <= p_lz->out_n)
+	{
+		emunit_port_out_write(p_lz->out, p_lz->out_n);
+		p_lz->out_n = 0;
+	}
+}
+
+/**
+ * @brief Calculate the hash of 3 bytes sequence
+ *
+ * @param p Pointer to the sequence
+ * @return Hash table index
+ */
+static inline size_t emunit_display_lz_hash(const uint8_t * p)
+{
+	uint16_t h = ((uint16_t)p[0] << 6) ^ ((uint16_t)p[1] << 3) ^ p[2];
+	h ^= h >> 7;
+	return h & (EMUNIT_DISPLAY_LZ_HASH_SIZE - 1U);
+}
+
+/**
+ * @brief Compress and write the buffer to the port
+ *
+ * @param p_str Data to be compressed
+ * @param len   Data length
+ */
+static void emunit_display_lz_write(const char * p_str, size_t len)
+{
+	const uint8_t * p = (const uint8_t *)p_str;
+	emunit_display_lz_t lz;
+	size_t i = 0;
+
+	memset(&lz, 0, sizeof(lz));
+	while(i < len)
+	{
+		size_t match_len = 0;
+		size_t dist = 0;
+		if(len - i >= EMUNIT_DISPLAY_LZ_MATCH_MIN)
+		{
+			const size_t h = emunit_display_lz_hash(p + i);
+			const size_t cand = lz.hash[h];
+			lz.hash[h] = i + 1U;
+			if(0U != cand)
+			{
+				const size_t max = EMUNIT_MIN(len - i, EMUNIT_DISPLAY_LZ_MATCH_MAX);
+				dist = i + 1U - cand;
+				if(dist <= EMUNIT_DISPLAY_LZ_WINDOW)
+				{
+					while((match_len < max) && (p[cand - 1U + match_len] == p[i + match_len]))
+					{
+						++match_len;
+					}
+				}
+			}
+		}
+
+		if(match_len >= EMUNIT_DISPLAY_LZ_MATCH_MIN)
+		{
+			emunit_display_lz_out(&lz, EMUNIT_DISPLAY_LZ_MATCH + (match_len - EMUNIT_DISPLAY_LZ_MATCH_MIN));
+			emunit_display_lz_out(&lz, 0x80U | (dist - 1U));
+			/* Update hash for all the positions covered by the match */
+			while(0U != --match_len)
+			{
+				++i;
+				if(len - i >= EMUNIT_DISPLAY_LZ_MATCH_MIN)
+				{
+					lz.hash[emunit_display_lz_hash(p + i)] = i + 1U;
+				}
+			}
+			++i;
+		}
+		else
+		{
+			const uint8_t c = p[i++];
+			if(c >= 0x80U)
+			{
+				emunit_display_lz_out(&lz, EMUNIT_DISPLAY_LZ_ESC);
+				emunit_display_lz_out(&lz, c);
+			}
+			else if(0U == c)
+			{
+				emunit_display_lz_out(&lz, EMUNIT_DISPLAY_LZ_ESC);
+				emunit_display_lz_out(&lz, EMUNIT_DISPLAY_LZ_NUL);
+			}
+			else if(c < 0x20U)
+			{
+				emunit_display_lz_out(&lz, EMUNIT_DISPLAY_LZ_ESC + c);
+			}
+			else
+			{
+				emunit_display_lz_out(&lz, c);
+			}
+		}
+	}
+	if(0U != lz.out_n)
+	{
+		emunit_port_out_write(lz.out, lz.out_n);
+	}
+}
+/** @} */
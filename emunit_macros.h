@@ -498,7 +498,41 @@
  * @return The name of the display file.
  */
 #define EMUNIT_DISPLAY_FILE(file_name, file_ext) \
-	EMUNIT_STR(display/EMUNIT_CN3(emunit_display_, EMUNIT_CONF_DISPLAY, file_name).file_ext)
+	EMUNIT_DISPLAY_FILE_OF(EMUNIT_DISPLAY_SELECTED, file_name, file_ext)
+
+/**
+ * @brief Maximum number of displays used at once
+ *
+ * @sa EMUNIT_CONF_DISPLAY_MULTI
+ */
+#define EMUNIT_DISPLAY_MULTI_MAX 4
+
+/**
+ * @def EMUNIT_DISPLAY_SELECTED
+ * @brief Selected display name
+ *
+ * The name of the display that implements the display interface.
+ * It is @c multi if @ref EMUNIT_CONF_DISPLAY_MULTI is set.
+ */
+#if EMUNIT_CONF_DISPLAY_MULTI
+#define EMUNIT_DISPLAY_SELECTED multi
+#else
+#define EMUNIT_DISPLAY_SELECTED EMUNIT_CONF_DISPLAY
+#endif
+
+/**
+ * @brief Source selector of the given display
+ *
+ * Works like @ref EMUNIT_DISPLAY_FILE but for any display.
+ *
+ * @param disp      The display name.
+ * @param file_name See @ref EMUNIT_DISPLAY_FILE.
+ * @param file_ext  See @ref EMUNIT_DISPLAY_FILE.
+ *
+ * @return The name of the display file.
+ */
+#define EMUNIT_DISPLAY_FILE_OF(disp, file_name, file_ext) \
+	EMUNIT_STR(display/EMUNIT_CN3(emunit_display_, disp, file_name).file_ext)
 
 /**
  * @brief Create display base name
@@ -527,7 +561,20 @@
  * @sa EMUNIT_DISPLAY_BASE_NAME
  */
 #define EMUNIT_DISPLAY_NAME(name) \
-	EMUNIT_DISPLAY_BASE_NAME(EMUNIT_CN3(EMUNIT_CONF_DISPLAY, _, name))
+	EMUNIT_DISPLAY_NAME_OF(EMUNIT_DISPLAY_SELECTED, name)
+
+/**
+ * @brief Create object name of the given display
+ *
+ * Works like @ref EMUNIT_DISPLAY_NAME but for any display.
+ *
+ * @param disp The display name.
+ * @param name The name of element to be created (function, variable, type).
+ *
+ * @return The name in a form \<display_prefix\>_\<name\>
+ */
+#define EMUNIT_DISPLAY_NAME_OF(disp, name) \
+	EMUNIT_DISPLAY_BASE_NAME(EMUNIT_CN3(disp, _, name))
 
 /**
  * @brief Create display void function map
@@ -589,6 +636,27 @@
 		name ## _msg,                                                                        \
 		(EMUNIT_DEBRACKET(args), const __flash char * emunit_p_fmt, va_list emunit_va_args), \
 		(EMUNIT_DEBRACKET(call_args), emunit_p_fmt, emunit_va_args))
+
+/**
+ * @brief Map assertions display functions with deferred formatting
+ *
+ * Works like @ref EMUNIT_DISPLAY_MAP_ASSERT but the function without message
+ * is mapped to the @c emunit_display_defer_ @c name function that stores
+ * raw failure record.
+ * The _msg function is still mapped directly to the selected display.
+ *
+ * @param name      The base name of assertion display function
+ * @param args      Arguments for the function prototype, in brackets.
+ * @param call_args Calling arguments in brackets.
+ */
+#define EMUNIT_DISPLAY_MAP_ASSERT_DEFER(name, args, call_args)                               \
+	static inline void EMUNIT_DISPLAY_BASE_NAME(name) args {                                 \
+		EMUNIT_DISPLAY_BASE_NAME(EMUNIT_CN2(defer_, name)) call_args;                        \
+	}                                                                                        \
+	EMUNIT_DISPLAY_MAP_VFUNC(                                                                \
+		name ## _msg,                                                                        \
+		(EMUNIT_DEBRACKET(args), const __flash char * emunit_p_fmt, va_list emunit_va_args), \
+		(EMUNIT_DEBRACKET(call_args), emunit_p_fmt, emunit_va_args))
 /** @} */
 
 /** @} */
@@ -174,6 +174,29 @@ int emunit_snprintf(
 	 * @param[in] len       Number of bytes to be sent.
 	 */
 	EMUNIT_PORT_MAP_VFUNC(out_write, (char const * p_str, size_t len), (p_str, len))
+
+	/**
+	 * @fn emunit_port_out_wait
+	 * @brief Wait for the display buffer to be drained
+	 *
+	 * Called only if @ref EMUNIT_CONF_DISPLAY_DRAIN is set and there is no
+	 * place in the display buffer.
+	 * The port that drains the buffer in the background just waits here.
+	 * Any other port has to send the buffer synchronously.
+	 */
+	EMUNIT_PORT_MAP_VFUNC(out_wait, (void), ())
+
+	/**
+	 * @fn emunit_port_out_select
+	 * @brief Select the output stream
+	 *
+	 * Called only if @ref EMUNIT_CONF_DISPLAY_MULTI is set,
+	 * before the data generated by the given display is sent.
+	 * Stream 0 is the default one.
+	 *
+	 * @param[in] stream The index of the display that generated the data.
+	 */
+	EMUNIT_PORT_MAP_VFUNC(out_select, (uint8_t stream), (stream))
 /** @} */
 
 /**
@@ -222,5 +245,40 @@ EMUNIT_PORT_MAP_VFUNC(tc_begin, (void), ())
  */
 EMUNIT_PORT_MAP_VFUNC(tc_end, (void), ())
 
+/**
+ * @fn emunit_port_ts_selected
+ * @brief Check if test suite should be run
+ *
+ * Function called before the test suite is started.
+ * Suites that are not selected are skipped without any output
+ * and are not counted in the test summary.
+ * It allows the port to split the test between many runners.
+ *
+ * @param suite_idx Test suite index.
+ *
+ * @retval true  Run the suite.
+ * @retval false Skip the suite.
+ */
+EMUNIT_PORT_MAP_TFUNC(bool, ts_selected, (size_t suite_idx), (suite_idx))
+
+#if (EMUNIT_CONF_TIMING && EMUNIT_CONF_BENCH_BASELINE) || defined(__DOXYGEN__)
+/**
+ * @fn emunit_port_bench_baseline
+ * @brief Get the baseline of the current benchmark
+ *
+ * Called if @ref EMUNIT_CONF_BENCH_BASELINE is set,
+ * after the current benchmark is measured.
+ * The port looks for the baseline recorded for the current test suite
+ * and test case names.
+ * Only the median and 90th percentile are used.
+ *
+ * @param[out] p_baseline The baseline of the benchmark.
+ *
+ * @retval true  Baseline found and written.
+ * @retval false There is no baseline for the benchmark, it is not checked.
+ */
+EMUNIT_PORT_MAP_TFUNC(bool, bench_baseline, (emunit_bench_t * p_baseline), (p_baseline))
+#endif
+
 /** @} */
 #endif /* EMUNIT_PORT_H_INCLUDED */
@@ -224,6 +224,15 @@ const __flash char * emunit_ts_name_get(size_t suite_idx);
  * @return Total number ot test suites.
  */
 size_t emunit_ts_total_count(void);
+/**
+ * @brief Get number of test suites selected by the port
+ *
+ * Only the suites selected by @ref emunit_port_ts_selected are run
+ * and counted in the test summary.
+ *
+ * @return Number of selected test suites.
+ */
+size_t emunit_ts_selected_count(void);
 /**
  * @brief Get total number of failed test suites
  *
@@ -242,6 +251,17 @@ size_t emunit_ts_failed_get(void);
  * @return Current number of passed test suites
  */
 size_t emunit_ts_passed_get(void);
+/**
+ * @brief Check if any test case in current test suite has failed
+ *
+ * The flag is updated after the failure is displayed.
+ * It means that while displaying the first failure in the suite
+ * it is still false.
+ *
+ * @retval true  At least one test case in current suite has failed
+ * @retval false No test case in current suite has failed till now
+ */
+bool emunit_ts_current_failed_get(void);
 
 /**
  * @brief Get currently running test case index
@@ -297,10 +317,51 @@ size_t emunit_tc_passed_get(void);
  *
  * Auxiliary function that travels all test suites to count
  * all tests cases in whole test.
+ * The benchmarks without budget are included
+ * if they have been compared with the baseline already.
  *
  * @return Total number of test cases
  */
 size_t emunit_tc_total_count(void);
+/**
+ * @brief Count test cases in the suites selected by the port
+ *
+ * The test cases counted in the summary of the test
+ * that runs only the suites selected by @ref emunit_port_ts_selected.
+ * The benchmarks without budget are included
+ * if they have been compared with the baseline already.
+ *
+ * @return Number of test cases in the selected suites
+ */
+size_t emunit_tc_selected_count(void);
+
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+/**
+ * @brief Get the durations of the current test case
+ *
+ * The durations are complete when the test case end is displayed.
+ *
+ * @return The pointer to the durations or NULL if the test case
+ *         was not measured (it was interrupted by the reset).
+ */
+const emunit_time_t * emunit_tc_time_get(void);
+/**
+ * @brief Get the durations of the current test suite
+ *
+ * The durations of all the measured test cases in the current suite summed.
+ *
+ * @return The pointer to the durations.
+ */
+const emunit_time_t * emunit_ts_time_get(void);
+
+/**
+ * @brief Get the current benchmark results
+ *
+ * @return The pointer to the results or NULL if the current test case
+ *         is not a benchmark or it has not finished.
+ */
+const emunit_bench_t * emunit_tc_bench_get(void);
+#endif
 /** @} */
 
 
@@ -115,6 +115,19 @@ typedef enum
 	EMUNIT_RR_RUN,     /**< Run currently selected test case. */
 }emunit_rr_t;
 
+/**
+ * @brief Result of the current test case
+ *
+ * Kept over the restart, so the test case interrupted after its result
+ * has been counted is not counted again.
+ */
+typedef enum
+{
+	EMUNIT_TC_RESULT_NONE,   /**< The result is not counted yet     */
+	EMUNIT_TC_RESULT_PASSED, /**< The test case is counted as passed */
+	EMUNIT_TC_RESULT_FAILED, /**< The test case is counted as failed */
+}emunit_tc_result_t;
+
 /**
  * @brief Display types for numeric values
  *
@@ -190,6 +203,28 @@ typedef struct
  */
 typedef void (*emunit_test_fnc)(void);
 
+/**
+ * @brief Benchmark descriptor
+ *
+ * Additional parameters of the test case that is a benchmark.
+ *
+ * @sa UT_DESC_BENCH
+ */
+typedef struct
+{
+	/** Header used to report the exceeded budget or the regression */
+	const __flash emunit_assert_head_t * p_head;
+	/** Maximum median duration of a single operation */
+	emunit_timestamp_t budget;
+}emunit_bench_desc_t;
+
+/**
+ * @brief The budget value of the benchmark without budget
+ *
+ * @sa UT_DESC_BENCH
+ */
+#define EMUNIT_BENCH_BUDGET_NONE ((emunit_timestamp_t)-1)
+
 /**
  * @brief Test descriptor
  *
@@ -200,6 +235,10 @@ typedef struct
 {
 	char __flash const * p_name; //!< The pointer to the name of the test case
 	emunit_test_fnc      p_fnc; //!< Test function pointer
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+	/** Benchmark parameters, NULL for the normal test case */
+	const __flash emunit_bench_desc_t * p_bench;
+#endif
 }emunit_test_desc_t;
 
 /**
@@ -299,6 +338,64 @@ typedef struct
 	#define UT_DESC_TC(fnc) \
 	    {(const __flash char[]){EMUNIT_STR(fnc)}, fnc},
 
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+	/**
+	 * @brief Macro for benchmark description entry
+	 *
+	 * The function is called repeatedly without restarts.
+	 * The number of calls is calibrated to get the sample of
+	 * @ref EMUNIT_CONF_BENCH_TARGET duration and
+	 * @ref EMUNIT_CONF_BENCH_SAMPLES samples are measured.
+	 * The statistic of the single call duration is presented in the results.
+	 *
+	 * The benchmark is not counted as passed or failed test case
+	 * unless the assertion inside fails
+	 * or @ref EMUNIT_CONF_BENCH_BASELINE is set and the port has its baseline.
+	 *
+	 * @param fnc The benchmarked function of the @ref emunit_test_fnc type.
+	 */
+	#define UT_DESC_BENCH(fnc) \
+	    EMUNIT_DESC_BENCH(fnc, EMUNIT_BENCH_BUDGET_NONE)
+
+	/**
+	 * @brief Macro for benchmark with budget description entry
+	 *
+	 * The benchmark that is counted as normal test case.
+	 * It fails if the median duration of the single call exceeds the budget.
+	 * The failure is reported as the cycle budget assertion
+	 * placed in the line of this entry.
+	 *
+	 * @param fnc    The benchmarked function of the @ref emunit_test_fnc type.
+	 * @param budget Maximum median duration of the single call.
+	 *
+	 * @sa UT_DESC_BENCH
+	 */
+	#define UT_DESC_BENCH_BUDGET(fnc, budget) \
+	    EMUNIT_DESC_BENCH(fnc, budget)
+
+	/**
+	 * @brief Internal benchmark description entry
+	 *
+	 * The header points to the line of this entry,
+	 * where the budget or regression failure is reported.
+	 *
+	 * @param fnc    The benchmarked function.
+	 * @param budget Maximum median duration of the single call
+	 *               or @ref EMUNIT_BENCH_BUDGET_NONE.
+	 */
+	#define EMUNIT_DESC_BENCH(fnc, budget)                                            \
+	    {(const __flash char[]){EMUNIT_STR(fnc)}, fnc,                               \
+	        (const __flash emunit_bench_desc_t[]){{                                  \
+	            (const __flash emunit_assert_head_t[]){{                             \
+	                (const __flash char[]){__FILE__},                                \
+	                __LINE__,                                                        \
+	                EMUNIT_CN2(EMUNIT_NUMTYPE_U, EMUNIT_CONF_NUMBER_SIZE)            \
+	            }},                                                                  \
+	            (budget)                                                             \
+	        }}                                                                       \
+	    },
+#endif
+
 	/**
 	 * @brief Declare the test suite descriptor externally
 	 *
@@ -348,6 +445,51 @@ typedef struct
 	#define UT_MAIN_TS_ENTRY(ts_name) (UT_DESC_TS_VARNAME(ts_name)),
 /** @} */
 
+/**
+ * @brief Display buffer usage statistic
+ *
+ * The statistic collected during the whole test to help with
+ * @ref EMUNIT_CONF_BUFFER_SIZE selection.
+ */
+typedef struct
+{
+	size_t used_max;           /**< Maximum buffer usage in the whole test                */
+	size_t tc_used_max;        /**< Maximum buffer usage in single test case              */
+	size_t tc_used_max_ts;     /**< Suite index of the test case with maximum usage       */
+	size_t tc_used_max_tc;     /**< Index of the test case with maximum usage             */
+	size_t tc_n_near_overflow; /**< Number of test cases near the buffer overflow         */
+}emunit_display_usage_t;
+
+/**
+ * @brief Deferred failure record type
+ */
+typedef enum
+{
+	EMUNIT_DISPLAY_RECORD_NONE = 0, /**< No failure record stored    */
+	EMUNIT_DISPLAY_RECORD_ASSERT,   /**< Boolean assertion failed     */
+	EMUNIT_DISPLAY_RECORD_EQUAL,    /**< Equal assertion failed       */
+	EMUNIT_DISPLAY_RECORD_RANGE,    /**< Range assertion failed       */
+	EMUNIT_DISPLAY_RECORD_DELTA     /**< Delta assertion failed       */
+}emunit_display_record_type_t;
+
+/**
+ * @brief Deferred failure record
+ *
+ * Raw failure data stored when the assertion fails.
+ * The report is formatted after the restart.
+ */
+typedef struct
+{
+	const __flash emunit_assert_head_t * p_head; /**< Assertion header                        */
+	const __flash char * str_expr;               /**< Expression string                       */
+	emunit_num_t val[3];                         /**< Values in display function argument order */
+	size_t pos;                                  /**< Report position in the display buffer   */
+	size_t tc_used;                              /**< Test case buffer usage without the report */
+	size_t tc_free;                              /**< Free space at the test case end without the report */
+	bool tc_registered;                          /**< Test case usage registered before the report is formatted */
+	emunit_display_record_type_t type;           /**< Record type                             */
+}emunit_display_record_t;
+
 /**
  * @brief Display status
  *
@@ -358,10 +500,59 @@ typedef struct
  */
 typedef struct
 {
-	char buffer[EMUNIT_CONF_BUFFER_SIZE]; /**< Display buffer        */
-	char * w_ptr;                         /**< Current write pointer */
+	char buffer[EMUNIT_CONF_BUFFER_SIZE]; /**< Display buffer                 */
+	char * w_ptr;                         /**< Current write pointer          */
+#if EMUNIT_CONF_DISPLAY_DRAIN || defined(__DOXYGEN__)
+	char * volatile c_ptr;                /**< Committed data end             */
+	char * volatile r_ptr;                /**< Drain read pointer             */
+	char * volatile e_ptr;                /**< Data end before buffer wrap    */
+#endif
+	emunit_display_usage_t usage;         /**< Buffer usage statistic         */
+#if EMUNIT_CONF_DISPLAY_QUIET || defined(__DOXYGEN__)
+	bool tc_opened;                       /**< Test case header already printed in quiet mode */
+#endif
+#if EMUNIT_CONF_DISPLAY_DEFER || defined(__DOXYGEN__)
+	emunit_display_record_t record;       /**< Deferred failure record        */
+#endif
+#if EMUNIT_CONF_DISPLAY_MULTI || defined(__DOXYGEN__)
+	char * region_w_ptr[EMUNIT_CONF_DISPLAY_MULTI]; /**< Write pointers of all the regions */
+	uint8_t region;                       /**< Currently selected region      */
+	bool tc_near_overflow;                /**< Current test case already counted as near overflow */
+#endif
 }emunit_display_status_t;
 
+/**
+ * @brief Test case durations
+ *
+ * Durations of the test case parts measured by the architecture timestamp.
+ * The unit is given by @c EMUNIT_TIMESTAMP_UNIT.
+ *
+ * @sa EMUNIT_CONF_TIMING
+ */
+typedef struct
+{
+	emunit_timestamp_t init;    /**< Test initialisation function duration */
+	emunit_timestamp_t test;    /**< Test function duration                */
+	emunit_timestamp_t cleanup; /**< Test cleanup function duration        */
+}emunit_time_t;
+
+/**
+ * @brief Benchmark results
+ *
+ * The statistic of the single operation duration over all the samples.
+ * The unit is given by @c EMUNIT_TIMESTAMP_UNIT.
+ *
+ * @sa UT_DESC_BENCH
+ */
+typedef struct
+{
+	uint32_t iterations;       /**< Number of operations in every sample */
+	emunit_timestamp_t min;    /**< The fastest sample                   */
+	emunit_timestamp_t median; /**< Median                               */
+	emunit_timestamp_t p90;    /**< 90th percentile                      */
+	emunit_timestamp_t p99;    /**< 99th percentile                      */
+}emunit_bench_t;
+
 /**
  * @brief Valid configuration key
  *
@@ -416,10 +607,30 @@ typedef struct
 	size_t tc_n_failed;
 	/** @brief Number of test cases passed */
 	size_t tc_n_passed;
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+	/** @brief Durations of the current test case */
+	emunit_time_t tc_time;
+	/** @brief Durations of the test cases in the current suite summed */
+	emunit_time_t ts_time;
+	/** @brief Timestamp of the current test case part start */
+	emunit_timestamp_t time_start;
+	/** Flag that marks that the durations of the current test case are valid */
+	bool tc_time_valid;
+	/** @brief Results of the current benchmark */
+	emunit_bench_t tc_bench;
+	/** Flag that marks that the current test case is a finished benchmark */
+	bool tc_bench_valid;
+	/** Flag that marks that the current benchmark without budget has been compared with its baseline */
+	bool tc_bench_compared;
+	/** @brief Number of benchmarks without budget compared with their baselines, counted as test cases */
+	size_t tc_n_compared;
+#endif
 	/** Flag that marks that any test failed in current suite */
 	bool ts_current_failed;
 	/** Flag that marks that current test has been initialised and requires cleanup */
 	bool tc_current_cleanup_required;
+	/** @brief The result of the current test case that has been counted */
+	emunit_tc_result_t tc_current_result;
 	/** @brief Reset reason internal status */
 	emunit_rr_t rr;
 }emunit_status_t;
@@ -0,0 +1,103 @@
+#ifndef CONFIG_EMUNIT_QEMUARM_H_INCLUDED
+#define CONFIG_EMUNIT_QEMUARM_H_INCLUDED
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief EMUnit QEMU ARM port configuration
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * File with EMUnit configuration for QEMU ARM port.
+ * @sa config_emunit_qemuarm_group
+ */
+
+/**
+ * @defgroup config_emunit_qemuarm_group <config_emunit_qemuarm.h> EMUnit QEMU ARM port configuration
+ * @{
+ * @ingroup config_emunit_group
+ *
+ * Default EMUnit configuration for QEMU ARM port.
+ * All values here can be overwritten by global definitions.
+ */
+
+/** @brief Output through the semihosting */
+#define EMUNIT_PORT_QEMUARM_OUT_SEMIHOST 0
+/** @brief Output through the CMSDK APB UART */
+#define EMUNIT_PORT_QEMUARM_OUT_UART     1
+
+/**
+ * @brief Selected output
+ *
+ * One of the values:
+ * - @ref EMUNIT_PORT_QEMUARM_OUT_SEMIHOST
+ * - @ref EMUNIT_PORT_QEMUARM_OUT_UART
+ *
+ * The semihosting is always used to finish the test
+ * and to write the cycles file.
+ */
+#ifndef EMUNIT_PORT_QEMUARM_OUT
+#define EMUNIT_PORT_QEMUARM_OUT EMUNIT_PORT_QEMUARM_OUT_SEMIHOST
+#endif
+
+/**
+ * @brief UART base address
+ *
+ * The UART0 of the mps2 boards.
+ */
+#ifndef EMUNIT_PORT_QEMUARM_UART_BASE
+#define EMUNIT_PORT_QEMUARM_UART_BASE 0x40004000UL
+#endif
+
+/**
+ * @brief Output stream change marker
+ *
+ * Character sent before the stream index digit when the output stream changes.
+ * Used only with the UART output if @ref EMUNIT_CONF_DISPLAY_MULTI is set.
+ * The semihosting output writes every stream into its own file.
+ */
+#ifndef EMUNIT_PORT_QEMUARM_STREAM_MARK
+#define EMUNIT_PORT_QEMUARM_STREAM_MARK '\x1e'
+#endif
+
+/**
+ * @brief Host file name format of the additional output streams
+ *
+ * Used with the semihosting output if @ref EMUNIT_CONF_DISPLAY_MULTI is set.
+ * Stream 0 is written to the host stdout.
+ */
+#ifndef EMUNIT_PORT_QEMUARM_STREAM_FILE
+#define EMUNIT_PORT_QEMUARM_STREAM_FILE "emunit_stream%u.out"
+#endif
+
+/**
+ * @brief Host file with the test case cycles
+ *
+ * The number of cycles of every test case is written here in CSV format.
+ * Set it to empty string to disable the cycles file.
+ */
+#ifndef EMUNIT_PORT_QEMUARM_CYCLES_FILE
+#define EMUNIT_PORT_QEMUARM_CYCLES_FILE "emunit_cycles.csv"
+#endif
+
+/** @} */
+#endif /* CONFIG_EMUNIT_QEMUARM_H_INCLUDED */
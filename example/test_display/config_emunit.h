@@ -0,0 +1,309 @@
+#ifndef CONFIG_EMUNIT_H_INCLUDED
+#define CONFIG_EMUNIT_H_INCLUDED
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief EMUnit configuration
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2016
+ *
+ * File with EMUnit configuration.
+ * @sa config_emunit_group
+ */
+
+/**
+ * @defgroup config_emunit_group <config_emunit> EMUnit configuration
+ * @{
+ * @ingroup emunit_group
+ *
+ * Default EMUnit configuration.
+ * All values here can be overwritten by global definitions.
+ * @{
+ */
+
+#ifndef EMUNIT_CONF_PORT
+/**
+ * @brief Selected port
+ *
+ * The name od the selected port.
+ */
+#define EMUNIT_CONF_PORT pcstdout
+#endif
+
+#ifndef EMUNIT_CONF_DISPLAY
+/**
+ * @brief Selected logger
+ *
+ * The name of the selected output logger.
+ */
+#define EMUNIT_CONF_DISPLAY xml
+#endif
+
+#ifndef EMUNIT_CONF_DISPLAY_MULTI
+/**
+ * @brief Number of displays used at once
+ *
+ * If set to 0 only the display selected by @ref EMUNIT_CONF_DISPLAY is used.
+ * Otherwise every event is presented by the displays from
+ * @ref EMUNIT_CONF_DISPLAY_MULTI_0 up to EMUNIT_CONF_DISPLAY_MULTI_3,
+ * each one in its own part of the display buffer.
+ * Maximum value is 4.
+ */
+#define EMUNIT_CONF_DISPLAY_MULTI 0
+#endif
+
+#ifndef EMUNIT_CONF_DISPLAY_MULTI_0
+/**
+ * @brief The first display used by @ref EMUNIT_CONF_DISPLAY_MULTI
+ *
+ * Its output is sent to the port stream 0.
+ * Next displays are named EMUNIT_CONF_DISPLAY_MULTI_1 and so on.
+ */
+#define EMUNIT_CONF_DISPLAY_MULTI_0 xml
+#endif
+
+#ifndef EMUNIT_CONF_DISPLAY_MULTI_1
+/**
+ * @brief The second display used by @ref EMUNIT_CONF_DISPLAY_MULTI
+ */
+#define EMUNIT_CONF_DISPLAY_MULTI_1 json
+#endif
+
+#ifndef EMUNIT_CONF_DISPLAY_NL
+/**
+ * @brief Display new line style
+ *
+ * The string used as a new line marker
+ */
+#define EMUNIT_CONF_DISPLAY_NL "\n"
+#endif
+
+#ifndef EMUNIT_CONF_DISPLAY_TABS
+/**
+ * @brief Display indentation
+ *
+ * Set to 0 to remove all tabulators used for output indentation.
+ */
+#define EMUNIT_CONF_DISPLAY_TABS 1
+#endif
+
+#ifndef EMUNIT_CONF_DISPLAY_QUIET
+/**
+ * @brief Quiet output profile
+ *
+ * If set to 1, passing test cases and test suites without failures
+ * generate no output at all.
+ * Only failures and the test summary are presented.
+ */
+#define EMUNIT_CONF_DISPLAY_QUIET 0
+#endif
+
+#ifndef EMUNIT_CONF_BUFFER_SIZE
+/**
+ * @brief The size of internal buffer
+ *
+ * The size of the buffer that is filled when test is ongoing.
+ * This buffer would be printed out when test is finished and MCU is restarted.
+ */
+#define EMUNIT_CONF_BUFFER_SIZE 1024
+#endif
+
+#ifndef EMUNIT_CONF_DISPLAY_DRAIN
+/**
+ * @brief Drain the display buffer while the test is running
+ *
+ * If set the display buffer works as a single producer, single consumer ring.
+ * The port may send the data in the background and the output is
+ * not limited by @ref EMUNIT_CONF_BUFFER_SIZE.
+ * Only a single message has to fit into the buffer.
+ */
+#define EMUNIT_CONF_DISPLAY_DRAIN 0
+#endif
+
+#ifndef EMUNIT_CONF_DISPLAY_DEFER
+/**
+ * @brief Defer failure formatting
+ *
+ * If set the failing assertion stores only the raw record in the display status.
+ * The report is formatted after the restart, before the buffer is sent.
+ * Assertions with message and string assertions are formatted immediately.
+ */
+#define EMUNIT_CONF_DISPLAY_DEFER 0
+#endif
+
+#ifndef EMUNIT_CONF_BUFFER_MARGIN
+/**
+ * @brief Display buffer safety margin
+ *
+ * Test case that leaves less than this number of bytes free
+ * in the display buffer is marked as near the buffer overflow.
+ * The margin should be big enough to place the warning itself.
+ */
+#define EMUNIT_CONF_BUFFER_MARGIN 128
+#endif
+
+#ifndef EMUNIT_CONF_DISPLAY_BUFFER_STAT
+/**
+ * @brief Show the display buffer usage statistic
+ *
+ * If set the buffer usage statistic is added to the test summary.
+ * Note that it requires more space in the display buffer for the summary.
+ */
+#define EMUNIT_CONF_DISPLAY_BUFFER_STAT 1
+#endif
+
+#ifndef EMUNIT_CONF_TIMING
+/**
+ * @brief Measure the test case duration
+ *
+ * If set the test case init, test and cleanup functions are timed
+ * by the architecture timestamp and the durations are added to the output,
+ * for every test case and summed for every test suite.
+ * On AVR the Timer1 is used and cannot be used by the tested code.
+ */
+#define EMUNIT_CONF_TIMING 0
+#endif
+
+#ifndef EMUNIT_CONF_BENCH_SAMPLES
+/**
+ * @brief Number of the samples measured for every benchmark
+ *
+ * The samples are sorted on the stack to get the median and percentiles.
+ * Used only if @ref EMUNIT_CONF_TIMING is set.
+ */
+#define EMUNIT_CONF_BENCH_SAMPLES 16
+#endif
+
+#ifndef EMUNIT_CONF_BENCH_TARGET
+/**
+ * @brief Target duration of a single benchmark sample
+ *
+ * The number of benchmark function calls in the sample is doubled
+ * until the sample takes at least that long.
+ * Given in the timestamp unit, the default is set by the architecture.
+ */
+#define EMUNIT_CONF_BENCH_TARGET EMUNIT_ARCH_BENCH_TARGET
+#endif
+
+#ifndef EMUNIT_CONF_BENCH_BASELINE
+/**
+ * @brief Compare the benchmarks with the baseline
+ *
+ * If set the port is asked for the baseline of every benchmark
+ * and the benchmark median that regressed is reported as a failure.
+ * The benchmark without the budget is counted as a normal test case
+ * if the port has its baseline.
+ * The PC ports read the baseline file, the target ports have no baseline:
+ * their results are checked by the tools/emunit_baseline.py host tool.
+ * Used only if @ref EMUNIT_CONF_TIMING is set.
+ */
+#define EMUNIT_CONF_BENCH_BASELINE 0
+#endif
+
+#ifndef EMUNIT_CONF_BENCH_THRESHOLD
+/**
+ * @brief Allowed benchmark median increase in percent
+ *
+ * The increase over the baseline median that is not a regression.
+ * @sa EMUNIT_CONF_BENCH_NOISE
+ */
+#define EMUNIT_CONF_BENCH_THRESHOLD 10
+#endif
+
+#ifndef EMUNIT_CONF_BENCH_NOISE
+/**
+ * @brief Allowed benchmark median increase in the baseline spreads
+ *
+ * The spread is the distance between the baseline median and 90th percentile.
+ * The larger of this and @ref EMUNIT_CONF_BENCH_THRESHOLD increase is allowed,
+ * so the noisy benchmark does not fail randomly.
+ * 0 disables the noise adjustment.
+ */
+#define EMUNIT_CONF_BENCH_NOISE 1
+#endif
+
+#ifndef EMUNIT_CONF_NUMBER_SIZE
+/**
+ * @brief The maximum supported number size
+ *
+ * It has to be just a number because it would be connected to create
+ * default type for numeric comparations.
+ */
+#define EMUNIT_CONF_NUMBER_SIZE 32
+#endif
+
+#ifndef EMUNIT_CONF_STRLEN_LIMIT
+/**
+ * @brief Maximum displayed string limitation
+ *
+ * Maximum number of string characters that would be presented when comparing
+ * strings.
+ */
+#define EMUNIT_CONF_STRLEN_LIMIT 32
+#endif
+
+#ifndef EMUNIT_CONF_ASSERT_SIZE_CHECK
+/**
+ * @brief Check assertion output size at compile time
+ *
+ * If set every assertion checks statically if the worst-case failure report
+ * fits in @ref EMUNIT_CONF_BUFFER_SIZE.
+ * The parts known only at runtime, like the message, are not counted.
+ */
+#define EMUNIT_CONF_ASSERT_SIZE_CHECK 1
+#endif
+
+#ifndef EMUNIT_CONF_DISPLAY_COMPRESS
+/**
+ * @brief Compress the output stream
+ *
+ * If set to 1, the display buffer is compressed by simple LZ scheme
+ * before it is sent to the port.
+ * Use tools/emunit_unlz.py on the host side to restore the text.
+ */
+#define EMUNIT_CONF_DISPLAY_COMPRESS 0
+#endif
+
+#ifndef EMUNIT_CONF_DISPLAY_COMPRESS_HASH_BITS
+/**
+ * @brief Number of bits in compressor hash
+ *
+ * The compressor uses a table of (1 << EMUNIT_CONF_DISPLAY_COMPRESS_HASH_BITS)
+ * buffer indexes placed on the stack.
+ * Bigger table gives better compression for the price of RAM.
+ */
+#define EMUNIT_CONF_DISPLAY_COMPRESS_HASH_BITS 6
+#endif
+
+#ifndef EMUNIT_CONF_DISPLAY_COMPRESS_CHUNK
+/**
+ * @brief Size of the compressor output chunk
+ *
+ * Compressed data is collected on the stack and sent to the port
+ * in chunks of this size.
+ */
+#define EMUNIT_CONF_DISPLAY_COMPRESS_CHUNK 32
+#endif
+
+/** @} */
+#endif /* CONFIG_EMUNIT_H_INCLUDED */
@@ -0,0 +1,108 @@
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief Output stream compression round trip test
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * Compresses the data containing every byte value and writes the stream
+ * to the standard output, to be restored by tools/emunit_unlz.py.
+ * The original data is written to the file given as the only argument.
+ *
+ * The compressor is included directly, the port output function
+ * is replaced by the one that checks the compressed stream.
+ */
+#include <emunit.h>
+#include <emunit_port.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief Port output replacement
+ *
+ * Writes the compressed stream to the standard output.
+ * The stream cannot contain any control character.
+ */
+void emunit_port_pcstdout_out_write(char const * p_str, size_t len)
+{
+	size_t n;
+	for(n = 0; n < len; ++n)
+	{
+		if((uint8_t)p_str[n] < 0x20U)
+		{
+			fprintf(stderr, "Control character 0x%02x in the compressed stream\n", (uint8_t)p_str[n]);
+			exit(1);
+		}
+	}
+	fwrite(p_str, 1, len, stdout);
+}
+
+#include "emunit_display_lz.c"
+
+int main(int argc, char * argv[])
+{
+	static char data[4 * 256 + 4 * 96];
+	size_t len = 0;
+	size_t n;
+	FILE * p_f;
+
+	if(2 != argc)
+	{
+		fprintf(stderr, "Usage: %s <original data file>\n", argv[0]);
+		return -1;
+	}
+	/* Every byte value */
+	for(n = 0; n < 256U; ++n)
+		data[len++] = (char)n;
+	/* The same in reverse order, so the values are compressed as matches too */
+	for(n = 0; n < 256U; ++n)
+		data[len++] = (char)(255U - n);
+	for(n = 0; n < 256U; ++n)
+		data[len++] = (char)(255U - n);
+	/* Every byte value after the escape token value */
+	for(n = 0; n < 128U; ++n)
+	{
+		data[len++] = (char)EMUNIT_DISPLAY_LZ_ESC;
+		data[len++] = (char)n;
+	}
+	/* Long runs of the special values */
+	memset(data + len, 0, 96);
+	len += 96;
+	memset(data + len, EMUNIT_DISPLAY_LZ_ESC, 96);
+	len += 96;
+	memset(data + len, EMUNIT_DISPLAY_LZ_MATCH, 96);
+	len += 96;
+	memset(data + len, EMUNIT_DISPLAY_LZ_NUL, 96);
+	len += 96;
+
+	p_f = fopen(argv[1], "wb");
+	if((NULL == p_f) || (len != fwrite(data, 1, len, p_f)) || (0 != fclose(p_f)))
+	{
+		perror(argv[1]);
+		return -1;
+	}
+	/* Two flushes, the second one uses the history of the first one */
+	emunit_display_lz_write(data, len / 2U);
+	emunit_display_lz_write(data + len / 2U, len - len / 2U);
+	return 0;
+}
@@ -0,0 +1,218 @@
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief Display self-test
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * Test cases that generate every kind of the display output.
+ * The same program is built with different display configurations
+ * and the outputs are compared by the check target of the makefile.
+ *
+ * The fault suite is built only for the checks that need it,
+ * see @ref TEST_FAULT_HANG, @ref TEST_FAULT_CRASH and @ref TEST_FAULT_BENCH.
+ */
+#include <emunit.h>
+#include <stdlib.h>
+
+/**
+ * @brief Build the test case that never finishes
+ *
+ * Used to check the port test case timeout.
+ */
+#ifndef TEST_FAULT_HANG
+#define TEST_FAULT_HANG 0
+#endif
+
+/**
+ * @brief Build the suite which cleanup crashes
+ *
+ * Used to check that the test case interrupted after its result
+ * has been counted is counted once.
+ * Requires the port that resumes the test after the crash.
+ */
+#ifndef TEST_FAULT_CRASH
+#define TEST_FAULT_CRASH 0
+#endif
+
+/**
+ * @brief Build the benchmarks without the budget
+ *
+ * Used to check that the failed benchmark that is not counted
+ * does not change the summary.
+ * Requires @ref EMUNIT_CONF_TIMING.
+ */
+#ifndef TEST_FAULT_BENCH
+#define TEST_FAULT_BENCH 0
+#endif
+
+
+void test_init(void)
+{
+
+}
+
+void test_cleanup(void)
+{
+
+}
+
+void test_passed(void)
+{
+	UT_ASSERT(true);
+	UT_ASSERT_EQUAL(7, 4+3);
+	UT_ASSERT_RANGE(100, 200, 150);
+	UT_ASSERT_DELTA(8, 12, 4);
+}
+
+void test_assert(void)
+{
+	UT_ASSERT(1 == 2);
+}
+
+void test_assert_long(void)
+{
+	/* Written without spaces, so almost every character
+	 * of the expression is replaced by the entity */
+	volatile bool x = false;
+	UT_ASSERT(
+		x&&x&&x&&x&&x&&x&&x&&x&&x&&x&&
+		x&&x&&x&&x&&x&&x&&x&&x&&x&&x&&
+		x&&x&&x&&x&&x&&x&&x&&x&&x&&x);
+}
+
+void test_assert_msg(void)
+{
+	UT_ASSERT_MSG(false, "Test entities: <&> may be failed %u times", 10u);
+}
+
+void test_equal(void)
+{
+	UT_ASSERT_EQUAL(7, 4);
+}
+
+void test_range(void)
+{
+	UT_ASSERT_RANGE(100, 200, 201);
+}
+
+void test_delta(void)
+{
+	UT_ASSERT_DELTA(8, 300, 309);
+}
+
+void test_str(void)
+{
+	char some_buffer[] = "1]]>2]]>3]]>4]]>5]]>6]]>7]]>8]]>9]]>0]]>";
+	UT_ASSERT_EQUAL_STR(EMUNIT_FLASHSTR("1]]>2]]>3]]>4]]>5]]>6]]>7]]>8]]>9]]>0]]!"), some_buffer);
+}
+
+#if TEST_FAULT_HANG || defined(__DOXYGEN__)
+void test_hang(void)
+{
+	volatile bool hang = true;
+	while(hang)
+	{
+		/* Waiting for the timeout */
+	}
+}
+#endif
+
+#if TEST_FAULT_CRASH || defined(__DOXYGEN__)
+void crash_cleanup(void)
+{
+	abort();
+}
+#endif
+
+#if TEST_FAULT_BENCH || defined(__DOXYGEN__)
+void test_bench_passed(void)
+{
+	volatile unsigned int cnt = 10;
+	while(cnt--)
+	{
+		/* Busy loop to be measured */
+	}
+}
+
+void test_bench_failed(void)
+{
+	UT_ASSERT(1 == 2);
+}
+#endif
+
+/* test_file.c */
+void test_file_name(void);
+
+
+UT_DESC_TS_BEGIN(display_suite, NULL, NULL, test_init, test_cleanup)
+	UT_DESC_TC(test_passed)
+	UT_DESC_TC(test_assert)
+	UT_DESC_TC(test_assert_long)
+	UT_DESC_TC(test_assert_msg)
+	UT_DESC_TC(test_equal)
+	UT_DESC_TC(test_range)
+	UT_DESC_TC(test_delta)
+	UT_DESC_TC(test_str)
+	UT_DESC_TC(test_file_name)
+UT_DESC_TS_END();
+
+UT_DESC_TS_BEGIN(passed_suite, NULL, NULL, NULL, NULL)
+	UT_DESC_TC(test_passed)
+UT_DESC_TS_END();
+
+#if TEST_FAULT_HANG
+UT_DESC_TS_BEGIN(fault_suite, NULL, NULL, NULL, NULL)
+	UT_DESC_TC(test_hang)
+	UT_DESC_TC(test_passed)
+UT_DESC_TS_END();
+#endif
+
+#if TEST_FAULT_CRASH
+UT_DESC_TS_BEGIN(crash_suite, NULL, NULL, NULL, crash_cleanup)
+	UT_DESC_TC(test_passed)
+	UT_DESC_TC(test_assert)
+UT_DESC_TS_END();
+#endif
+
+#if TEST_FAULT_BENCH
+UT_DESC_TS_BEGIN(bench_suite, NULL, NULL, NULL, NULL)
+	UT_DESC_BENCH(test_bench_passed)
+	UT_DESC_BENCH(test_bench_failed)
+UT_DESC_TS_END();
+#endif
+
+
+UT_MAIN_TS_BEGIN()
+	UT_MAIN_TS_ENTRY(display_suite)
+	UT_MAIN_TS_ENTRY(passed_suite)
+#if TEST_FAULT_HANG
+	UT_MAIN_TS_ENTRY(fault_suite)
+#endif
+#if TEST_FAULT_CRASH
+	UT_MAIN_TS_ENTRY(crash_suite)
+#endif
+#if TEST_FAULT_BENCH
+	UT_MAIN_TS_ENTRY(bench_suite)
+#endif
+UT_MAIN_TS_END();
@@ -0,0 +1,61 @@
+# -*- coding: utf-8 -*-
+# EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+#
+# This program is free software: you can redistribute it and/or modify
+# in under the terms of the GNU General Public license (version 3)
+# as published by the Free Software Foundation AND MODIFIED BY the
+# EMUnit exception.
+#
+# NOTE: The exception was added to the GPL to ensure
+# that you can test any kind of software without being
+# obligated to release the whole source code under the terms of GPL.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# and the EMUnit license exception along with this program.
+# If not, it can be viewed in the original EMunit repository:
+# <https://github.com/rkel/emunit>.
+'''
+
+Near overflow check of the multiple displays output
+
+Every test case near the display buffer overflow has to be counted once
+in the summary, no matter how many displays have reported it.
+
+Usage:
+    near_overflow.py xml_output json_output
+
+'''
+import sys
+import json
+import xml.etree.ElementTree as ET
+
+
+def main(argv):
+    u"""Main function"""
+    flagged = set()
+    root = ET.parse(argv[0]).getroot()
+    for ts in root.iter('testsuite'):
+        for tc in ts.iter('testcase'):
+            if tc.find('buffer-warning') is not None:
+                flagged.add((ts.get('name'), tc.get('name')))
+    counted = [int(root.find('testsummary/buffer-stat/near-overflow').text)]
+    with open(argv[1]) as f:
+        for line in f:
+            rec = json.loads(line)
+            if rec['event'] == 'tc_end' and 'buffer_used' in rec:
+                flagged.add((rec['suite'], rec['case']))
+            elif rec['event'] == 'summary':
+                counted.append(rec['buffer']['near_overflow'])
+    if not flagged or counted != [len(flagged)] * 2:
+        sys.stderr.write('Near overflow test cases: %d, counted: %s\n' % (len(flagged), counted))
+        return 1
+    return 0
+
+# Call main function
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
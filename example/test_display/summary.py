@@ -0,0 +1,60 @@
+# -*- coding: utf-8 -*-
+# EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+#
+# This program is free software: you can redistribute it and/or modify
+# in under the terms of the GNU General Public license (version 3)
+# as published by the Free Software Foundation AND MODIFIED BY the
+# EMUnit exception.
+#
+# NOTE: The exception was added to the GPL to ensure
+# that you can test any kind of software without being
+# obligated to release the whole source code under the terms of GPL.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# and the EMUnit license exception along with this program.
+# If not, it can be viewed in the original EMunit repository:
+# <https://github.com/rkel/emunit>.
+'''
+
+Test summary check
+
+Compares the test case statistics from the summary of the XML output
+with the expected ones and checks that the summary matches
+the test cases listed in the output.
+The benchmarks without the budget are listed, but not counted,
+their passed and failed numbers may be given.
+
+Usage:
+    summary.py xml_output total passed failed [uncounted_passed uncounted_failed]
+
+'''
+import sys
+import xml.etree.ElementTree as ET
+
+
+def main(argv):
+    u"""Main function"""
+    root = ET.parse(argv[0]).getroot()
+    expected = [int(v) for v in argv[1:4]]
+    uncounted = [int(v) for v in argv[4:6]] or [0, 0]
+    stat = root.find('testsummary/testcase-stat')
+    counted = [int(stat.find(tag).text) for tag in ('total', 'passed', 'failed')]
+    listed = list(root.iter('testcase'))
+    failed = [tc for tc in listed if tc.find('failure') is not None]
+    found = [len(listed) - sum(uncounted),
+             len(listed) - len(failed) - uncounted[0],
+             len(failed) - uncounted[1]]
+    if counted != expected or found != expected:
+        sys.stderr.write('Test cases total/passed/failed: expected %s, summary %s, listed %s\n' %
+                         (expected, counted, found))
+        return 1
+    return 0
+
+# Call main function
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
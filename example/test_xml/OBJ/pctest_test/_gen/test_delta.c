@@ -0,0 +1,1749 @@
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief Delta assertions xml test file
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * File that contains delta part of the xml output test.
+ * @sa emunit_test_xml
+ */
+#include "test.h"
+#include <emunit.h>
+
+/**
+ * @brief The macro that creates expected details string
+ *
+ * This macro creates expected details string for delta assertion.
+ * To be used with @ref test_expect_fail_assert.
+ *
+ * @param[in] d Delta value in details pattern
+ * @param[in] e Expected value in details pattern
+ * @param[in] a Actual pattern in details pattern
+ *
+ * @return Delta details expected pattern that matches given values.
+ *         Also contains format string ("%s") and comma before the pattern.
+ */
+#define TEST_DELTA_EXP(d, e, a)                        \
+	"%s",                                              \
+	"[[:space:]]*<delta>"EMUNIT_STR(d)"</delta>"       \
+	"[[:space:]]*<expected>"EMUNIT_STR(e)"</expected>" \
+	"[[:space:]]*<actual>"EMUNIT_STR(a)"</actual>"
+
+static void suite_init(void)
+{
+	test_expect_sinit_default("test_delta_suite");
+}
+
+static void suite_cleanup(void)
+{
+	test_expect_scleanup_default();
+}
+
+
+static void test_delta_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA(3, 0, 0);
+	UT_ASSERT_DELTA(3, 0, 3);
+	UT_ASSERT_DELTA(3, 0, -3);
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(3, 0, -4)
+		);
+	UT_ASSERT_DELTA(3, 0, -4);
+}
+
+static void test_delta_top(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA(3, 0, 0);
+	UT_ASSERT_DELTA(3, 0, 3);
+	UT_ASSERT_DELTA(3, 0, -3);
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(3, 0, 4)
+		);
+	UT_ASSERT_DELTA(3, 0, 4);
+}
+
+static void test_delta_msg(void)
+{
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		"Message for ",
+		TEST_DELTA_EXP(3, 0, 4)
+		);
+	UT_ASSERT_DELTA_MSG(3, 0, 4, "Message for %s", "");
+}
+
+static void test_delta_big_delta(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_DELTA(EMUNIT_UNUM_MAX, EMUNIT_SNUM_MIN, EMUNIT_SNUM_MAX);
+	UT_ASSERT_DELTA(EMUNIT_UNUM_MAX, EMUNIT_SNUM_MAX, EMUNIT_SNUM_MIN);
+}
+
+static void test_delta_int_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_INT(3, 250, 250);
+	UT_ASSERT_DELTA_INT(3, 250, 247);
+	UT_ASSERT_DELTA_INT(3, 250, 253);
+	UT_ASSERT_DELTA_INT(3, 0, 0);
+	UT_ASSERT_DELTA_INT(3, -257, -260);
+	UT_ASSERT_DELTA_INT(3, -257, -254);
+	UT_ASSERT_DELTA_INT(UINT64_MAX, INT64_MIN, INT64_MAX);
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(3, -250, -254)
+		);
+	UT_ASSERT_DELTA_INT(3, -250, -254);
+}
+
+static void test_delta_int_top(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_INT(3, 250, 250);
+	UT_ASSERT_DELTA_INT(3, 250, 247);
+	UT_ASSERT_DELTA_INT(3, 250, 253);
+	UT_ASSERT_DELTA_INT(3, 0, 0);
+	UT_ASSERT_DELTA_INT(3, -257, -260);
+	UT_ASSERT_DELTA_INT(3, -257, -254);
+	UT_ASSERT_DELTA_INT(UINT64_MAX, INT64_MIN, INT64_MAX);
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(3, -250, -246)
+		);
+	UT_ASSERT_DELTA_INT(3, -250, -246);
+}
+
+static void test_delta_int_msg(void)
+{
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		"Message for _int",
+		TEST_DELTA_EXP(3, -250, -246)
+		);
+	UT_ASSERT_DELTA_INT_MSG(3, -250, -246, "Message for %s", "_int");
+}
+
+static void test_delta_int_big_delta(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_DELTA_INT(EMUNIT_UNUM_MAX, EMUNIT_SNUM_MIN, EMUNIT_SNUM_MAX);
+	UT_ASSERT_DELTA_INT(EMUNIT_UNUM_MAX, EMUNIT_SNUM_MAX, EMUNIT_SNUM_MIN);
+}
+
+static void test_delta_uint_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_UINT(3, 250, 250);
+	UT_ASSERT_DELTA_UINT(3, 250, 247);
+	UT_ASSERT_DELTA_UINT(3, 250, 253);
+	UT_ASSERT_DELTA_UINT(3, 0, 0);
+	UT_ASSERT_DELTA_UINT(UINT64_MAX, 0, UINT64_MAX);
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(3, 250, 246)
+		);
+	UT_ASSERT_DELTA_UINT(3, 250, 246);
+}
+
+static void test_delta_uint_top(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_UINT(3, 250, 250);
+	UT_ASSERT_DELTA_UINT(3, 250, 247);
+	UT_ASSERT_DELTA_UINT(3, 250, 253);
+	UT_ASSERT_DELTA_UINT(3, 0, 0);
+	UT_ASSERT_DELTA_UINT(UINT64_MAX, 0, UINT64_MAX);
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(3, 250, 254)
+		);
+	UT_ASSERT_DELTA_UINT(3, 250, 254);
+}
+
+static void test_delta_uint_msg(void)
+{
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		"Message for _uint",
+		TEST_DELTA_EXP(3, 250, 254)
+		);
+	UT_ASSERT_DELTA_UINT_MSG(3, 250, 254, "Message for %s", "_uint");
+}
+
+static void test_delta_uint_big_delta(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_DELTA_UINT(EMUNIT_UNUM_MAX, EMUNIT_UNUM_MIN, EMUNIT_UNUM_MAX);
+	UT_ASSERT_DELTA_UINT(EMUNIT_UNUM_MAX, EMUNIT_UNUM_MAX, EMUNIT_UNUM_MIN);
+}
+
+static void test_delta_hex_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_HEX(3, 0, 0);
+	UT_ASSERT_DELTA_HEX(3, 0, 3);
+	UT_ASSERT_DELTA_HEX(UINT64_MAX, 0, UINT64_MAX);
+	UT_ASSERT_DELTA_HEX(0x10, 0x9ff0, 0x9fe0);
+	UT_ASSERT_DELTA_HEX(0x10, 0x9ff0, 0xa000);
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0x10, 0x9ff0, 0x9fdf)
+		);
+	UT_ASSERT_DELTA_HEX(0x10, 0x9ff0, 0x9fdf);
+}
+
+static void test_delta_hex_top(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_HEX(3, 0, 0);
+	UT_ASSERT_DELTA_HEX(3, 0, 3);
+	UT_ASSERT_DELTA_HEX(UINT64_MAX, 0, UINT64_MAX);
+	UT_ASSERT_DELTA_HEX(0x10, 0x9ff0, 0x9fe0);
+	UT_ASSERT_DELTA_HEX(0x10, 0x9ff0, 0xa000);
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0x10, 0x9ff0, 0xa001)
+		);
+	UT_ASSERT_DELTA_HEX(0x10, 0x9ff0, 0xa001);
+}
+
+static void test_delta_hex_msg(void)
+{
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		"Message for _hex",
+		TEST_DELTA_EXP(0x10, 0x9ff0, 0xa001)
+		);
+	UT_ASSERT_DELTA_HEX_MSG(0x10, 0x9ff0, 0xa001, "Message for %s", "_hex");
+}
+
+static void test_delta_hex_big_delta(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_DELTA_HEX(EMUNIT_UNUM_MAX, EMUNIT_UNUM_MIN, EMUNIT_UNUM_MAX);
+	UT_ASSERT_DELTA_HEX(EMUNIT_UNUM_MAX, EMUNIT_UNUM_MAX, EMUNIT_UNUM_MIN);
+}
+
+
+
+static void test_delta_int8_bottom(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_INT8(8, -120, -128);
+	UT_ASSERT_DELTA_INT8(8, -120, -112);
+	UT_ASSERT_DELTA_INT8(8, -120, -120);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, -120, -111)
+		);
+	UT_ASSERT_DELTA_INT8(8, -120, -111);
+}
+
+/* Test what happens if expected with delta underruns minimum value */
+static void test_delta_int8_underrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_INT8(8, -124, -128);
+	UT_ASSERT_DELTA_INT8(8, -124, -116);
+	UT_ASSERT_DELTA_INT8(8, -124, -124);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, -124, 127)
+		);
+	UT_ASSERT_DELTA_INT8(8, -124, 127);
+}
+
+static void test_delta_int8_top(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_INT8(8, 119, 111);
+	UT_ASSERT_DELTA_INT8(8, 119, 127);
+	UT_ASSERT_DELTA_INT8(8, 119, 119);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 119, 110)
+		);
+	UT_ASSERT_DELTA_INT8(8, 119, 110);
+}
+
+/* Test what happens if expected with delta overruns maximum value */
+static void test_delta_int8_overrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_INT8(8, 123, 127);
+	UT_ASSERT_DELTA_INT8(8, 123, 115);
+	UT_ASSERT_DELTA_INT8(8, 123, 123);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 123, -128)
+		);
+	UT_ASSERT_DELTA_INT8(8, 123, -128);
+}
+
+/* Test message version */
+static void test_delta_int8_msg(void)
+{/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		"Message _int8",
+		TEST_DELTA_EXP(8, 127, -128)
+		);
+	UT_ASSERT_DELTA_INT8_MSG(8, 127, -128, "Message %s", "_int8");
+}
+
+static void test_delta_int8_only_max_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_INT8(254, -128, 126);
+	UT_ASSERT_DELTA_INT8(254, -127, 127);
+	UT_ASSERT_DELTA_INT8(254, 127, -127);
+	UT_ASSERT_DELTA_INT8(254, 126, -128);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(254, -128, 127)
+		);
+	UT_ASSERT_DELTA_INT8(254, -128, 127);
+}
+
+static void test_delta_int8_only_min_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_INT8(254, -128, 126);
+	UT_ASSERT_DELTA_INT8(254, -127, 127);
+	UT_ASSERT_DELTA_INT8(254, 127, -127);
+	UT_ASSERT_DELTA_INT8(254, 126, -128);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(254, 127, -128)
+		);
+	UT_ASSERT_DELTA_INT8(254, 127, -128);
+}
+
+
+
+static void test_delta_uint8_bottom(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_UINT8(8u, 8u, 0u);
+	UT_ASSERT_DELTA_UINT8(8u, 8u, 16u);
+	UT_ASSERT_DELTA_UINT8(8u, 8u, 8u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 8, 17)
+		);
+	UT_ASSERT_DELTA_UINT8(8u, 8u, 17u);
+}
+
+/* Test what happens if expected with delta underruns minimum value */
+static void test_delta_uint8_underrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_UINT8(8u, 4u, 0u);
+	UT_ASSERT_DELTA_UINT8(8u, 4u, 12u);
+	UT_ASSERT_DELTA_UINT8(8u, 4u, 4u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 4, 255)
+		);
+	UT_ASSERT_DELTA_UINT8(8u, 4u, 255u);
+}
+
+static void test_delta_uint8_top(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_UINT8(8u, 247u, 239u);
+	UT_ASSERT_DELTA_UINT8(8u, 247u, 255u);
+	UT_ASSERT_DELTA_UINT8(8u, 247u, 247u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 247, 238)
+		);
+	UT_ASSERT_DELTA_UINT8(8u, 247u, 238u);
+}
+
+/* Test what happens if expected with delta overruns maximum value */
+static void test_delta_uint8_overrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_UINT8(8u, 251u, 255u);
+	UT_ASSERT_DELTA_UINT8(8u, 251u, 243u);
+	UT_ASSERT_DELTA_UINT8(8u, 251u, 251u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 251, 0)
+		);
+	UT_ASSERT_DELTA_UINT8(8u, 251u, 0u);
+}
+
+/* Test message version */
+static void test_delta_uint8_msg(void)
+{/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		"Message _uint8",
+		TEST_DELTA_EXP(8, 255, 0)
+		);
+	UT_ASSERT_DELTA_UINT8_MSG(8u, 255u, 0u, "Message %s", "_uint8");
+}
+
+static void test_delta_uint8_only_max_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_UINT8(254u, 0u, 254u);
+	UT_ASSERT_DELTA_UINT8(254u, 1u, 255u);
+	UT_ASSERT_DELTA_UINT8(254u, 255u, 1u);
+	UT_ASSERT_DELTA_UINT8(254u, 254u, 0u);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(254, 0, 255)
+		);
+	UT_ASSERT_DELTA_UINT8(254u, 0u, 255u);
+}
+
+static void test_delta_uint8_only_min_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_UINT8(254u, 0u, 254u);
+	UT_ASSERT_DELTA_UINT8(254u, 1u, 255u);
+	UT_ASSERT_DELTA_UINT8(254u, 255u, 1u);
+	UT_ASSERT_DELTA_UINT8(254u, 254u, 0u);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(254, 255, 0)
+		);
+	UT_ASSERT_DELTA_UINT8(254u, 255u, 0u);
+}
+
+
+
+static void test_delta_hex8_bottom(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_HEX8(0x8u, 0x8u, 0x0u);
+	UT_ASSERT_DELTA_HEX8(0x8u, 0x8u, 0x10u);
+	UT_ASSERT_DELTA_HEX8(0x8u, 0x8u, 0x8u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0x8, 0x8, 0x11)
+		);
+	UT_ASSERT_DELTA_HEX8(0x8u, 0x8u, 0x11u);
+}
+
+/* Test what happens if expected with delta underruns minimum value */
+static void test_delta_hex8_underrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_HEX8(0x8u, 0x4u, 0x0u);
+	UT_ASSERT_DELTA_HEX8(0x8u, 0x4u, 0xcu);
+	UT_ASSERT_DELTA_HEX8(0x8u, 0x4u, 0x4u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0x8, 0x4, 0xff)
+		);
+	UT_ASSERT_DELTA_HEX8(0x8u, 0x4u, 0xffu);
+}
+
+static void test_delta_hex8_top(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_HEX8(0x8u, 0xf7u, 0xefu);
+	UT_ASSERT_DELTA_HEX8(0x8u, 0xf7u, 0xffu);
+	UT_ASSERT_DELTA_HEX8(0x8u, 0xf7u, 0xf7u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0x8, 0xf7, 0xee)
+		);
+	UT_ASSERT_DELTA_HEX8(0x8u, 0xf7u, 0xeeu);
+}
+
+/* Test what happens if expected with delta overruns maximum value */
+static void test_delta_hex8_overrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_HEX8(0x8u, 0xfbu, 0xffu);
+	UT_ASSERT_DELTA_HEX8(0x8u, 0xfbu, 0xf3u);
+	UT_ASSERT_DELTA_HEX8(0x8u, 0xfbu, 0xfbu);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0x8, 0xfb, 0x0)
+		);
+	UT_ASSERT_DELTA_HEX8(0x8u, 0xfbu, 0x0u);
+}
+
+/* Test message version */
+static void test_delta_hex8_msg(void)
+{/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		"Message _hex8",
+		TEST_DELTA_EXP(0x8, 0xff, 0x0)
+		);
+	UT_ASSERT_DELTA_HEX8_MSG(0x8u, 0xffu, 0x0u, "Message %s", "_hex8");
+}
+
+static void test_delta_hex8_only_max_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_HEX8(0xfeu, 0x0u, 0xfeu);
+	UT_ASSERT_DELTA_HEX8(0xfeu, 0x1u, 0xffu);
+	UT_ASSERT_DELTA_HEX8(0xfeu, 0xffu, 0x1u);
+	UT_ASSERT_DELTA_HEX8(0xfeu, 0xfeu, 0x0u);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0xfe, 0x0, 0xff)
+		);
+	UT_ASSERT_DELTA_HEX8(0xfeu, 0x0u, 0xffu);
+}
+
+static void test_delta_hex8_only_min_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_HEX8(0xfeu, 0x0u, 0xfeu);
+	UT_ASSERT_DELTA_HEX8(0xfeu, 0x1u, 0xffu);
+	UT_ASSERT_DELTA_HEX8(0xfeu, 0xffu, 0x1u);
+	UT_ASSERT_DELTA_HEX8(0xfeu, 0xfeu, 0x0u);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0xfe, 0xff, 0x0)
+		);
+	UT_ASSERT_DELTA_HEX8(0xfeu, 0xffu, 0x0u);
+}
+
+
+
+static void test_delta_int16_bottom(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_INT16(8, -32760, -32768);
+	UT_ASSERT_DELTA_INT16(8, -32760, -32752);
+	UT_ASSERT_DELTA_INT16(8, -32760, -32760);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, -32760, -32751)
+		);
+	UT_ASSERT_DELTA_INT16(8, -32760, -32751);
+}
+
+/* Test what happens if expected with delta underruns minimum value */
+static void test_delta_int16_underrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_INT16(8, -32764, -32768);
+	UT_ASSERT_DELTA_INT16(8, -32764, -32756);
+	UT_ASSERT_DELTA_INT16(8, -32764, -32764);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, -32764, 32767)
+		);
+	UT_ASSERT_DELTA_INT16(8, -32764, 32767);
+}
+
+static void test_delta_int16_top(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_INT16(8, 32759, 32751);
+	UT_ASSERT_DELTA_INT16(8, 32759, 32767);
+	UT_ASSERT_DELTA_INT16(8, 32759, 32759);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 32759, 32750)
+		);
+	UT_ASSERT_DELTA_INT16(8, 32759, 32750);
+}
+
+/* Test what happens if expected with delta overruns maximum value */
+static void test_delta_int16_overrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_INT16(8, 32763, 32767);
+	UT_ASSERT_DELTA_INT16(8, 32763, 32755);
+	UT_ASSERT_DELTA_INT16(8, 32763, 32763);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 32763, -32768)
+		);
+	UT_ASSERT_DELTA_INT16(8, 32763, -32768);
+}
+
+/* Test message version */
+static void test_delta_int16_msg(void)
+{/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		"Message _int16",
+		TEST_DELTA_EXP(8, 32767, -32768)
+		);
+	UT_ASSERT_DELTA_INT16_MSG(8, 32767, -32768, "Message %s", "_int16");
+}
+
+static void test_delta_int16_only_max_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_INT16(65534, -32768, 32766);
+	UT_ASSERT_DELTA_INT16(65534, -32767, 32767);
+	UT_ASSERT_DELTA_INT16(65534, 32767, -32767);
+	UT_ASSERT_DELTA_INT16(65534, 32766, -32768);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(65534, -32768, 32767)
+		);
+	UT_ASSERT_DELTA_INT16(65534, -32768, 32767);
+}
+
+static void test_delta_int16_only_min_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_INT16(65534, -32768, 32766);
+	UT_ASSERT_DELTA_INT16(65534, -32767, 32767);
+	UT_ASSERT_DELTA_INT16(65534, 32767, -32767);
+	UT_ASSERT_DELTA_INT16(65534, 32766, -32768);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(65534, 32767, -32768)
+		);
+	UT_ASSERT_DELTA_INT16(65534, 32767, -32768);
+}
+
+
+
+static void test_delta_uint16_bottom(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_UINT16(8u, 8u, 0u);
+	UT_ASSERT_DELTA_UINT16(8u, 8u, 16u);
+	UT_ASSERT_DELTA_UINT16(8u, 8u, 8u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 8, 17)
+		);
+	UT_ASSERT_DELTA_UINT16(8u, 8u, 17u);
+}
+
+/* Test what happens if expected with delta underruns minimum value */
+static void test_delta_uint16_underrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_UINT16(8u, 4u, 0u);
+	UT_ASSERT_DELTA_UINT16(8u, 4u, 12u);
+	UT_ASSERT_DELTA_UINT16(8u, 4u, 4u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 4, 65535)
+		);
+	UT_ASSERT_DELTA_UINT16(8u, 4u, 65535u);
+}
+
+static void test_delta_uint16_top(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_UINT16(8u, 65527u, 65519u);
+	UT_ASSERT_DELTA_UINT16(8u, 65527u, 65535u);
+	UT_ASSERT_DELTA_UINT16(8u, 65527u, 65527u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 65527, 65518)
+		);
+	UT_ASSERT_DELTA_UINT16(8u, 65527u, 65518u);
+}
+
+/* Test what happens if expected with delta overruns maximum value */
+static void test_delta_uint16_overrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_UINT16(8u, 65531u, 65535u);
+	UT_ASSERT_DELTA_UINT16(8u, 65531u, 65523u);
+	UT_ASSERT_DELTA_UINT16(8u, 65531u, 65531u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 65531, 0)
+		);
+	UT_ASSERT_DELTA_UINT16(8u, 65531u, 0u);
+}
+
+/* Test message version */
+static void test_delta_uint16_msg(void)
+{/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		"Message _uint16",
+		TEST_DELTA_EXP(8, 65535, 0)
+		);
+	UT_ASSERT_DELTA_UINT16_MSG(8u, 65535u, 0u, "Message %s", "_uint16");
+}
+
+static void test_delta_uint16_only_max_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_UINT16(65534u, 0u, 65534u);
+	UT_ASSERT_DELTA_UINT16(65534u, 1u, 65535u);
+	UT_ASSERT_DELTA_UINT16(65534u, 65535u, 1u);
+	UT_ASSERT_DELTA_UINT16(65534u, 65534u, 0u);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(65534, 0, 65535)
+		);
+	UT_ASSERT_DELTA_UINT16(65534u, 0u, 65535u);
+}
+
+static void test_delta_uint16_only_min_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_UINT16(65534u, 0u, 65534u);
+	UT_ASSERT_DELTA_UINT16(65534u, 1u, 65535u);
+	UT_ASSERT_DELTA_UINT16(65534u, 65535u, 1u);
+	UT_ASSERT_DELTA_UINT16(65534u, 65534u, 0u);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(65534, 65535, 0)
+		);
+	UT_ASSERT_DELTA_UINT16(65534u, 65535u, 0u);
+}
+
+
+
+static void test_delta_hex16_bottom(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_HEX16(0x8u, 0x8u, 0x0u);
+	UT_ASSERT_DELTA_HEX16(0x8u, 0x8u, 0x10u);
+	UT_ASSERT_DELTA_HEX16(0x8u, 0x8u, 0x8u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0x8, 0x8, 0x11)
+		);
+	UT_ASSERT_DELTA_HEX16(0x8u, 0x8u, 0x11u);
+}
+
+/* Test what happens if expected with delta underruns minimum value */
+static void test_delta_hex16_underrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_HEX16(0x8u, 0x4u, 0x0u);
+	UT_ASSERT_DELTA_HEX16(0x8u, 0x4u, 0xcu);
+	UT_ASSERT_DELTA_HEX16(0x8u, 0x4u, 0x4u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0x8, 0x4, 0xffff)
+		);
+	UT_ASSERT_DELTA_HEX16(0x8u, 0x4u, 0xffffu);
+}
+
+static void test_delta_hex16_top(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_HEX16(0x8u, 0xfff7u, 0xffefu);
+	UT_ASSERT_DELTA_HEX16(0x8u, 0xfff7u, 0xffffu);
+	UT_ASSERT_DELTA_HEX16(0x8u, 0xfff7u, 0xfff7u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0x8, 0xfff7, 0xffee)
+		);
+	UT_ASSERT_DELTA_HEX16(0x8u, 0xfff7u, 0xffeeu);
+}
+
+/* Test what happens if expected with delta overruns maximum value */
+static void test_delta_hex16_overrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_HEX16(0x8u, 0xfffbu, 0xffffu);
+	UT_ASSERT_DELTA_HEX16(0x8u, 0xfffbu, 0xfff3u);
+	UT_ASSERT_DELTA_HEX16(0x8u, 0xfffbu, 0xfffbu);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0x8, 0xfffb, 0x0)
+		);
+	UT_ASSERT_DELTA_HEX16(0x8u, 0xfffbu, 0x0u);
+}
+
+/* Test message version */
+static void test_delta_hex16_msg(void)
+{/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		"Message _hex16",
+		TEST_DELTA_EXP(0x8, 0xffff, 0x0)
+		);
+	UT_ASSERT_DELTA_HEX16_MSG(0x8u, 0xffffu, 0x0u, "Message %s", "_hex16");
+}
+
+static void test_delta_hex16_only_max_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_HEX16(0xfffeu, 0x0u, 0xfffeu);
+	UT_ASSERT_DELTA_HEX16(0xfffeu, 0x1u, 0xffffu);
+	UT_ASSERT_DELTA_HEX16(0xfffeu, 0xffffu, 0x1u);
+	UT_ASSERT_DELTA_HEX16(0xfffeu, 0xfffeu, 0x0u);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0xfffe, 0x0, 0xffff)
+		);
+	UT_ASSERT_DELTA_HEX16(0xfffeu, 0x0u, 0xffffu);
+}
+
+static void test_delta_hex16_only_min_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_HEX16(0xfffeu, 0x0u, 0xfffeu);
+	UT_ASSERT_DELTA_HEX16(0xfffeu, 0x1u, 0xffffu);
+	UT_ASSERT_DELTA_HEX16(0xfffeu, 0xffffu, 0x1u);
+	UT_ASSERT_DELTA_HEX16(0xfffeu, 0xfffeu, 0x0u);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0xfffe, 0xffff, 0x0)
+		);
+	UT_ASSERT_DELTA_HEX16(0xfffeu, 0xffffu, 0x0u);
+}
+
+
+
+static void test_delta_int32_bottom(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_INT32(8, -2147483640, -2147483648);
+	UT_ASSERT_DELTA_INT32(8, -2147483640, -2147483632);
+	UT_ASSERT_DELTA_INT32(8, -2147483640, -2147483640);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, -2147483640, -2147483631)
+		);
+	UT_ASSERT_DELTA_INT32(8, -2147483640, -2147483631);
+}
+
+/* Test what happens if expected with delta underruns minimum value */
+static void test_delta_int32_underrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_INT32(8, -2147483644, -2147483648);
+	UT_ASSERT_DELTA_INT32(8, -2147483644, -2147483636);
+	UT_ASSERT_DELTA_INT32(8, -2147483644, -2147483644);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, -2147483644, 2147483647)
+		);
+	UT_ASSERT_DELTA_INT32(8, -2147483644, 2147483647);
+}
+
+static void test_delta_int32_top(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_INT32(8, 2147483639, 2147483631);
+	UT_ASSERT_DELTA_INT32(8, 2147483639, 2147483647);
+	UT_ASSERT_DELTA_INT32(8, 2147483639, 2147483639);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 2147483639, 2147483630)
+		);
+	UT_ASSERT_DELTA_INT32(8, 2147483639, 2147483630);
+}
+
+/* Test what happens if expected with delta overruns maximum value */
+static void test_delta_int32_overrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_INT32(8, 2147483643, 2147483647);
+	UT_ASSERT_DELTA_INT32(8, 2147483643, 2147483635);
+	UT_ASSERT_DELTA_INT32(8, 2147483643, 2147483643);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 2147483643, -2147483648)
+		);
+	UT_ASSERT_DELTA_INT32(8, 2147483643, -2147483648);
+}
+
+/* Test message version */
+static void test_delta_int32_msg(void)
+{/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		"Message _int32",
+		TEST_DELTA_EXP(8, 2147483647, -2147483648)
+		);
+	UT_ASSERT_DELTA_INT32_MSG(8, 2147483647, -2147483648, "Message %s", "_int32");
+}
+
+static void test_delta_int32_only_max_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_INT32(4294967294, -2147483648, 2147483646);
+	UT_ASSERT_DELTA_INT32(4294967294, -2147483647, 2147483647);
+	UT_ASSERT_DELTA_INT32(4294967294, 2147483647, -2147483647);
+	UT_ASSERT_DELTA_INT32(4294967294, 2147483646, -2147483648);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(4294967294, -2147483648, 2147483647)
+		);
+	UT_ASSERT_DELTA_INT32(4294967294, -2147483648, 2147483647);
+}
+
+static void test_delta_int32_only_min_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_INT32(4294967294, -2147483648, 2147483646);
+	UT_ASSERT_DELTA_INT32(4294967294, -2147483647, 2147483647);
+	UT_ASSERT_DELTA_INT32(4294967294, 2147483647, -2147483647);
+	UT_ASSERT_DELTA_INT32(4294967294, 2147483646, -2147483648);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(4294967294, 2147483647, -2147483648)
+		);
+	UT_ASSERT_DELTA_INT32(4294967294, 2147483647, -2147483648);
+}
+
+
+
+static void test_delta_uint32_bottom(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_UINT32(8u, 8u, 0u);
+	UT_ASSERT_DELTA_UINT32(8u, 8u, 16u);
+	UT_ASSERT_DELTA_UINT32(8u, 8u, 8u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 8, 17)
+		);
+	UT_ASSERT_DELTA_UINT32(8u, 8u, 17u);
+}
+
+/* Test what happens if expected with delta underruns minimum value */
+static void test_delta_uint32_underrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_UINT32(8u, 4u, 0u);
+	UT_ASSERT_DELTA_UINT32(8u, 4u, 12u);
+	UT_ASSERT_DELTA_UINT32(8u, 4u, 4u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 4, 4294967295)
+		);
+	UT_ASSERT_DELTA_UINT32(8u, 4u, 4294967295u);
+}
+
+static void test_delta_uint32_top(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_UINT32(8u, 4294967287u, 4294967279u);
+	UT_ASSERT_DELTA_UINT32(8u, 4294967287u, 4294967295u);
+	UT_ASSERT_DELTA_UINT32(8u, 4294967287u, 4294967287u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 4294967287, 4294967278)
+		);
+	UT_ASSERT_DELTA_UINT32(8u, 4294967287u, 4294967278u);
+}
+
+/* Test what happens if expected with delta overruns maximum value */
+static void test_delta_uint32_overrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_UINT32(8u, 4294967291u, 4294967295u);
+	UT_ASSERT_DELTA_UINT32(8u, 4294967291u, 4294967283u);
+	UT_ASSERT_DELTA_UINT32(8u, 4294967291u, 4294967291u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 4294967291, 0)
+		);
+	UT_ASSERT_DELTA_UINT32(8u, 4294967291u, 0u);
+}
+
+/* Test message version */
+static void test_delta_uint32_msg(void)
+{/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		"Message _uint32",
+		TEST_DELTA_EXP(8, 4294967295, 0)
+		);
+	UT_ASSERT_DELTA_UINT32_MSG(8u, 4294967295u, 0u, "Message %s", "_uint32");
+}
+
+static void test_delta_uint32_only_max_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_UINT32(4294967294u, 0u, 4294967294u);
+	UT_ASSERT_DELTA_UINT32(4294967294u, 1u, 4294967295u);
+	UT_ASSERT_DELTA_UINT32(4294967294u, 4294967295u, 1u);
+	UT_ASSERT_DELTA_UINT32(4294967294u, 4294967294u, 0u);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(4294967294, 0, 4294967295)
+		);
+	UT_ASSERT_DELTA_UINT32(4294967294u, 0u, 4294967295u);
+}
+
+static void test_delta_uint32_only_min_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_UINT32(4294967294u, 0u, 4294967294u);
+	UT_ASSERT_DELTA_UINT32(4294967294u, 1u, 4294967295u);
+	UT_ASSERT_DELTA_UINT32(4294967294u, 4294967295u, 1u);
+	UT_ASSERT_DELTA_UINT32(4294967294u, 4294967294u, 0u);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(4294967294, 4294967295, 0)
+		);
+	UT_ASSERT_DELTA_UINT32(4294967294u, 4294967295u, 0u);
+}
+
+
+
+static void test_delta_hex32_bottom(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_HEX32(0x8u, 0x8u, 0x0u);
+	UT_ASSERT_DELTA_HEX32(0x8u, 0x8u, 0x10u);
+	UT_ASSERT_DELTA_HEX32(0x8u, 0x8u, 0x8u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0x8, 0x8, 0x11)
+		);
+	UT_ASSERT_DELTA_HEX32(0x8u, 0x8u, 0x11u);
+}
+
+/* Test what happens if expected with delta underruns minimum value */
+static void test_delta_hex32_underrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_HEX32(0x8u, 0x4u, 0x0u);
+	UT_ASSERT_DELTA_HEX32(0x8u, 0x4u, 0xcu);
+	UT_ASSERT_DELTA_HEX32(0x8u, 0x4u, 0x4u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0x8, 0x4, 0xffffffff)
+		);
+	UT_ASSERT_DELTA_HEX32(0x8u, 0x4u, 0xffffffffu);
+}
+
+static void test_delta_hex32_top(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_HEX32(0x8u, 0xfffffff7u, 0xffffffefu);
+	UT_ASSERT_DELTA_HEX32(0x8u, 0xfffffff7u, 0xffffffffu);
+	UT_ASSERT_DELTA_HEX32(0x8u, 0xfffffff7u, 0xfffffff7u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0x8, 0xfffffff7, 0xffffffee)
+		);
+	UT_ASSERT_DELTA_HEX32(0x8u, 0xfffffff7u, 0xffffffeeu);
+}
+
+/* Test what happens if expected with delta overruns maximum value */
+static void test_delta_hex32_overrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_HEX32(0x8u, 0xfffffffbu, 0xffffffffu);
+	UT_ASSERT_DELTA_HEX32(0x8u, 0xfffffffbu, 0xfffffff3u);
+	UT_ASSERT_DELTA_HEX32(0x8u, 0xfffffffbu, 0xfffffffbu);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0x8, 0xfffffffb, 0x0)
+		);
+	UT_ASSERT_DELTA_HEX32(0x8u, 0xfffffffbu, 0x0u);
+}
+
+/* Test message version */
+static void test_delta_hex32_msg(void)
+{/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		"Message _hex32",
+		TEST_DELTA_EXP(0x8, 0xffffffff, 0x0)
+		);
+	UT_ASSERT_DELTA_HEX32_MSG(0x8u, 0xffffffffu, 0x0u, "Message %s", "_hex32");
+}
+
+static void test_delta_hex32_only_max_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_HEX32(0xfffffffeu, 0x0u, 0xfffffffeu);
+	UT_ASSERT_DELTA_HEX32(0xfffffffeu, 0x1u, 0xffffffffu);
+	UT_ASSERT_DELTA_HEX32(0xfffffffeu, 0xffffffffu, 0x1u);
+	UT_ASSERT_DELTA_HEX32(0xfffffffeu, 0xfffffffeu, 0x0u);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0xfffffffe, 0x0, 0xffffffff)
+		);
+	UT_ASSERT_DELTA_HEX32(0xfffffffeu, 0x0u, 0xffffffffu);
+}
+
+static void test_delta_hex32_only_min_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_HEX32(0xfffffffeu, 0x0u, 0xfffffffeu);
+	UT_ASSERT_DELTA_HEX32(0xfffffffeu, 0x1u, 0xffffffffu);
+	UT_ASSERT_DELTA_HEX32(0xfffffffeu, 0xffffffffu, 0x1u);
+	UT_ASSERT_DELTA_HEX32(0xfffffffeu, 0xfffffffeu, 0x0u);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0xfffffffe, 0xffffffff, 0x0)
+		);
+	UT_ASSERT_DELTA_HEX32(0xfffffffeu, 0xffffffffu, 0x0u);
+}
+
+
+
+static void test_delta_int64_bottom(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_INT64(8u, -9223372036854775800u, -9223372036854775808u);
+	UT_ASSERT_DELTA_INT64(8u, -9223372036854775800u, -9223372036854775792u);
+	UT_ASSERT_DELTA_INT64(8u, -9223372036854775800u, -9223372036854775800u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, -9223372036854775800, -9223372036854775791)
+		);
+	UT_ASSERT_DELTA_INT64(8u, -9223372036854775800u, -9223372036854775791u);
+}
+
+/* Test what happens if expected with delta underruns minimum value */
+static void test_delta_int64_underrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_INT64(8u, -9223372036854775804u, -9223372036854775808u);
+	UT_ASSERT_DELTA_INT64(8u, -9223372036854775804u, -9223372036854775796u);
+	UT_ASSERT_DELTA_INT64(8u, -9223372036854775804u, -9223372036854775804u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, -9223372036854775804, 9223372036854775807)
+		);
+	UT_ASSERT_DELTA_INT64(8u, -9223372036854775804u, 9223372036854775807u);
+}
+
+static void test_delta_int64_top(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_INT64(8u, 9223372036854775799u, 9223372036854775791u);
+	UT_ASSERT_DELTA_INT64(8u, 9223372036854775799u, 9223372036854775807u);
+	UT_ASSERT_DELTA_INT64(8u, 9223372036854775799u, 9223372036854775799u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 9223372036854775799, 9223372036854775790)
+		);
+	UT_ASSERT_DELTA_INT64(8u, 9223372036854775799u, 9223372036854775790u);
+}
+
+/* Test what happens if expected with delta overruns maximum value */
+static void test_delta_int64_overrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_INT64(8u, 9223372036854775803u, 9223372036854775807u);
+	UT_ASSERT_DELTA_INT64(8u, 9223372036854775803u, 9223372036854775795u);
+	UT_ASSERT_DELTA_INT64(8u, 9223372036854775803u, 9223372036854775803u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 9223372036854775803, -9223372036854775808)
+		);
+	UT_ASSERT_DELTA_INT64(8u, 9223372036854775803u, -9223372036854775808u);
+}
+
+/* Test message version */
+static void test_delta_int64_msg(void)
+{/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		"Message _int64",
+		TEST_DELTA_EXP(8, 9223372036854775807, -9223372036854775808)
+		);
+	UT_ASSERT_DELTA_INT64_MSG(8u, 9223372036854775807u, -9223372036854775808u, "Message %s", "_int64");
+}
+
+static void test_delta_int64_only_max_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_INT64(18446744073709551614u, -9223372036854775808u, 9223372036854775806u);
+	UT_ASSERT_DELTA_INT64(18446744073709551614u, -9223372036854775807u, 9223372036854775807u);
+	UT_ASSERT_DELTA_INT64(18446744073709551614u, 9223372036854775807u, -9223372036854775807u);
+	UT_ASSERT_DELTA_INT64(18446744073709551614u, 9223372036854775806u, -9223372036854775808u);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(18446744073709551614, -9223372036854775808, 9223372036854775807)
+		);
+	UT_ASSERT_DELTA_INT64(18446744073709551614u, -9223372036854775808u, 9223372036854775807u);
+}
+
+static void test_delta_int64_only_min_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_INT64(18446744073709551614u, -9223372036854775808u, 9223372036854775806u);
+	UT_ASSERT_DELTA_INT64(18446744073709551614u, -9223372036854775807u, 9223372036854775807u);
+	UT_ASSERT_DELTA_INT64(18446744073709551614u, 9223372036854775807u, -9223372036854775807u);
+	UT_ASSERT_DELTA_INT64(18446744073709551614u, 9223372036854775806u, -9223372036854775808u);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(18446744073709551614, 9223372036854775807, -9223372036854775808)
+		);
+	UT_ASSERT_DELTA_INT64(18446744073709551614u, 9223372036854775807u, -9223372036854775808u);
+}
+
+
+
+static void test_delta_uint64_bottom(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_UINT64(8u, 8u, 0u);
+	UT_ASSERT_DELTA_UINT64(8u, 8u, 16u);
+	UT_ASSERT_DELTA_UINT64(8u, 8u, 8u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 8, 17)
+		);
+	UT_ASSERT_DELTA_UINT64(8u, 8u, 17u);
+}
+
+/* Test what happens if expected with delta underruns minimum value */
+static void test_delta_uint64_underrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_UINT64(8u, 4u, 0u);
+	UT_ASSERT_DELTA_UINT64(8u, 4u, 12u);
+	UT_ASSERT_DELTA_UINT64(8u, 4u, 4u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 4, 18446744073709551615)
+		);
+	UT_ASSERT_DELTA_UINT64(8u, 4u, 18446744073709551615u);
+}
+
+static void test_delta_uint64_top(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_UINT64(8u, 18446744073709551607u, 18446744073709551599u);
+	UT_ASSERT_DELTA_UINT64(8u, 18446744073709551607u, 18446744073709551615u);
+	UT_ASSERT_DELTA_UINT64(8u, 18446744073709551607u, 18446744073709551607u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 18446744073709551607, 18446744073709551598)
+		);
+	UT_ASSERT_DELTA_UINT64(8u, 18446744073709551607u, 18446744073709551598u);
+}
+
+/* Test what happens if expected with delta overruns maximum value */
+static void test_delta_uint64_overrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_UINT64(8u, 18446744073709551611u, 18446744073709551615u);
+	UT_ASSERT_DELTA_UINT64(8u, 18446744073709551611u, 18446744073709551603u);
+	UT_ASSERT_DELTA_UINT64(8u, 18446744073709551611u, 18446744073709551611u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(8, 18446744073709551611, 0)
+		);
+	UT_ASSERT_DELTA_UINT64(8u, 18446744073709551611u, 0u);
+}
+
+/* Test message version */
+static void test_delta_uint64_msg(void)
+{/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		"Message _uint64",
+		TEST_DELTA_EXP(8, 18446744073709551615, 0)
+		);
+	UT_ASSERT_DELTA_UINT64_MSG(8u, 18446744073709551615u, 0u, "Message %s", "_uint64");
+}
+
+static void test_delta_uint64_only_max_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_UINT64(18446744073709551614u, 0u, 18446744073709551614u);
+	UT_ASSERT_DELTA_UINT64(18446744073709551614u, 1u, 18446744073709551615u);
+	UT_ASSERT_DELTA_UINT64(18446744073709551614u, 18446744073709551615u, 1u);
+	UT_ASSERT_DELTA_UINT64(18446744073709551614u, 18446744073709551614u, 0u);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(18446744073709551614, 0, 18446744073709551615)
+		);
+	UT_ASSERT_DELTA_UINT64(18446744073709551614u, 0u, 18446744073709551615u);
+}
+
+static void test_delta_uint64_only_min_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_UINT64(18446744073709551614u, 0u, 18446744073709551614u);
+	UT_ASSERT_DELTA_UINT64(18446744073709551614u, 1u, 18446744073709551615u);
+	UT_ASSERT_DELTA_UINT64(18446744073709551614u, 18446744073709551615u, 1u);
+	UT_ASSERT_DELTA_UINT64(18446744073709551614u, 18446744073709551614u, 0u);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(18446744073709551614, 18446744073709551615, 0)
+		);
+	UT_ASSERT_DELTA_UINT64(18446744073709551614u, 18446744073709551615u, 0u);
+}
+
+
+
+static void test_delta_hex64_bottom(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_HEX64(0x8u, 0x8u, 0x0u);
+	UT_ASSERT_DELTA_HEX64(0x8u, 0x8u, 0x10u);
+	UT_ASSERT_DELTA_HEX64(0x8u, 0x8u, 0x8u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0x8, 0x8, 0x11)
+		);
+	UT_ASSERT_DELTA_HEX64(0x8u, 0x8u, 0x11u);
+}
+
+/* Test what happens if expected with delta underruns minimum value */
+static void test_delta_hex64_underrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_HEX64(0x8u, 0x4u, 0x0u);
+	UT_ASSERT_DELTA_HEX64(0x8u, 0x4u, 0xcu);
+	UT_ASSERT_DELTA_HEX64(0x8u, 0x4u, 0x4u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0x8, 0x4, 0xffffffffffffffff)
+		);
+	UT_ASSERT_DELTA_HEX64(0x8u, 0x4u, 0xffffffffffffffffu);
+}
+
+static void test_delta_hex64_top(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_HEX64(0x8u, 0xfffffffffffffff7u, 0xffffffffffffffefu);
+	UT_ASSERT_DELTA_HEX64(0x8u, 0xfffffffffffffff7u, 0xffffffffffffffffu);
+	UT_ASSERT_DELTA_HEX64(0x8u, 0xfffffffffffffff7u, 0xfffffffffffffff7u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0x8, 0xfffffffffffffff7, 0xffffffffffffffee)
+		);
+	UT_ASSERT_DELTA_HEX64(0x8u, 0xfffffffffffffff7u, 0xffffffffffffffeeu);
+}
+
+/* Test what happens if expected with delta overruns maximum value */
+static void test_delta_hex64_overrun(void)
+{/* Should pass */
+	UT_ASSERT_DELTA_HEX64(0x8u, 0xfffffffffffffffbu, 0xffffffffffffffffu);
+	UT_ASSERT_DELTA_HEX64(0x8u, 0xfffffffffffffffbu, 0xfffffffffffffff3u);
+	UT_ASSERT_DELTA_HEX64(0x8u, 0xfffffffffffffffbu, 0xfffffffffffffffbu);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0x8, 0xfffffffffffffffb, 0x0)
+		);
+	UT_ASSERT_DELTA_HEX64(0x8u, 0xfffffffffffffffbu, 0x0u);
+}
+
+/* Test message version */
+static void test_delta_hex64_msg(void)
+{/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		"Message _hex64",
+		TEST_DELTA_EXP(0x8, 0xffffffffffffffff, 0x0)
+		);
+	UT_ASSERT_DELTA_HEX64_MSG(0x8u, 0xffffffffffffffffu, 0x0u, "Message %s", "_hex64");
+}
+
+static void test_delta_hex64_only_max_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_HEX64(0xfffffffffffffffeu, 0x0u, 0xfffffffffffffffeu);
+	UT_ASSERT_DELTA_HEX64(0xfffffffffffffffeu, 0x1u, 0xffffffffffffffffu);
+	UT_ASSERT_DELTA_HEX64(0xfffffffffffffffeu, 0xffffffffffffffffu, 0x1u);
+	UT_ASSERT_DELTA_HEX64(0xfffffffffffffffeu, 0xfffffffffffffffeu, 0x0u);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0xfffffffffffffffe, 0x0, 0xffffffffffffffff)
+		);
+	UT_ASSERT_DELTA_HEX64(0xfffffffffffffffeu, 0x0u, 0xffffffffffffffffu);
+}
+
+static void test_delta_hex64_only_min_fail(void)
+{
+	/* Should pass */
+	UT_ASSERT_DELTA_HEX64(0xfffffffffffffffeu, 0x0u, 0xfffffffffffffffeu);
+	UT_ASSERT_DELTA_HEX64(0xfffffffffffffffeu, 0x1u, 0xffffffffffffffffu);
+	UT_ASSERT_DELTA_HEX64(0xfffffffffffffffeu, 0xffffffffffffffffu, 0x1u);
+	UT_ASSERT_DELTA_HEX64(0xfffffffffffffffeu, 0xfffffffffffffffeu, 0x0u);
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"DELTA",
+		NULL,
+		TEST_DELTA_EXP(0xfffffffffffffffe, 0xffffffffffffffff, 0x0)
+		);
+	UT_ASSERT_DELTA_HEX64(0xfffffffffffffffeu, 0xffffffffffffffffu, 0x0u);
+}
+
+UT_DESC_TS_BEGIN(test_delta_suite, suite_init, suite_cleanup, NULL, NULL)
+	UT_DESC_TC(test_delta_bottom)
+	UT_DESC_TC(test_delta_top)
+	UT_DESC_TC(test_delta_msg)
+	UT_DESC_TC(test_delta_big_delta)
+	UT_DESC_TC(test_delta_int_bottom)
+	UT_DESC_TC(test_delta_int_top)
+	UT_DESC_TC(test_delta_int_msg)
+	UT_DESC_TC(test_delta_int_big_delta)
+	UT_DESC_TC(test_delta_uint_bottom)
+	UT_DESC_TC(test_delta_uint_top)
+	UT_DESC_TC(test_delta_uint_msg)
+	UT_DESC_TC(test_delta_uint_big_delta)
+	UT_DESC_TC(test_delta_hex_bottom)
+	UT_DESC_TC(test_delta_hex_top)
+	UT_DESC_TC(test_delta_hex_msg)
+	UT_DESC_TC(test_delta_hex_big_delta)
+	UT_DESC_TC(test_delta_int8_bottom)
+	UT_DESC_TC(test_delta_int8_underrun)
+	UT_DESC_TC(test_delta_int8_top)
+	UT_DESC_TC(test_delta_int8_overrun)
+	UT_DESC_TC(test_delta_int8_msg)
+	UT_DESC_TC(test_delta_int8_only_max_fail)
+	UT_DESC_TC(test_delta_int8_only_min_fail)
+	UT_DESC_TC(test_delta_uint8_bottom)
+	UT_DESC_TC(test_delta_uint8_underrun)
+	UT_DESC_TC(test_delta_uint8_top)
+	UT_DESC_TC(test_delta_uint8_overrun)
+	UT_DESC_TC(test_delta_uint8_msg)
+	UT_DESC_TC(test_delta_uint8_only_max_fail)
+	UT_DESC_TC(test_delta_uint8_only_min_fail)
+	UT_DESC_TC(test_delta_hex8_bottom)
+	UT_DESC_TC(test_delta_hex8_underrun)
+	UT_DESC_TC(test_delta_hex8_top)
+	UT_DESC_TC(test_delta_hex8_overrun)
+	UT_DESC_TC(test_delta_hex8_msg)
+	UT_DESC_TC(test_delta_hex8_only_max_fail)
+	UT_DESC_TC(test_delta_hex8_only_min_fail)
+	UT_DESC_TC(test_delta_int16_bottom)
+	UT_DESC_TC(test_delta_int16_underrun)
+	UT_DESC_TC(test_delta_int16_top)
+	UT_DESC_TC(test_delta_int16_overrun)
+	UT_DESC_TC(test_delta_int16_msg)
+	UT_DESC_TC(test_delta_int16_only_max_fail)
+	UT_DESC_TC(test_delta_int16_only_min_fail)
+	UT_DESC_TC(test_delta_uint16_bottom)
+	UT_DESC_TC(test_delta_uint16_underrun)
+	UT_DESC_TC(test_delta_uint16_top)
+	UT_DESC_TC(test_delta_uint16_overrun)
+	UT_DESC_TC(test_delta_uint16_msg)
+	UT_DESC_TC(test_delta_uint16_only_max_fail)
+	UT_DESC_TC(test_delta_uint16_only_min_fail)
+	UT_DESC_TC(test_delta_hex16_bottom)
+	UT_DESC_TC(test_delta_hex16_underrun)
+	UT_DESC_TC(test_delta_hex16_top)
+	UT_DESC_TC(test_delta_hex16_overrun)
+	UT_DESC_TC(test_delta_hex16_msg)
+	UT_DESC_TC(test_delta_hex16_only_max_fail)
+	UT_DESC_TC(test_delta_hex16_only_min_fail)
+	UT_DESC_TC(test_delta_int32_bottom)
+	UT_DESC_TC(test_delta_int32_underrun)
+	UT_DESC_TC(test_delta_int32_top)
+	UT_DESC_TC(test_delta_int32_overrun)
+	UT_DESC_TC(test_delta_int32_msg)
+	UT_DESC_TC(test_delta_int32_only_max_fail)
+	UT_DESC_TC(test_delta_int32_only_min_fail)
+	UT_DESC_TC(test_delta_uint32_bottom)
+	UT_DESC_TC(test_delta_uint32_underrun)
+	UT_DESC_TC(test_delta_uint32_top)
+	UT_DESC_TC(test_delta_uint32_overrun)
+	UT_DESC_TC(test_delta_uint32_msg)
+	UT_DESC_TC(test_delta_uint32_only_max_fail)
+	UT_DESC_TC(test_delta_uint32_only_min_fail)
+	UT_DESC_TC(test_delta_hex32_bottom)
+	UT_DESC_TC(test_delta_hex32_underrun)
+	UT_DESC_TC(test_delta_hex32_top)
+	UT_DESC_TC(test_delta_hex32_overrun)
+	UT_DESC_TC(test_delta_hex32_msg)
+	UT_DESC_TC(test_delta_hex32_only_max_fail)
+	UT_DESC_TC(test_delta_hex32_only_min_fail)
+	UT_DESC_TC(test_delta_int64_bottom)
+	UT_DESC_TC(test_delta_int64_underrun)
+	UT_DESC_TC(test_delta_int64_top)
+	UT_DESC_TC(test_delta_int64_overrun)
+	UT_DESC_TC(test_delta_int64_msg)
+	UT_DESC_TC(test_delta_int64_only_max_fail)
+	UT_DESC_TC(test_delta_int64_only_min_fail)
+	UT_DESC_TC(test_delta_uint64_bottom)
+	UT_DESC_TC(test_delta_uint64_underrun)
+	UT_DESC_TC(test_delta_uint64_top)
+	UT_DESC_TC(test_delta_uint64_overrun)
+	UT_DESC_TC(test_delta_uint64_msg)
+	UT_DESC_TC(test_delta_uint64_only_max_fail)
+	UT_DESC_TC(test_delta_uint64_only_min_fail)
+	UT_DESC_TC(test_delta_hex64_bottom)
+	UT_DESC_TC(test_delta_hex64_underrun)
+	UT_DESC_TC(test_delta_hex64_top)
+	UT_DESC_TC(test_delta_hex64_overrun)
+	UT_DESC_TC(test_delta_hex64_msg)
+	UT_DESC_TC(test_delta_hex64_only_max_fail)
+	UT_DESC_TC(test_delta_hex64_only_min_fail)
+UT_DESC_TS_END();
\ No newline at end of file
@@ -0,0 +1,2061 @@
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief Range assertions xml test file
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * File that contains range part of the xml output test.
+ * @sa emunit_test_xml
+ */
+#include "test.h"
+#include <emunit.h>
+
+/**
+ * @brief The macro that creates expected details string
+ *
+ * This macro creates expected details string for range assertion.
+ * To be used with @ref test_expect_fail_assert.
+ *
+ * @param[in] min Minimum value in expected range
+ * @param[in] max Maximum value in expected range
+ * @param[in] a   Actual pattern in details pattern
+ *
+ * @return Range details expected pattern that matches given values.
+ *         Also contains format string ("%s") and comma before the pattern.
+ */
+#define TEST_RANGE_EXP(min, max, a)                \
+	"%s",                                          \
+	"[[:space:]]*<min>"EMUNIT_STR(min)"</min>"     \
+	"[[:space:]]*<max>"EMUNIT_STR(max)"</max>"     \
+	"[[:space:]]*<actual>"EMUNIT_STR(a)"</actual>"
+
+
+static void suite_init(void)
+{
+	test_expect_sinit_default("test_range_suite");
+}
+
+static void suite_cleanup(void)
+{
+	test_expect_scleanup_default();
+}
+
+
+static void test_range_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE(EMUNIT_SNUM_MIN, EMUNIT_SNUM_MAX, 0);
+	UT_ASSERT_RANGE(EMUNIT_SNUM_MIN, EMUNIT_SNUM_MAX, EMUNIT_SNUM_MAX);
+	UT_ASSERT_RANGE(EMUNIT_SNUM_MIN, EMUNIT_SNUM_MAX, EMUNIT_SNUM_MIN);
+	UT_ASSERT_RANGE(-10, 100, -10);
+	UT_ASSERT_RANGE(-10, 100, -10 + 1);
+	UT_ASSERT_RANGE(-10, 100, 100);
+	UT_ASSERT_RANGE(-10, 100, 100 - 1);
+	UT_ASSERT_RANGE(-10, 100, 45);
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(-10, 100, -11)
+		);
+	UT_ASSERT_RANGE(-10, 100, -10 - 1);
+}
+
+static void test_range_top(void)
+{
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(-10, 100, 101)
+		);
+	UT_ASSERT_RANGE(-10, 100, 100 + 1);
+}
+
+static void test_range_outrange_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE(100, -10, -10);
+	UT_ASSERT_RANGE(100, -10, 100);
+	UT_ASSERT_RANGE(100, -10, -10 - 1);
+	UT_ASSERT_RANGE(100, -10, 100 + 1);
+
+	UT_ASSERT_RANGE(100, -10, EMUNIT_SNUM_MIN);
+	UT_ASSERT_RANGE(100, -10, EMUNIT_SNUM_MAX);
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(100, -10, -9)
+		);
+	UT_ASSERT_RANGE(100, -10, -10 + 1);
+}
+
+static void test_range_outrange_top(void)
+{
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(100, -10, 99)
+		);
+	UT_ASSERT_RANGE(100, -10, 100 - 1);
+}
+
+static void test_range_outrange_middle(void)
+{
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(100, -10, 45)
+		);
+	UT_ASSERT_RANGE(100, -10, 45);
+}
+
+static void test_range_msg(void)
+{
+	UT_ASSERT_RANGE_MSG(-10, 100, -10, "Dummy message");
+	UT_ASSERT_RANGE_MSG(-10, 100, -10 + 1, "Dummy message");
+	UT_ASSERT_RANGE_MSG(-10, 100, 100, "Dummy message");
+	UT_ASSERT_RANGE_MSG(-10, 100, 100 - 1, "Dummy message");
+	UT_ASSERT_RANGE_MSG(-10, 100, 45, "Dummy message");
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for ",
+		TEST_RANGE_EXP(-10, 100, -11)
+		);
+	UT_ASSERT_RANGE_MSG(-10, 100, -10 - 1, "Message for %s", "");
+}
+
+static void test_range_int_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_INT(EMUNIT_SNUM_MIN, EMUNIT_SNUM_MAX, 0);
+	UT_ASSERT_RANGE_INT(EMUNIT_SNUM_MIN, EMUNIT_SNUM_MAX, EMUNIT_SNUM_MAX);
+	UT_ASSERT_RANGE_INT(EMUNIT_SNUM_MIN, EMUNIT_SNUM_MAX, EMUNIT_SNUM_MIN);
+	UT_ASSERT_RANGE_INT(-16000, 8000, -16000);
+	UT_ASSERT_RANGE_INT(-16000, 8000, -16000 + 1);
+	UT_ASSERT_RANGE_INT(-16000, 8000, 8000);
+	UT_ASSERT_RANGE_INT(-16000, 8000, 8000 - 1);
+	UT_ASSERT_RANGE_INT(-16000, 8000, -4000);
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(-16000, 8000, -16001)
+		);
+	UT_ASSERT_RANGE_INT(-16000, 8000, -16000 - 1);
+}
+
+static void test_range_int_top(void)
+{
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(-16000, 8000, 8001)
+		);
+	UT_ASSERT_RANGE_INT(-16000, 8000, 8000 + 1);
+}
+
+static void test_range_int_outrange_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_INT(8000, -16000, -16000);
+	UT_ASSERT_RANGE_INT(8000, -16000, 8000);
+	UT_ASSERT_RANGE_INT(8000, -16000, -16000 - 1);
+	UT_ASSERT_RANGE_INT(8000, -16000, 8000 + 1);
+
+	UT_ASSERT_RANGE_INT(8000, -16000, EMUNIT_SNUM_MIN);
+	UT_ASSERT_RANGE_INT(8000, -16000, EMUNIT_SNUM_MAX);
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(8000, -16000, -15999)
+		);
+	UT_ASSERT_RANGE_INT(8000, -16000, -16000 + 1);
+}
+
+static void test_range_int_outrange_top(void)
+{
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(8000, -16000, 7999)
+		);
+	UT_ASSERT_RANGE_INT(8000, -16000, 8000 - 1);
+}
+
+static void test_range_int_outrange_middle(void)
+{
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(8000, -16000, -4000)
+		);
+	UT_ASSERT_RANGE_INT(8000, -16000, -4000);
+}
+
+static void test_range_int_msg(void)
+{
+	UT_ASSERT_RANGE_INT_MSG(-16000, 8000, -16000, "Dummy message");
+	UT_ASSERT_RANGE_INT_MSG(-16000, 8000, -16000 + 1, "Dummy message");
+	UT_ASSERT_RANGE_INT_MSG(-16000, 8000, 8000, "Dummy message");
+	UT_ASSERT_RANGE_INT_MSG(-16000, 8000, 8000 - 1, "Dummy message");
+	UT_ASSERT_RANGE_INT_MSG(-16000, 8000, -4000, "Dummy message");
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _int",
+		TEST_RANGE_EXP(-16000, 8000, -16001)
+		);
+	UT_ASSERT_RANGE_INT_MSG(-16000, 8000, -16000 - 1, "Message for %s", "_int");
+}
+
+static void test_range_uint_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_UINT(EMUNIT_UNUM_MIN, EMUNIT_UNUM_MAX, EMUNIT_UNUM_MAX);
+	UT_ASSERT_RANGE_UINT(EMUNIT_UNUM_MIN, EMUNIT_UNUM_MAX, EMUNIT_UNUM_MIN);
+	UT_ASSERT_RANGE_UINT(1234, 2000, 1234);
+	UT_ASSERT_RANGE_UINT(1234, 2000, 1234 + 1u);
+	UT_ASSERT_RANGE_UINT(1234, 2000, 2000);
+	UT_ASSERT_RANGE_UINT(1234, 2000, 2000 - 1u);
+	UT_ASSERT_RANGE_UINT(1234, 2000, 1617u);
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(1234, 2000, 1233)
+		);
+	UT_ASSERT_RANGE_UINT(1234, 2000, 1234 - 1u);
+}
+
+static void test_range_uint_top(void)
+{
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(1234, 2000, 2001)
+		);
+	UT_ASSERT_RANGE_UINT(1234, 2000, 2000 + 1u);
+}
+
+static void test_range_uint_outrange_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_UINT(2000, 1234, 1234);
+	UT_ASSERT_RANGE_UINT(2000, 1234, 2000);
+	UT_ASSERT_RANGE_UINT(2000, 1234, 1234 - 1u);
+	UT_ASSERT_RANGE_UINT(2000, 1234, 2000 + 1u);
+
+	UT_ASSERT_RANGE_UINT(2000, 1234, EMUNIT_UNUM_MIN);
+	UT_ASSERT_RANGE_UINT(2000, 1234, EMUNIT_UNUM_MAX);
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(2000, 1234, 1235)
+		);
+	UT_ASSERT_RANGE_UINT(2000, 1234, 1234 + 1u);
+}
+
+static void test_range_uint_outrange_top(void)
+{
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(2000, 1234, 1999)
+		);
+	UT_ASSERT_RANGE_UINT(2000, 1234, 2000 - 1u);
+}
+
+static void test_range_uint_outrange_middle(void)
+{
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(2000, 1234, 1617)
+		);
+	UT_ASSERT_RANGE_UINT(2000, 1234, 1617u);
+}
+
+static void test_range_uint_msg(void)
+{
+	UT_ASSERT_RANGE_UINT_MSG(1234, 2000, 1234, "Dummy message");
+	UT_ASSERT_RANGE_UINT_MSG(1234, 2000, 1234 + 1u, "Dummy message");
+	UT_ASSERT_RANGE_UINT_MSG(1234, 2000, 2000, "Dummy message");
+	UT_ASSERT_RANGE_UINT_MSG(1234, 2000, 2000 - 1u, "Dummy message");
+	UT_ASSERT_RANGE_UINT_MSG(1234, 2000, 1617u, "Dummy message");
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _uint",
+		TEST_RANGE_EXP(1234, 2000, 1233)
+		);
+	UT_ASSERT_RANGE_UINT_MSG(1234, 2000, 1234 - 1u, "Message for %s", "_uint");
+}
+
+static void test_range_hex_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_HEX(EMUNIT_UNUM_MIN, EMUNIT_UNUM_MAX, 0);
+	UT_ASSERT_RANGE_HEX(EMUNIT_UNUM_MIN, EMUNIT_UNUM_MAX, EMUNIT_UNUM_MAX);
+	UT_ASSERT_RANGE_HEX(EMUNIT_UNUM_MIN, EMUNIT_UNUM_MAX, EMUNIT_UNUM_MIN);
+	UT_ASSERT_RANGE_HEX(0x1234, 0xabcd, 0x1234);
+	UT_ASSERT_RANGE_HEX(0x1234, 0xabcd, 0x1234 + 1u);
+	UT_ASSERT_RANGE_HEX(0x1234, 0xabcd, 0xabcd);
+	UT_ASSERT_RANGE_HEX(0x1234, 0xabcd, 0xabcd - 1u);
+	UT_ASSERT_RANGE_HEX(0x1234, 0xabcd, 24320u);
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0x1234, 0xabcd, 0x1233)
+		);
+	UT_ASSERT_RANGE_HEX(0x1234, 0xabcd, 0x1234 - 1u);
+}
+
+static void test_range_hex_top(void)
+{
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0x1234, 0xabcd, 0xabce)
+		);
+	UT_ASSERT_RANGE_HEX(0x1234, 0xabcd, 0xabcd + 1u);
+}
+
+static void test_range_hex_outrange_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_HEX(0xabcd, 0x1234, 0x1234);
+	UT_ASSERT_RANGE_HEX(0xabcd, 0x1234, 0xabcd);
+	UT_ASSERT_RANGE_HEX(0xabcd, 0x1234, 0x1234 - 1u);
+	UT_ASSERT_RANGE_HEX(0xabcd, 0x1234, 0xabcd + 1u);
+
+	UT_ASSERT_RANGE_HEX(0xabcd, 0x1234, EMUNIT_UNUM_MIN);
+	UT_ASSERT_RANGE_HEX(0xabcd, 0x1234, EMUNIT_UNUM_MAX);
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0xabcd, 0x1234, 0x1235)
+		);
+	UT_ASSERT_RANGE_HEX(0xabcd, 0x1234, 0x1234 + 1u);
+}
+
+static void test_range_hex_outrange_top(void)
+{
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0xabcd, 0x1234, 0xabcc)
+		);
+	UT_ASSERT_RANGE_HEX(0xabcd, 0x1234, 0xabcd - 1u);
+}
+
+static void test_range_hex_outrange_middle(void)
+{
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0xabcd, 0x1234, 0x5f00)
+		);
+	UT_ASSERT_RANGE_HEX(0xabcd, 0x1234, 24320u);
+}
+
+static void test_range_hex_msg(void)
+{
+	UT_ASSERT_RANGE_HEX_MSG(0x1234, 0xabcd, 0x1234, "Dummy message");
+	UT_ASSERT_RANGE_HEX_MSG(0x1234, 0xabcd, 0x1234 + 1u, "Dummy message");
+	UT_ASSERT_RANGE_HEX_MSG(0x1234, 0xabcd, 0xabcd, "Dummy message");
+	UT_ASSERT_RANGE_HEX_MSG(0x1234, 0xabcd, 0xabcd - 1u, "Dummy message");
+	UT_ASSERT_RANGE_HEX_MSG(0x1234, 0xabcd, 24320u, "Dummy message");
+	/* Should fail*/
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _hex",
+		TEST_RANGE_EXP(0x1234, 0xabcd, 0x1233)
+		);
+	UT_ASSERT_RANGE_HEX_MSG(0x1234, 0xabcd, 0x1234 - 1u, "Message for %s", "_hex");
+}
+
+static void test_range_int8_borders_passed(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_INT8(-128, 127, -128);
+	UT_ASSERT_RANGE_INT8(-128, 127, 127);
+	UT_ASSERT_RANGE_INT8(127, -128, -128);
+	UT_ASSERT_RANGE_INT8(127, -128, 127);
+	UT_ASSERT_RANGE_INT8(-128, 127, -1);
+}
+
+static void test_range_int8_borders_passed_msg(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_INT8_MSG(-128, 127, -128, "Dummy message" );
+	UT_ASSERT_RANGE_INT8_MSG(-128, 127, 127, "Dummy message" );
+	UT_ASSERT_RANGE_INT8_MSG(127, -128, -128, "Dummy message" );
+	UT_ASSERT_RANGE_INT8_MSG(127, -128, 127, "Dummy message" );
+	UT_ASSERT_RANGE_INT8_MSG(-128, 127, -1, "Dummy message" );
+}
+
+static void test_range_int8_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_INT8(-128, 127, -128);
+	UT_ASSERT_RANGE_INT8(-128, 127, 127);
+	UT_ASSERT_RANGE_INT8(-128, 127, -1);
+	UT_ASSERT_RANGE_INT8(-127, 127, -127);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(-127, 127, -128)
+		);
+	UT_ASSERT_RANGE_INT8(-127, 127, -128);
+}
+
+static void test_range_int8_top(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_INT8(-128, 127, -128);
+	UT_ASSERT_RANGE_INT8(-128, 127, 127);
+	UT_ASSERT_RANGE_INT8(-128, 127, -1);
+	UT_ASSERT_RANGE_INT8(-128, 126, 126);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(-128, 126, 127)
+		);
+	UT_ASSERT_RANGE_INT8(-128, 126, 127);
+}
+
+static void test_range_int8_outrange_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_INT8(127, -128, -128);
+	UT_ASSERT_RANGE_INT8(127, -128, 127);
+	UT_ASSERT_RANGE_INT8(125, -126, -128);
+	UT_ASSERT_RANGE_INT8(125, -126, 127);
+	UT_ASSERT_RANGE_INT8(125, -126, -126);
+	UT_ASSERT_RANGE_INT8(125, -126, 125);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(125, -126, -125)
+		);
+	UT_ASSERT_RANGE_INT8(125, -126, -125);
+}
+
+static void test_range_int8_outrange_top(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(125, -126, 124)
+		);
+	UT_ASSERT_RANGE_INT8(125, -126, 124);
+}
+
+static void test_range_int8_outrange_middle(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(127, -128, -1)
+		);
+	UT_ASSERT_RANGE_INT8(127, -128, -1);
+}
+
+static void test_range_int8_bottom_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _int8_bottom",
+		TEST_RANGE_EXP(-118, 117, -119)
+		);
+	UT_ASSERT_RANGE_INT8_MSG(-118, 117, -119, "Message for %s", "_int8_bottom" );
+}
+
+static void test_range_int8_top_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _int8_top",
+		TEST_RANGE_EXP(-118, 117, 118)
+		);
+	UT_ASSERT_RANGE_INT8_MSG(-118, 117, 118, "Message for %s", "_int8_top" );
+}
+
+static void test_range_uint8_borders_passed(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_UINT8(0u, 255u, 0u);
+	UT_ASSERT_RANGE_UINT8(0u, 255u, 255u);
+	UT_ASSERT_RANGE_UINT8(255u, 0u, 0u);
+	UT_ASSERT_RANGE_UINT8(255u, 0u, 255u);
+	UT_ASSERT_RANGE_UINT8(0u, 255u, 127u);
+}
+
+static void test_range_uint8_borders_passed_msg(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_UINT8_MSG(0u, 255u, 0u, "Dummy message" );
+	UT_ASSERT_RANGE_UINT8_MSG(0u, 255u, 255u, "Dummy message" );
+	UT_ASSERT_RANGE_UINT8_MSG(255u, 0u, 0u, "Dummy message" );
+	UT_ASSERT_RANGE_UINT8_MSG(255u, 0u, 255u, "Dummy message" );
+	UT_ASSERT_RANGE_UINT8_MSG(0u, 255u, 127u, "Dummy message" );
+}
+
+static void test_range_uint8_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_UINT8(0u, 255u, 0u);
+	UT_ASSERT_RANGE_UINT8(0u, 255u, 255u);
+	UT_ASSERT_RANGE_UINT8(0u, 255u, 127u);
+	UT_ASSERT_RANGE_UINT8(1u, 255u, 1u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(1, 255, 0)
+		);
+	UT_ASSERT_RANGE_UINT8(1u, 255u, 0u);
+}
+
+static void test_range_uint8_top(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_UINT8(0u, 255u, 0u);
+	UT_ASSERT_RANGE_UINT8(0u, 255u, 255u);
+	UT_ASSERT_RANGE_UINT8(0u, 255u, 127u);
+	UT_ASSERT_RANGE_UINT8(0u, 254u, 254u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0, 254, 255)
+		);
+	UT_ASSERT_RANGE_UINT8(0u, 254u, 255u);
+}
+
+static void test_range_uint8_outrange_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_UINT8(255u, 0u, 0u);
+	UT_ASSERT_RANGE_UINT8(255u, 0u, 255u);
+	UT_ASSERT_RANGE_UINT8(253u, 2u, 0u);
+	UT_ASSERT_RANGE_UINT8(253u, 2u, 255u);
+	UT_ASSERT_RANGE_UINT8(253u, 2u, 2u);
+	UT_ASSERT_RANGE_UINT8(253u, 2u, 253u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(253, 2, 3)
+		);
+	UT_ASSERT_RANGE_UINT8(253u, 2u, 3u);
+}
+
+static void test_range_uint8_outrange_top(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(253, 2, 252)
+		);
+	UT_ASSERT_RANGE_UINT8(253u, 2u, 252u);
+}
+
+static void test_range_uint8_outrange_middle(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(255, 0, 127)
+		);
+	UT_ASSERT_RANGE_UINT8(255u, 0u, 127u);
+}
+
+static void test_range_uint8_bottom_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _uint8_bottom",
+		TEST_RANGE_EXP(10, 245, 9)
+		);
+	UT_ASSERT_RANGE_UINT8_MSG(10u, 245u, 9u, "Message for %s", "_uint8_bottom" );
+}
+
+static void test_range_uint8_top_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _uint8_top",
+		TEST_RANGE_EXP(10, 245, 246)
+		);
+	UT_ASSERT_RANGE_UINT8_MSG(10u, 245u, 246u, "Message for %s", "_uint8_top" );
+}
+
+static void test_range_hex8_borders_passed(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_HEX8(0x0u, 0xffu, 0x0u);
+	UT_ASSERT_RANGE_HEX8(0x0u, 0xffu, 0xffu);
+	UT_ASSERT_RANGE_HEX8(0xffu, 0x0u, 0x0u);
+	UT_ASSERT_RANGE_HEX8(0xffu, 0x0u, 0xffu);
+	UT_ASSERT_RANGE_HEX8(0x0u, 0xffu, 0x7fu);
+}
+
+static void test_range_hex8_borders_passed_msg(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_HEX8_MSG(0x0u, 0xffu, 0x0u, "Dummy message" );
+	UT_ASSERT_RANGE_HEX8_MSG(0x0u, 0xffu, 0xffu, "Dummy message" );
+	UT_ASSERT_RANGE_HEX8_MSG(0xffu, 0x0u, 0x0u, "Dummy message" );
+	UT_ASSERT_RANGE_HEX8_MSG(0xffu, 0x0u, 0xffu, "Dummy message" );
+	UT_ASSERT_RANGE_HEX8_MSG(0x0u, 0xffu, 0x7fu, "Dummy message" );
+}
+
+static void test_range_hex8_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_HEX8(0x0u, 0xffu, 0x0u);
+	UT_ASSERT_RANGE_HEX8(0x0u, 0xffu, 0xffu);
+	UT_ASSERT_RANGE_HEX8(0x0u, 0xffu, 0x7fu);
+	UT_ASSERT_RANGE_HEX8(0x1u, 0xffu, 0x1u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0x1, 0xff, 0x0)
+		);
+	UT_ASSERT_RANGE_HEX8(0x1u, 0xffu, 0x0u);
+}
+
+static void test_range_hex8_top(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_HEX8(0x0u, 0xffu, 0x0u);
+	UT_ASSERT_RANGE_HEX8(0x0u, 0xffu, 0xffu);
+	UT_ASSERT_RANGE_HEX8(0x0u, 0xffu, 0x7fu);
+	UT_ASSERT_RANGE_HEX8(0x0u, 0xfeu, 0xfeu);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0x0, 0xfe, 0xff)
+		);
+	UT_ASSERT_RANGE_HEX8(0x0u, 0xfeu, 0xffu);
+}
+
+static void test_range_hex8_outrange_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_HEX8(0xffu, 0x0u, 0x0u);
+	UT_ASSERT_RANGE_HEX8(0xffu, 0x0u, 0xffu);
+	UT_ASSERT_RANGE_HEX8(0xfdu, 0x2u, 0x0u);
+	UT_ASSERT_RANGE_HEX8(0xfdu, 0x2u, 0xffu);
+	UT_ASSERT_RANGE_HEX8(0xfdu, 0x2u, 0x2u);
+	UT_ASSERT_RANGE_HEX8(0xfdu, 0x2u, 0xfdu);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0xfd, 0x2, 0x3)
+		);
+	UT_ASSERT_RANGE_HEX8(0xfdu, 0x2u, 0x3u);
+}
+
+static void test_range_hex8_outrange_top(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0xfd, 0x2, 0xfc)
+		);
+	UT_ASSERT_RANGE_HEX8(0xfdu, 0x2u, 0xfcu);
+}
+
+static void test_range_hex8_outrange_middle(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0xff, 0x0, 0x7f)
+		);
+	UT_ASSERT_RANGE_HEX8(0xffu, 0x0u, 0x7fu);
+}
+
+static void test_range_hex8_bottom_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _hex8_bottom",
+		TEST_RANGE_EXP(0xa, 0xf5, 0x9)
+		);
+	UT_ASSERT_RANGE_HEX8_MSG(0xau, 0xf5u, 0x9u, "Message for %s", "_hex8_bottom" );
+}
+
+static void test_range_hex8_top_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _hex8_top",
+		TEST_RANGE_EXP(0xa, 0xf5, 0xf6)
+		);
+	UT_ASSERT_RANGE_HEX8_MSG(0xau, 0xf5u, 0xf6u, "Message for %s", "_hex8_top" );
+}
+
+static void test_range_int16_borders_passed(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_INT16(-32768, 32767, -32768);
+	UT_ASSERT_RANGE_INT16(-32768, 32767, 32767);
+	UT_ASSERT_RANGE_INT16(32767, -32768, -32768);
+	UT_ASSERT_RANGE_INT16(32767, -32768, 32767);
+	UT_ASSERT_RANGE_INT16(-32768, 32767, -1);
+}
+
+static void test_range_int16_borders_passed_msg(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_INT16_MSG(-32768, 32767, -32768, "Dummy message" );
+	UT_ASSERT_RANGE_INT16_MSG(-32768, 32767, 32767, "Dummy message" );
+	UT_ASSERT_RANGE_INT16_MSG(32767, -32768, -32768, "Dummy message" );
+	UT_ASSERT_RANGE_INT16_MSG(32767, -32768, 32767, "Dummy message" );
+	UT_ASSERT_RANGE_INT16_MSG(-32768, 32767, -1, "Dummy message" );
+}
+
+static void test_range_int16_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_INT16(-32768, 32767, -32768);
+	UT_ASSERT_RANGE_INT16(-32768, 32767, 32767);
+	UT_ASSERT_RANGE_INT16(-32768, 32767, -1);
+	UT_ASSERT_RANGE_INT16(-32767, 32767, -32767);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(-32767, 32767, -32768)
+		);
+	UT_ASSERT_RANGE_INT16(-32767, 32767, -32768);
+}
+
+static void test_range_int16_top(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_INT16(-32768, 32767, -32768);
+	UT_ASSERT_RANGE_INT16(-32768, 32767, 32767);
+	UT_ASSERT_RANGE_INT16(-32768, 32767, -1);
+	UT_ASSERT_RANGE_INT16(-32768, 32766, 32766);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(-32768, 32766, 32767)
+		);
+	UT_ASSERT_RANGE_INT16(-32768, 32766, 32767);
+}
+
+static void test_range_int16_outrange_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_INT16(32767, -32768, -32768);
+	UT_ASSERT_RANGE_INT16(32767, -32768, 32767);
+	UT_ASSERT_RANGE_INT16(32765, -32766, -32768);
+	UT_ASSERT_RANGE_INT16(32765, -32766, 32767);
+	UT_ASSERT_RANGE_INT16(32765, -32766, -32766);
+	UT_ASSERT_RANGE_INT16(32765, -32766, 32765);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(32765, -32766, -32765)
+		);
+	UT_ASSERT_RANGE_INT16(32765, -32766, -32765);
+}
+
+static void test_range_int16_outrange_top(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(32765, -32766, 32764)
+		);
+	UT_ASSERT_RANGE_INT16(32765, -32766, 32764);
+}
+
+static void test_range_int16_outrange_middle(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(32767, -32768, -1)
+		);
+	UT_ASSERT_RANGE_INT16(32767, -32768, -1);
+}
+
+static void test_range_int16_bottom_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _int16_bottom",
+		TEST_RANGE_EXP(-32758, 32757, -32759)
+		);
+	UT_ASSERT_RANGE_INT16_MSG(-32758, 32757, -32759, "Message for %s", "_int16_bottom" );
+}
+
+static void test_range_int16_top_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _int16_top",
+		TEST_RANGE_EXP(-32758, 32757, 32758)
+		);
+	UT_ASSERT_RANGE_INT16_MSG(-32758, 32757, 32758, "Message for %s", "_int16_top" );
+}
+
+static void test_range_uint16_borders_passed(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_UINT16(0u, 65535u, 0u);
+	UT_ASSERT_RANGE_UINT16(0u, 65535u, 65535u);
+	UT_ASSERT_RANGE_UINT16(65535u, 0u, 0u);
+	UT_ASSERT_RANGE_UINT16(65535u, 0u, 65535u);
+	UT_ASSERT_RANGE_UINT16(0u, 65535u, 32767u);
+}
+
+static void test_range_uint16_borders_passed_msg(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_UINT16_MSG(0u, 65535u, 0u, "Dummy message" );
+	UT_ASSERT_RANGE_UINT16_MSG(0u, 65535u, 65535u, "Dummy message" );
+	UT_ASSERT_RANGE_UINT16_MSG(65535u, 0u, 0u, "Dummy message" );
+	UT_ASSERT_RANGE_UINT16_MSG(65535u, 0u, 65535u, "Dummy message" );
+	UT_ASSERT_RANGE_UINT16_MSG(0u, 65535u, 32767u, "Dummy message" );
+}
+
+static void test_range_uint16_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_UINT16(0u, 65535u, 0u);
+	UT_ASSERT_RANGE_UINT16(0u, 65535u, 65535u);
+	UT_ASSERT_RANGE_UINT16(0u, 65535u, 32767u);
+	UT_ASSERT_RANGE_UINT16(1u, 65535u, 1u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(1, 65535, 0)
+		);
+	UT_ASSERT_RANGE_UINT16(1u, 65535u, 0u);
+}
+
+static void test_range_uint16_top(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_UINT16(0u, 65535u, 0u);
+	UT_ASSERT_RANGE_UINT16(0u, 65535u, 65535u);
+	UT_ASSERT_RANGE_UINT16(0u, 65535u, 32767u);
+	UT_ASSERT_RANGE_UINT16(0u, 65534u, 65534u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0, 65534, 65535)
+		);
+	UT_ASSERT_RANGE_UINT16(0u, 65534u, 65535u);
+}
+
+static void test_range_uint16_outrange_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_UINT16(65535u, 0u, 0u);
+	UT_ASSERT_RANGE_UINT16(65535u, 0u, 65535u);
+	UT_ASSERT_RANGE_UINT16(65533u, 2u, 0u);
+	UT_ASSERT_RANGE_UINT16(65533u, 2u, 65535u);
+	UT_ASSERT_RANGE_UINT16(65533u, 2u, 2u);
+	UT_ASSERT_RANGE_UINT16(65533u, 2u, 65533u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(65533, 2, 3)
+		);
+	UT_ASSERT_RANGE_UINT16(65533u, 2u, 3u);
+}
+
+static void test_range_uint16_outrange_top(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(65533, 2, 65532)
+		);
+	UT_ASSERT_RANGE_UINT16(65533u, 2u, 65532u);
+}
+
+static void test_range_uint16_outrange_middle(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(65535, 0, 32767)
+		);
+	UT_ASSERT_RANGE_UINT16(65535u, 0u, 32767u);
+}
+
+static void test_range_uint16_bottom_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _uint16_bottom",
+		TEST_RANGE_EXP(10, 65525, 9)
+		);
+	UT_ASSERT_RANGE_UINT16_MSG(10u, 65525u, 9u, "Message for %s", "_uint16_bottom" );
+}
+
+static void test_range_uint16_top_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _uint16_top",
+		TEST_RANGE_EXP(10, 65525, 65526)
+		);
+	UT_ASSERT_RANGE_UINT16_MSG(10u, 65525u, 65526u, "Message for %s", "_uint16_top" );
+}
+
+static void test_range_hex16_borders_passed(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_HEX16(0x0u, 0xffffu, 0x0u);
+	UT_ASSERT_RANGE_HEX16(0x0u, 0xffffu, 0xffffu);
+	UT_ASSERT_RANGE_HEX16(0xffffu, 0x0u, 0x0u);
+	UT_ASSERT_RANGE_HEX16(0xffffu, 0x0u, 0xffffu);
+	UT_ASSERT_RANGE_HEX16(0x0u, 0xffffu, 0x7fffu);
+}
+
+static void test_range_hex16_borders_passed_msg(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_HEX16_MSG(0x0u, 0xffffu, 0x0u, "Dummy message" );
+	UT_ASSERT_RANGE_HEX16_MSG(0x0u, 0xffffu, 0xffffu, "Dummy message" );
+	UT_ASSERT_RANGE_HEX16_MSG(0xffffu, 0x0u, 0x0u, "Dummy message" );
+	UT_ASSERT_RANGE_HEX16_MSG(0xffffu, 0x0u, 0xffffu, "Dummy message" );
+	UT_ASSERT_RANGE_HEX16_MSG(0x0u, 0xffffu, 0x7fffu, "Dummy message" );
+}
+
+static void test_range_hex16_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_HEX16(0x0u, 0xffffu, 0x0u);
+	UT_ASSERT_RANGE_HEX16(0x0u, 0xffffu, 0xffffu);
+	UT_ASSERT_RANGE_HEX16(0x0u, 0xffffu, 0x7fffu);
+	UT_ASSERT_RANGE_HEX16(0x1u, 0xffffu, 0x1u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0x1, 0xffff, 0x0)
+		);
+	UT_ASSERT_RANGE_HEX16(0x1u, 0xffffu, 0x0u);
+}
+
+static void test_range_hex16_top(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_HEX16(0x0u, 0xffffu, 0x0u);
+	UT_ASSERT_RANGE_HEX16(0x0u, 0xffffu, 0xffffu);
+	UT_ASSERT_RANGE_HEX16(0x0u, 0xffffu, 0x7fffu);
+	UT_ASSERT_RANGE_HEX16(0x0u, 0xfffeu, 0xfffeu);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0x0, 0xfffe, 0xffff)
+		);
+	UT_ASSERT_RANGE_HEX16(0x0u, 0xfffeu, 0xffffu);
+}
+
+static void test_range_hex16_outrange_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_HEX16(0xffffu, 0x0u, 0x0u);
+	UT_ASSERT_RANGE_HEX16(0xffffu, 0x0u, 0xffffu);
+	UT_ASSERT_RANGE_HEX16(0xfffdu, 0x2u, 0x0u);
+	UT_ASSERT_RANGE_HEX16(0xfffdu, 0x2u, 0xffffu);
+	UT_ASSERT_RANGE_HEX16(0xfffdu, 0x2u, 0x2u);
+	UT_ASSERT_RANGE_HEX16(0xfffdu, 0x2u, 0xfffdu);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0xfffd, 0x2, 0x3)
+		);
+	UT_ASSERT_RANGE_HEX16(0xfffdu, 0x2u, 0x3u);
+}
+
+static void test_range_hex16_outrange_top(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0xfffd, 0x2, 0xfffc)
+		);
+	UT_ASSERT_RANGE_HEX16(0xfffdu, 0x2u, 0xfffcu);
+}
+
+static void test_range_hex16_outrange_middle(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0xffff, 0x0, 0x7fff)
+		);
+	UT_ASSERT_RANGE_HEX16(0xffffu, 0x0u, 0x7fffu);
+}
+
+static void test_range_hex16_bottom_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _hex16_bottom",
+		TEST_RANGE_EXP(0xa, 0xfff5, 0x9)
+		);
+	UT_ASSERT_RANGE_HEX16_MSG(0xau, 0xfff5u, 0x9u, "Message for %s", "_hex16_bottom" );
+}
+
+static void test_range_hex16_top_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _hex16_top",
+		TEST_RANGE_EXP(0xa, 0xfff5, 0xfff6)
+		);
+	UT_ASSERT_RANGE_HEX16_MSG(0xau, 0xfff5u, 0xfff6u, "Message for %s", "_hex16_top" );
+}
+
+static void test_range_int32_borders_passed(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_INT32(-2147483648, 2147483647, -2147483648);
+	UT_ASSERT_RANGE_INT32(-2147483648, 2147483647, 2147483647);
+	UT_ASSERT_RANGE_INT32(2147483647, -2147483648, -2147483648);
+	UT_ASSERT_RANGE_INT32(2147483647, -2147483648, 2147483647);
+	UT_ASSERT_RANGE_INT32(-2147483648, 2147483647, -1);
+}
+
+static void test_range_int32_borders_passed_msg(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_INT32_MSG(-2147483648, 2147483647, -2147483648, "Dummy message" );
+	UT_ASSERT_RANGE_INT32_MSG(-2147483648, 2147483647, 2147483647, "Dummy message" );
+	UT_ASSERT_RANGE_INT32_MSG(2147483647, -2147483648, -2147483648, "Dummy message" );
+	UT_ASSERT_RANGE_INT32_MSG(2147483647, -2147483648, 2147483647, "Dummy message" );
+	UT_ASSERT_RANGE_INT32_MSG(-2147483648, 2147483647, -1, "Dummy message" );
+}
+
+static void test_range_int32_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_INT32(-2147483648, 2147483647, -2147483648);
+	UT_ASSERT_RANGE_INT32(-2147483648, 2147483647, 2147483647);
+	UT_ASSERT_RANGE_INT32(-2147483648, 2147483647, -1);
+	UT_ASSERT_RANGE_INT32(-2147483647, 2147483647, -2147483647);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(-2147483647, 2147483647, -2147483648)
+		);
+	UT_ASSERT_RANGE_INT32(-2147483647, 2147483647, -2147483648);
+}
+
+static void test_range_int32_top(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_INT32(-2147483648, 2147483647, -2147483648);
+	UT_ASSERT_RANGE_INT32(-2147483648, 2147483647, 2147483647);
+	UT_ASSERT_RANGE_INT32(-2147483648, 2147483647, -1);
+	UT_ASSERT_RANGE_INT32(-2147483648, 2147483646, 2147483646);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(-2147483648, 2147483646, 2147483647)
+		);
+	UT_ASSERT_RANGE_INT32(-2147483648, 2147483646, 2147483647);
+}
+
+static void test_range_int32_outrange_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_INT32(2147483647, -2147483648, -2147483648);
+	UT_ASSERT_RANGE_INT32(2147483647, -2147483648, 2147483647);
+	UT_ASSERT_RANGE_INT32(2147483645, -2147483646, -2147483648);
+	UT_ASSERT_RANGE_INT32(2147483645, -2147483646, 2147483647);
+	UT_ASSERT_RANGE_INT32(2147483645, -2147483646, -2147483646);
+	UT_ASSERT_RANGE_INT32(2147483645, -2147483646, 2147483645);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(2147483645, -2147483646, -2147483645)
+		);
+	UT_ASSERT_RANGE_INT32(2147483645, -2147483646, -2147483645);
+}
+
+static void test_range_int32_outrange_top(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(2147483645, -2147483646, 2147483644)
+		);
+	UT_ASSERT_RANGE_INT32(2147483645, -2147483646, 2147483644);
+}
+
+static void test_range_int32_outrange_middle(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(2147483647, -2147483648, -1)
+		);
+	UT_ASSERT_RANGE_INT32(2147483647, -2147483648, -1);
+}
+
+static void test_range_int32_bottom_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _int32_bottom",
+		TEST_RANGE_EXP(-2147483638, 2147483637, -2147483639)
+		);
+	UT_ASSERT_RANGE_INT32_MSG(-2147483638, 2147483637, -2147483639, "Message for %s", "_int32_bottom" );
+}
+
+static void test_range_int32_top_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _int32_top",
+		TEST_RANGE_EXP(-2147483638, 2147483637, 2147483638)
+		);
+	UT_ASSERT_RANGE_INT32_MSG(-2147483638, 2147483637, 2147483638, "Message for %s", "_int32_top" );
+}
+
+static void test_range_uint32_borders_passed(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_UINT32(0u, 4294967295u, 0u);
+	UT_ASSERT_RANGE_UINT32(0u, 4294967295u, 4294967295u);
+	UT_ASSERT_RANGE_UINT32(4294967295u, 0u, 0u);
+	UT_ASSERT_RANGE_UINT32(4294967295u, 0u, 4294967295u);
+	UT_ASSERT_RANGE_UINT32(0u, 4294967295u, 2147483647u);
+}
+
+static void test_range_uint32_borders_passed_msg(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_UINT32_MSG(0u, 4294967295u, 0u, "Dummy message" );
+	UT_ASSERT_RANGE_UINT32_MSG(0u, 4294967295u, 4294967295u, "Dummy message" );
+	UT_ASSERT_RANGE_UINT32_MSG(4294967295u, 0u, 0u, "Dummy message" );
+	UT_ASSERT_RANGE_UINT32_MSG(4294967295u, 0u, 4294967295u, "Dummy message" );
+	UT_ASSERT_RANGE_UINT32_MSG(0u, 4294967295u, 2147483647u, "Dummy message" );
+}
+
+static void test_range_uint32_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_UINT32(0u, 4294967295u, 0u);
+	UT_ASSERT_RANGE_UINT32(0u, 4294967295u, 4294967295u);
+	UT_ASSERT_RANGE_UINT32(0u, 4294967295u, 2147483647u);
+	UT_ASSERT_RANGE_UINT32(1u, 4294967295u, 1u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(1, 4294967295, 0)
+		);
+	UT_ASSERT_RANGE_UINT32(1u, 4294967295u, 0u);
+}
+
+static void test_range_uint32_top(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_UINT32(0u, 4294967295u, 0u);
+	UT_ASSERT_RANGE_UINT32(0u, 4294967295u, 4294967295u);
+	UT_ASSERT_RANGE_UINT32(0u, 4294967295u, 2147483647u);
+	UT_ASSERT_RANGE_UINT32(0u, 4294967294u, 4294967294u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0, 4294967294, 4294967295)
+		);
+	UT_ASSERT_RANGE_UINT32(0u, 4294967294u, 4294967295u);
+}
+
+static void test_range_uint32_outrange_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_UINT32(4294967295u, 0u, 0u);
+	UT_ASSERT_RANGE_UINT32(4294967295u, 0u, 4294967295u);
+	UT_ASSERT_RANGE_UINT32(4294967293u, 2u, 0u);
+	UT_ASSERT_RANGE_UINT32(4294967293u, 2u, 4294967295u);
+	UT_ASSERT_RANGE_UINT32(4294967293u, 2u, 2u);
+	UT_ASSERT_RANGE_UINT32(4294967293u, 2u, 4294967293u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(4294967293, 2, 3)
+		);
+	UT_ASSERT_RANGE_UINT32(4294967293u, 2u, 3u);
+}
+
+static void test_range_uint32_outrange_top(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(4294967293, 2, 4294967292)
+		);
+	UT_ASSERT_RANGE_UINT32(4294967293u, 2u, 4294967292u);
+}
+
+static void test_range_uint32_outrange_middle(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(4294967295, 0, 2147483647)
+		);
+	UT_ASSERT_RANGE_UINT32(4294967295u, 0u, 2147483647u);
+}
+
+static void test_range_uint32_bottom_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _uint32_bottom",
+		TEST_RANGE_EXP(10, 4294967285, 9)
+		);
+	UT_ASSERT_RANGE_UINT32_MSG(10u, 4294967285u, 9u, "Message for %s", "_uint32_bottom" );
+}
+
+static void test_range_uint32_top_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _uint32_top",
+		TEST_RANGE_EXP(10, 4294967285, 4294967286)
+		);
+	UT_ASSERT_RANGE_UINT32_MSG(10u, 4294967285u, 4294967286u, "Message for %s", "_uint32_top" );
+}
+
+static void test_range_hex32_borders_passed(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_HEX32(0x0u, 0xffffffffu, 0x0u);
+	UT_ASSERT_RANGE_HEX32(0x0u, 0xffffffffu, 0xffffffffu);
+	UT_ASSERT_RANGE_HEX32(0xffffffffu, 0x0u, 0x0u);
+	UT_ASSERT_RANGE_HEX32(0xffffffffu, 0x0u, 0xffffffffu);
+	UT_ASSERT_RANGE_HEX32(0x0u, 0xffffffffu, 0x7fffffffu);
+}
+
+static void test_range_hex32_borders_passed_msg(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_HEX32_MSG(0x0u, 0xffffffffu, 0x0u, "Dummy message" );
+	UT_ASSERT_RANGE_HEX32_MSG(0x0u, 0xffffffffu, 0xffffffffu, "Dummy message" );
+	UT_ASSERT_RANGE_HEX32_MSG(0xffffffffu, 0x0u, 0x0u, "Dummy message" );
+	UT_ASSERT_RANGE_HEX32_MSG(0xffffffffu, 0x0u, 0xffffffffu, "Dummy message" );
+	UT_ASSERT_RANGE_HEX32_MSG(0x0u, 0xffffffffu, 0x7fffffffu, "Dummy message" );
+}
+
+static void test_range_hex32_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_HEX32(0x0u, 0xffffffffu, 0x0u);
+	UT_ASSERT_RANGE_HEX32(0x0u, 0xffffffffu, 0xffffffffu);
+	UT_ASSERT_RANGE_HEX32(0x0u, 0xffffffffu, 0x7fffffffu);
+	UT_ASSERT_RANGE_HEX32(0x1u, 0xffffffffu, 0x1u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0x1, 0xffffffff, 0x0)
+		);
+	UT_ASSERT_RANGE_HEX32(0x1u, 0xffffffffu, 0x0u);
+}
+
+static void test_range_hex32_top(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_HEX32(0x0u, 0xffffffffu, 0x0u);
+	UT_ASSERT_RANGE_HEX32(0x0u, 0xffffffffu, 0xffffffffu);
+	UT_ASSERT_RANGE_HEX32(0x0u, 0xffffffffu, 0x7fffffffu);
+	UT_ASSERT_RANGE_HEX32(0x0u, 0xfffffffeu, 0xfffffffeu);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0x0, 0xfffffffe, 0xffffffff)
+		);
+	UT_ASSERT_RANGE_HEX32(0x0u, 0xfffffffeu, 0xffffffffu);
+}
+
+static void test_range_hex32_outrange_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_HEX32(0xffffffffu, 0x0u, 0x0u);
+	UT_ASSERT_RANGE_HEX32(0xffffffffu, 0x0u, 0xffffffffu);
+	UT_ASSERT_RANGE_HEX32(0xfffffffdu, 0x2u, 0x0u);
+	UT_ASSERT_RANGE_HEX32(0xfffffffdu, 0x2u, 0xffffffffu);
+	UT_ASSERT_RANGE_HEX32(0xfffffffdu, 0x2u, 0x2u);
+	UT_ASSERT_RANGE_HEX32(0xfffffffdu, 0x2u, 0xfffffffdu);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0xfffffffd, 0x2, 0x3)
+		);
+	UT_ASSERT_RANGE_HEX32(0xfffffffdu, 0x2u, 0x3u);
+}
+
+static void test_range_hex32_outrange_top(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0xfffffffd, 0x2, 0xfffffffc)
+		);
+	UT_ASSERT_RANGE_HEX32(0xfffffffdu, 0x2u, 0xfffffffcu);
+}
+
+static void test_range_hex32_outrange_middle(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0xffffffff, 0x0, 0x7fffffff)
+		);
+	UT_ASSERT_RANGE_HEX32(0xffffffffu, 0x0u, 0x7fffffffu);
+}
+
+static void test_range_hex32_bottom_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _hex32_bottom",
+		TEST_RANGE_EXP(0xa, 0xfffffff5, 0x9)
+		);
+	UT_ASSERT_RANGE_HEX32_MSG(0xau, 0xfffffff5u, 0x9u, "Message for %s", "_hex32_bottom" );
+}
+
+static void test_range_hex32_top_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _hex32_top",
+		TEST_RANGE_EXP(0xa, 0xfffffff5, 0xfffffff6)
+		);
+	UT_ASSERT_RANGE_HEX32_MSG(0xau, 0xfffffff5u, 0xfffffff6u, "Message for %s", "_hex32_top" );
+}
+
+static void test_range_int64_borders_passed(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_INT64(-9223372036854775808u, 9223372036854775807u, -9223372036854775808u);
+	UT_ASSERT_RANGE_INT64(-9223372036854775808u, 9223372036854775807u, 9223372036854775807u);
+	UT_ASSERT_RANGE_INT64(9223372036854775807u, -9223372036854775808u, -9223372036854775808u);
+	UT_ASSERT_RANGE_INT64(9223372036854775807u, -9223372036854775808u, 9223372036854775807u);
+	UT_ASSERT_RANGE_INT64(-9223372036854775808u, 9223372036854775807u, -1u);
+}
+
+static void test_range_int64_borders_passed_msg(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_INT64_MSG(-9223372036854775808u, 9223372036854775807u, -9223372036854775808u, "Dummy message" );
+	UT_ASSERT_RANGE_INT64_MSG(-9223372036854775808u, 9223372036854775807u, 9223372036854775807u, "Dummy message" );
+	UT_ASSERT_RANGE_INT64_MSG(9223372036854775807u, -9223372036854775808u, -9223372036854775808u, "Dummy message" );
+	UT_ASSERT_RANGE_INT64_MSG(9223372036854775807u, -9223372036854775808u, 9223372036854775807u, "Dummy message" );
+	UT_ASSERT_RANGE_INT64_MSG(-9223372036854775808u, 9223372036854775807u, -1u, "Dummy message" );
+}
+
+static void test_range_int64_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_INT64(-9223372036854775808u, 9223372036854775807u, -9223372036854775808u);
+	UT_ASSERT_RANGE_INT64(-9223372036854775808u, 9223372036854775807u, 9223372036854775807u);
+	UT_ASSERT_RANGE_INT64(-9223372036854775808u, 9223372036854775807u, -1u);
+	UT_ASSERT_RANGE_INT64(-9223372036854775807u, 9223372036854775807u, -9223372036854775807u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(-9223372036854775807, 9223372036854775807, -9223372036854775808)
+		);
+	UT_ASSERT_RANGE_INT64(-9223372036854775807u, 9223372036854775807u, -9223372036854775808u);
+}
+
+static void test_range_int64_top(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_INT64(-9223372036854775808u, 9223372036854775807u, -9223372036854775808u);
+	UT_ASSERT_RANGE_INT64(-9223372036854775808u, 9223372036854775807u, 9223372036854775807u);
+	UT_ASSERT_RANGE_INT64(-9223372036854775808u, 9223372036854775807u, -1u);
+	UT_ASSERT_RANGE_INT64(-9223372036854775808u, 9223372036854775806u, 9223372036854775806u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(-9223372036854775808, 9223372036854775806, 9223372036854775807)
+		);
+	UT_ASSERT_RANGE_INT64(-9223372036854775808u, 9223372036854775806u, 9223372036854775807u);
+}
+
+static void test_range_int64_outrange_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_INT64(9223372036854775807u, -9223372036854775808u, -9223372036854775808u);
+	UT_ASSERT_RANGE_INT64(9223372036854775807u, -9223372036854775808u, 9223372036854775807u);
+	UT_ASSERT_RANGE_INT64(9223372036854775805u, -9223372036854775806u, -9223372036854775808u);
+	UT_ASSERT_RANGE_INT64(9223372036854775805u, -9223372036854775806u, 9223372036854775807u);
+	UT_ASSERT_RANGE_INT64(9223372036854775805u, -9223372036854775806u, -9223372036854775806u);
+	UT_ASSERT_RANGE_INT64(9223372036854775805u, -9223372036854775806u, 9223372036854775805u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(9223372036854775805, -9223372036854775806, -9223372036854775805)
+		);
+	UT_ASSERT_RANGE_INT64(9223372036854775805u, -9223372036854775806u, -9223372036854775805u);
+}
+
+static void test_range_int64_outrange_top(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(9223372036854775805, -9223372036854775806, 9223372036854775804)
+		);
+	UT_ASSERT_RANGE_INT64(9223372036854775805u, -9223372036854775806u, 9223372036854775804u);
+}
+
+static void test_range_int64_outrange_middle(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(9223372036854775807, -9223372036854775808, -1)
+		);
+	UT_ASSERT_RANGE_INT64(9223372036854775807u, -9223372036854775808u, -1u);
+}
+
+static void test_range_int64_bottom_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _int64_bottom",
+		TEST_RANGE_EXP(-9223372036854775798, 9223372036854775797, -9223372036854775799)
+		);
+	UT_ASSERT_RANGE_INT64_MSG(-9223372036854775798u, 9223372036854775797u, -9223372036854775799u, "Message for %s", "_int64_bottom" );
+}
+
+static void test_range_int64_top_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _int64_top",
+		TEST_RANGE_EXP(-9223372036854775798, 9223372036854775797, 9223372036854775798)
+		);
+	UT_ASSERT_RANGE_INT64_MSG(-9223372036854775798u, 9223372036854775797u, 9223372036854775798u, "Message for %s", "_int64_top" );
+}
+
+static void test_range_uint64_borders_passed(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_UINT64(0u, 18446744073709551615u, 0u);
+	UT_ASSERT_RANGE_UINT64(0u, 18446744073709551615u, 18446744073709551615u);
+	UT_ASSERT_RANGE_UINT64(18446744073709551615u, 0u, 0u);
+	UT_ASSERT_RANGE_UINT64(18446744073709551615u, 0u, 18446744073709551615u);
+	UT_ASSERT_RANGE_UINT64(0u, 18446744073709551615u, 9223372036854775807u);
+}
+
+static void test_range_uint64_borders_passed_msg(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_UINT64_MSG(0u, 18446744073709551615u, 0u, "Dummy message" );
+	UT_ASSERT_RANGE_UINT64_MSG(0u, 18446744073709551615u, 18446744073709551615u, "Dummy message" );
+	UT_ASSERT_RANGE_UINT64_MSG(18446744073709551615u, 0u, 0u, "Dummy message" );
+	UT_ASSERT_RANGE_UINT64_MSG(18446744073709551615u, 0u, 18446744073709551615u, "Dummy message" );
+	UT_ASSERT_RANGE_UINT64_MSG(0u, 18446744073709551615u, 9223372036854775807u, "Dummy message" );
+}
+
+static void test_range_uint64_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_UINT64(0u, 18446744073709551615u, 0u);
+	UT_ASSERT_RANGE_UINT64(0u, 18446744073709551615u, 18446744073709551615u);
+	UT_ASSERT_RANGE_UINT64(0u, 18446744073709551615u, 9223372036854775807u);
+	UT_ASSERT_RANGE_UINT64(1u, 18446744073709551615u, 1u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(1, 18446744073709551615, 0)
+		);
+	UT_ASSERT_RANGE_UINT64(1u, 18446744073709551615u, 0u);
+}
+
+static void test_range_uint64_top(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_UINT64(0u, 18446744073709551615u, 0u);
+	UT_ASSERT_RANGE_UINT64(0u, 18446744073709551615u, 18446744073709551615u);
+	UT_ASSERT_RANGE_UINT64(0u, 18446744073709551615u, 9223372036854775807u);
+	UT_ASSERT_RANGE_UINT64(0u, 18446744073709551614u, 18446744073709551614u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0, 18446744073709551614, 18446744073709551615)
+		);
+	UT_ASSERT_RANGE_UINT64(0u, 18446744073709551614u, 18446744073709551615u);
+}
+
+static void test_range_uint64_outrange_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_UINT64(18446744073709551615u, 0u, 0u);
+	UT_ASSERT_RANGE_UINT64(18446744073709551615u, 0u, 18446744073709551615u);
+	UT_ASSERT_RANGE_UINT64(18446744073709551613u, 2u, 0u);
+	UT_ASSERT_RANGE_UINT64(18446744073709551613u, 2u, 18446744073709551615u);
+	UT_ASSERT_RANGE_UINT64(18446744073709551613u, 2u, 2u);
+	UT_ASSERT_RANGE_UINT64(18446744073709551613u, 2u, 18446744073709551613u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(18446744073709551613, 2, 3)
+		);
+	UT_ASSERT_RANGE_UINT64(18446744073709551613u, 2u, 3u);
+}
+
+static void test_range_uint64_outrange_top(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(18446744073709551613, 2, 18446744073709551612)
+		);
+	UT_ASSERT_RANGE_UINT64(18446744073709551613u, 2u, 18446744073709551612u);
+}
+
+static void test_range_uint64_outrange_middle(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(18446744073709551615, 0, 9223372036854775807)
+		);
+	UT_ASSERT_RANGE_UINT64(18446744073709551615u, 0u, 9223372036854775807u);
+}
+
+static void test_range_uint64_bottom_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _uint64_bottom",
+		TEST_RANGE_EXP(10, 18446744073709551605, 9)
+		);
+	UT_ASSERT_RANGE_UINT64_MSG(10u, 18446744073709551605u, 9u, "Message for %s", "_uint64_bottom" );
+}
+
+static void test_range_uint64_top_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _uint64_top",
+		TEST_RANGE_EXP(10, 18446744073709551605, 18446744073709551606)
+		);
+	UT_ASSERT_RANGE_UINT64_MSG(10u, 18446744073709551605u, 18446744073709551606u, "Message for %s", "_uint64_top" );
+}
+
+static void test_range_hex64_borders_passed(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_HEX64(0x0u, 0xffffffffffffffffu, 0x0u);
+	UT_ASSERT_RANGE_HEX64(0x0u, 0xffffffffffffffffu, 0xffffffffffffffffu);
+	UT_ASSERT_RANGE_HEX64(0xffffffffffffffffu, 0x0u, 0x0u);
+	UT_ASSERT_RANGE_HEX64(0xffffffffffffffffu, 0x0u, 0xffffffffffffffffu);
+	UT_ASSERT_RANGE_HEX64(0x0u, 0xffffffffffffffffu, 0x7fffffffffffffffu);
+}
+
+static void test_range_hex64_borders_passed_msg(void)
+{
+	test_expect_success_test();
+	UT_ASSERT_RANGE_HEX64_MSG(0x0u, 0xffffffffffffffffu, 0x0u, "Dummy message" );
+	UT_ASSERT_RANGE_HEX64_MSG(0x0u, 0xffffffffffffffffu, 0xffffffffffffffffu, "Dummy message" );
+	UT_ASSERT_RANGE_HEX64_MSG(0xffffffffffffffffu, 0x0u, 0x0u, "Dummy message" );
+	UT_ASSERT_RANGE_HEX64_MSG(0xffffffffffffffffu, 0x0u, 0xffffffffffffffffu, "Dummy message" );
+	UT_ASSERT_RANGE_HEX64_MSG(0x0u, 0xffffffffffffffffu, 0x7fffffffffffffffu, "Dummy message" );
+}
+
+static void test_range_hex64_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_HEX64(0x0u, 0xffffffffffffffffu, 0x0u);
+	UT_ASSERT_RANGE_HEX64(0x0u, 0xffffffffffffffffu, 0xffffffffffffffffu);
+	UT_ASSERT_RANGE_HEX64(0x0u, 0xffffffffffffffffu, 0x7fffffffffffffffu);
+	UT_ASSERT_RANGE_HEX64(0x1u, 0xffffffffffffffffu, 0x1u);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0x1, 0xffffffffffffffff, 0x0)
+		);
+	UT_ASSERT_RANGE_HEX64(0x1u, 0xffffffffffffffffu, 0x0u);
+}
+
+static void test_range_hex64_top(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_HEX64(0x0u, 0xffffffffffffffffu, 0x0u);
+	UT_ASSERT_RANGE_HEX64(0x0u, 0xffffffffffffffffu, 0xffffffffffffffffu);
+	UT_ASSERT_RANGE_HEX64(0x0u, 0xffffffffffffffffu, 0x7fffffffffffffffu);
+	UT_ASSERT_RANGE_HEX64(0x0u, 0xfffffffffffffffeu, 0xfffffffffffffffeu);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0x0, 0xfffffffffffffffe, 0xffffffffffffffff)
+		);
+	UT_ASSERT_RANGE_HEX64(0x0u, 0xfffffffffffffffeu, 0xffffffffffffffffu);
+}
+
+static void test_range_hex64_outrange_bottom(void)
+{
+	/* Should pass */
+	UT_ASSERT_RANGE_HEX64(0xffffffffffffffffu, 0x0u, 0x0u);
+	UT_ASSERT_RANGE_HEX64(0xffffffffffffffffu, 0x0u, 0xffffffffffffffffu);
+	UT_ASSERT_RANGE_HEX64(0xfffffffffffffffdu, 0x2u, 0x0u);
+	UT_ASSERT_RANGE_HEX64(0xfffffffffffffffdu, 0x2u, 0xffffffffffffffffu);
+	UT_ASSERT_RANGE_HEX64(0xfffffffffffffffdu, 0x2u, 0x2u);
+	UT_ASSERT_RANGE_HEX64(0xfffffffffffffffdu, 0x2u, 0xfffffffffffffffdu);
+
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0xfffffffffffffffd, 0x2, 0x3)
+		);
+	UT_ASSERT_RANGE_HEX64(0xfffffffffffffffdu, 0x2u, 0x3u);
+}
+
+static void test_range_hex64_outrange_top(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0xfffffffffffffffd, 0x2, 0xfffffffffffffffc)
+		);
+	UT_ASSERT_RANGE_HEX64(0xfffffffffffffffdu, 0x2u, 0xfffffffffffffffcu);
+}
+
+static void test_range_hex64_outrange_middle(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		NULL,
+		TEST_RANGE_EXP(0xffffffffffffffff, 0x0, 0x7fffffffffffffff)
+		);
+	UT_ASSERT_RANGE_HEX64(0xffffffffffffffffu, 0x0u, 0x7fffffffffffffffu);
+}
+
+static void test_range_hex64_bottom_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _hex64_bottom",
+		TEST_RANGE_EXP(0xa, 0xfffffffffffffff5, 0x9)
+		);
+	UT_ASSERT_RANGE_HEX64_MSG(0xau, 0xfffffffffffffff5u, 0x9u, "Message for %s", "_hex64_bottom" );
+}
+
+static void test_range_hex64_top_msg(void)
+{
+	/* Should fail */
+	test_expect_fail_assert_here(
+		TEST_STR_ID_ANY,
+		"RANGE",
+		"Message for _hex64_top",
+		TEST_RANGE_EXP(0xa, 0xfffffffffffffff5, 0xfffffffffffffff6)
+		);
+	UT_ASSERT_RANGE_HEX64_MSG(0xau, 0xfffffffffffffff5u, 0xfffffffffffffff6u, "Message for %s", "_hex64_top" );
+}
+
+UT_DESC_TS_BEGIN(test_range_suite, suite_init, suite_cleanup, NULL, NULL)
+	UT_DESC_TC(test_range_bottom)
+	UT_DESC_TC(test_range_top)
+	UT_DESC_TC(test_range_outrange_bottom)
+	UT_DESC_TC(test_range_outrange_top)
+	UT_DESC_TC(test_range_outrange_middle)
+	UT_DESC_TC(test_range_msg)
+	UT_DESC_TC(test_range_int_bottom)
+	UT_DESC_TC(test_range_int_top)
+	UT_DESC_TC(test_range_int_outrange_bottom)
+	UT_DESC_TC(test_range_int_outrange_top)
+	UT_DESC_TC(test_range_int_outrange_middle)
+	UT_DESC_TC(test_range_int_msg)
+	UT_DESC_TC(test_range_uint_bottom)
+	UT_DESC_TC(test_range_uint_top)
+	UT_DESC_TC(test_range_uint_outrange_bottom)
+	UT_DESC_TC(test_range_uint_outrange_top)
+	UT_DESC_TC(test_range_uint_outrange_middle)
+	UT_DESC_TC(test_range_uint_msg)
+	UT_DESC_TC(test_range_hex_bottom)
+	UT_DESC_TC(test_range_hex_top)
+	UT_DESC_TC(test_range_hex_outrange_bottom)
+	UT_DESC_TC(test_range_hex_outrange_top)
+	UT_DESC_TC(test_range_hex_outrange_middle)
+	UT_DESC_TC(test_range_hex_msg)
+	UT_DESC_TC(test_range_int8_borders_passed)
+	UT_DESC_TC(test_range_int8_borders_passed_msg)
+	UT_DESC_TC(test_range_int8_bottom)
+	UT_DESC_TC(test_range_int8_top)
+	UT_DESC_TC(test_range_int8_outrange_bottom)
+	UT_DESC_TC(test_range_int8_outrange_top)
+	UT_DESC_TC(test_range_int8_outrange_middle)
+	UT_DESC_TC(test_range_int8_bottom_msg)
+	UT_DESC_TC(test_range_int8_top_msg)
+	UT_DESC_TC(test_range_uint8_borders_passed)
+	UT_DESC_TC(test_range_uint8_borders_passed_msg)
+	UT_DESC_TC(test_range_uint8_bottom)
+	UT_DESC_TC(test_range_uint8_top)
+	UT_DESC_TC(test_range_uint8_outrange_bottom)
+	UT_DESC_TC(test_range_uint8_outrange_top)
+	UT_DESC_TC(test_range_uint8_outrange_middle)
+	UT_DESC_TC(test_range_uint8_bottom_msg)
+	UT_DESC_TC(test_range_uint8_top_msg)
+	UT_DESC_TC(test_range_hex8_borders_passed)
+	UT_DESC_TC(test_range_hex8_borders_passed_msg)
+	UT_DESC_TC(test_range_hex8_bottom)
+	UT_DESC_TC(test_range_hex8_top)
+	UT_DESC_TC(test_range_hex8_outrange_bottom)
+	UT_DESC_TC(test_range_hex8_outrange_top)
+	UT_DESC_TC(test_range_hex8_outrange_middle)
+	UT_DESC_TC(test_range_hex8_bottom_msg)
+	UT_DESC_TC(test_range_hex8_top_msg)
+	UT_DESC_TC(test_range_int16_borders_passed)
+	UT_DESC_TC(test_range_int16_borders_passed_msg)
+	UT_DESC_TC(test_range_int16_bottom)
+	UT_DESC_TC(test_range_int16_top)
+	UT_DESC_TC(test_range_int16_outrange_bottom)
+	UT_DESC_TC(test_range_int16_outrange_top)
+	UT_DESC_TC(test_range_int16_outrange_middle)
+	UT_DESC_TC(test_range_int16_bottom_msg)
+	UT_DESC_TC(test_range_int16_top_msg)
+	UT_DESC_TC(test_range_uint16_borders_passed)
+	UT_DESC_TC(test_range_uint16_borders_passed_msg)
+	UT_DESC_TC(test_range_uint16_bottom)
+	UT_DESC_TC(test_range_uint16_top)
+	UT_DESC_TC(test_range_uint16_outrange_bottom)
+	UT_DESC_TC(test_range_uint16_outrange_top)
+	UT_DESC_TC(test_range_uint16_outrange_middle)
+	UT_DESC_TC(test_range_uint16_bottom_msg)
+	UT_DESC_TC(test_range_uint16_top_msg)
+	UT_DESC_TC(test_range_hex16_borders_passed)
+	UT_DESC_TC(test_range_hex16_borders_passed_msg)
+	UT_DESC_TC(test_range_hex16_bottom)
+	UT_DESC_TC(test_range_hex16_top)
+	UT_DESC_TC(test_range_hex16_outrange_bottom)
+	UT_DESC_TC(test_range_hex16_outrange_top)
+	UT_DESC_TC(test_range_hex16_outrange_middle)
+	UT_DESC_TC(test_range_hex16_bottom_msg)
+	UT_DESC_TC(test_range_hex16_top_msg)
+	UT_DESC_TC(test_range_int32_borders_passed)
+	UT_DESC_TC(test_range_int32_borders_passed_msg)
+	UT_DESC_TC(test_range_int32_bottom)
+	UT_DESC_TC(test_range_int32_top)
+	UT_DESC_TC(test_range_int32_outrange_bottom)
+	UT_DESC_TC(test_range_int32_outrange_top)
+	UT_DESC_TC(test_range_int32_outrange_middle)
+	UT_DESC_TC(test_range_int32_bottom_msg)
+	UT_DESC_TC(test_range_int32_top_msg)
+	UT_DESC_TC(test_range_uint32_borders_passed)
+	UT_DESC_TC(test_range_uint32_borders_passed_msg)
+	UT_DESC_TC(test_range_uint32_bottom)
+	UT_DESC_TC(test_range_uint32_top)
+	UT_DESC_TC(test_range_uint32_outrange_bottom)
+	UT_DESC_TC(test_range_uint32_outrange_top)
+	UT_DESC_TC(test_range_uint32_outrange_middle)
+	UT_DESC_TC(test_range_uint32_bottom_msg)
+	UT_DESC_TC(test_range_uint32_top_msg)
+	UT_DESC_TC(test_range_hex32_borders_passed)
+	UT_DESC_TC(test_range_hex32_borders_passed_msg)
+	UT_DESC_TC(test_range_hex32_bottom)
+	UT_DESC_TC(test_range_hex32_top)
+	UT_DESC_TC(test_range_hex32_outrange_bottom)
+	UT_DESC_TC(test_range_hex32_outrange_top)
+	UT_DESC_TC(test_range_hex32_outrange_middle)
+	UT_DESC_TC(test_range_hex32_bottom_msg)
+	UT_DESC_TC(test_range_hex32_top_msg)
+	UT_DESC_TC(test_range_int64_borders_passed)
+	UT_DESC_TC(test_range_int64_borders_passed_msg)
+	UT_DESC_TC(test_range_int64_bottom)
+	UT_DESC_TC(test_range_int64_top)
+	UT_DESC_TC(test_range_int64_outrange_bottom)
+	UT_DESC_TC(test_range_int64_outrange_top)
+	UT_DESC_TC(test_range_int64_outrange_middle)
+	UT_DESC_TC(test_range_int64_bottom_msg)
+	UT_DESC_TC(test_range_int64_top_msg)
+	UT_DESC_TC(test_range_uint64_borders_passed)
+	UT_DESC_TC(test_range_uint64_borders_passed_msg)
+	UT_DESC_TC(test_range_uint64_bottom)
+	UT_DESC_TC(test_range_uint64_top)
+	UT_DESC_TC(test_range_uint64_outrange_bottom)
+	UT_DESC_TC(test_range_uint64_outrange_top)
+	UT_DESC_TC(test_range_uint64_outrange_middle)
+	UT_DESC_TC(test_range_uint64_bottom_msg)
+	UT_DESC_TC(test_range_uint64_top_msg)
+	UT_DESC_TC(test_range_hex64_borders_passed)
+	UT_DESC_TC(test_range_hex64_borders_passed_msg)
+	UT_DESC_TC(test_range_hex64_bottom)
+	UT_DESC_TC(test_range_hex64_top)
+	UT_DESC_TC(test_range_hex64_outrange_bottom)
+	UT_DESC_TC(test_range_hex64_outrange_top)
+	UT_DESC_TC(test_range_hex64_outrange_middle)
+	UT_DESC_TC(test_range_hex64_bottom_msg)
+	UT_DESC_TC(test_range_hex64_top_msg)
+UT_DESC_TS_END();
\ No newline at end of file
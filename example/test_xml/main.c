@@ -33,6 +33,7 @@
 #include <emunit_port.h>
 #include <stdarg.h>
 #include <stdio.h>
+#include <string.h>
 /* Note that normal test does not include this header.
  * This test checks emunit engine itself so it needs the access to the private
  * functions. */
@@ -47,6 +48,38 @@
  *
  * Internal functions and variables of the main body of XML output test.
  */
+/**
+ * @brief The pattern of the durations element
+ *
+ * Empty if the timing is disabled.
+ */
+#if EMUNIT_CONF_TIMING
+#define TEST_TIME_PATTERN                                                    \
+	"[[:space:]]*<time init=\"[[:digit:]]+\" test=\"[[:digit:]]+\""         \
+	" cleanup=\"[[:digit:]]+\" unit=\"(ns|cycles)\" />"
+#else
+#define TEST_TIME_PATTERN ""
+#endif
+
+/**
+ * @brief The pattern of the benchmark results element
+ */
+#define TEST_BENCH_PATTERN                                                   \
+	"[[:space:]]*<bench iterations=\"[[:digit:]]+\" samples=\"[[:digit:]]+\"" \
+	" min=\"[[:digit:]]+\" median=\"[[:digit:]]+\""                          \
+	" p90=\"[[:digit:]]+\" p99=\"[[:digit:]]+\" unit=\"(ns|cycles)\" />"
+
+/**
+ * @brief Approximate size of the durations element in the display buffer
+ *
+ * Used to keep the buffer filling test near the overflow.
+ */
+#if EMUNIT_CONF_TIMING
+#define TEST_TIME_SIZE 64
+#else
+#define TEST_TIME_SIZE 0
+#endif
+
 /**
  * @brief Number of suite init calls
  */
@@ -78,6 +111,10 @@ static int test_cases_success;
  * @brief Count tests that should success
  */
 static int test_cases_failed;
+/**
+ * @brief Count tests that should be marked as near the buffer overflow
+ */
+static int test_cases_near_overflow;
 /** @} <!-- emunit_test_xml_internals --> */
 
 
@@ -95,7 +132,7 @@ void test_expect_sinit_default(char const * str_suite)
 
 void test_expect_scleanup_default(void)
 {
-	emunit_pctest_expected_set("^[[:space:]]*</testsuite>[[:space:]]*$");
+	emunit_pctest_expected_set("^" TEST_TIME_PATTERN "[[:space:]]*</testsuite>[[:space:]]*$");
 }
 
 void test_expect_success(char const * pattern)
@@ -110,7 +147,7 @@ void test_expect_success_test_x(char const * str_name)
 
 	sprintf(
 		buffer,
-		"^[[:space:]]*<testcase name=\"%s\">[[:space:]]*</testcase>[[:space:]]*$",
+		"^[[:space:]]*<testcase name=\"%s\">" TEST_TIME_PATTERN "[[:space:]]*</testcase>[[:space:]]*$",
 		str_name);
 	test_expect_success(buffer);
 }
@@ -121,6 +158,43 @@ void test_expect_fail(char const * pattern)
 	emunit_pctest_expected_set(pattern);
 }
 
+/**
+ * @brief Set the benchmark expected pattern
+ *
+ * @param str_name    The name of the benchmark
+ * @param str_failure The failure pattern or NULL if none
+ */
+static void test_expect_bench_pattern_set(char const * str_name, char const * str_failure)
+{
+	char buffer[EMUNIT_TEST_PATTERN_MAX];
+
+	sprintf(
+		buffer,
+		"^[[:space:]]*<testcase name=\"%s\">%s" TEST_TIME_PATTERN TEST_BENCH_PATTERN
+		"[[:space:]]*</testcase>[[:space:]]*$",
+		str_name,
+		(NULL == str_failure) ? "" : str_failure);
+	emunit_pctest_expected_set(buffer);
+}
+
+void test_expect_bench(char const * str_name)
+{
+	test_expect_bench_pattern_set(str_name, NULL);
+}
+
+void test_expect_bench_budget(char const * str_name, char const * str_failure)
+{
+	if(NULL == str_failure)
+	{
+		++test_cases_success;
+	}
+	else
+	{
+		++test_cases_failed;
+	}
+	test_expect_bench_pattern_set(str_name, str_failure);
+}
+
 void test_expect_fail_assert_x(
 	char const * str_test,
 	char const * str_file,
@@ -181,6 +255,7 @@ void test_expect_fail_assert_x(
 	p_buffer += sprintf(p_buffer,
 		"[[:space:]]*</details>"
 		"[[:space:]]*</failure>"
+		TEST_TIME_PATTERN
 		"[[:space:]]*</testcase>"
 		"[[:space:]]*"
 		"$");
@@ -379,6 +454,28 @@ static void base_tests2_test1(void)
 	UT_ASSERT_EQUAL(4, init_calls);
 	UT_ASSERT_EQUAL(4, cleanup_calls);
 }
+/**
+ * @brief Test that fills the display buffer near to overflow
+ *
+ * The message is long enough to leave less than
+ * @ref EMUNIT_CONF_BUFFER_MARGIN bytes free in the display buffer.
+ * The buffer warning is expected just before the test case end.
+ */
+static void base_tests2_test2(void)
+{
+	static char msg[EMUNIT_CONF_BUFFER_SIZE];
+	memset(msg, 'X', sizeof(msg) - 1);
+
+	++test_cases_near_overflow;
+	test_expect_fail(
+		"^[[:space:]]*<testcase name=\"base_tests2_test2\">"
+		"[[:space:]]*<failure type=\"ASSERT\" id=\"[[:digit:]]+\">"
+		".*<msg>X+</msg>.*</failure>"
+		TEST_TIME_PATTERN
+		"[[:space:]]*<buffer-warning used=\"[[:digit:]]+\" size=\"" EMUNIT_STR(EMUNIT_CONF_BUFFER_SIZE) "\" />"
+		"[[:space:]]*</testcase>[[:space:]]*$");
+	UT_ASSERT_MSG(false, "%.*s", (int)(EMUNIT_CONF_BUFFER_SIZE - 300 - TEST_TIME_SIZE), msg);
+}
 /** @} <!-- emunit_test_xml_base_tests2 --> */
 
 /**
@@ -403,7 +500,7 @@ static void base_tests_last_scleanup(void)
 {
 	test_expect_scleanup_default();
 
-	char pattern_footer[512];
+	char pattern_footer[EMUNIT_TEST_PATTERN_MAX];
 
 	sprintf(pattern_footer,
 		"^"
@@ -418,6 +515,12 @@ static void base_tests_last_scleanup(void)
 		"[[:space:]]*<passed>%u</passed>"
 		"[[:space:]]*<failed>%u</failed>"
 		"[[:space:]]*</testcase-stat>"
+		"[[:space:]]*<buffer-stat>"
+		"[[:space:]]*<size>%u</size>"
+		"[[:space:]]*<used-max>[[:digit:]]+</used-max>"
+		"[[:space:]]*<near-overflow>%u</near-overflow>"
+		"[[:space:]]*<testcase-max suite=\"base_tests2\" name=\"base_tests2_test2\">[[:digit:]]+</testcase-max>"
+		"[[:space:]]*</buffer-stat>"
 		"[[:space:]]*</testsummary>"
 		"[[:space:]]*</test>[[:space:]]*"
 		"$"
@@ -427,7 +530,9 @@ static void base_tests_last_scleanup(void)
 		emunit_ts_failed_get(),
 		test_cases_success + test_cases_failed,
 		test_cases_success,
-		test_cases_failed
+		test_cases_failed,
+		EMUNIT_CONF_BUFFER_SIZE,
+		test_cases_near_overflow
 	);
 	emunit_pctest_expected_footer_set(pattern_footer);
 }
@@ -446,6 +551,7 @@ UT_DESC_TS_END();
 /* Test suite 2 */
 UT_DESC_TS_BEGIN(base_tests2, base_tests2_sinit, base_tests2_scleanup, NULL, NULL)
 	UT_DESC_TC(base_tests2_test1)
+	UT_DESC_TC(base_tests2_test2)
 UT_DESC_TS_END();
 
 /* Last test suite */
@@ -41,6 +41,8 @@ UT_DESC_TS_EXTERN(test_str_suite);
 UT_DESC_TS_EXTERN(test_delta_suite);
 UT_DESC_TS_EXTERN(test_equal_suite);
 UT_DESC_TS_EXTERN(test_range_suite);
+UT_DESC_TS_EXTERN(test_cycles_suite);
+UT_DESC_TS_EXTERN(test_bench_suite);
 
 
 /* Whole test description */
@@ -53,6 +55,8 @@ UT_MAIN_TS_BEGIN()
 	UT_MAIN_TS_ENTRY(test_delta_suite)
 	UT_MAIN_TS_ENTRY(test_equal_suite)
 	UT_MAIN_TS_ENTRY(test_range_suite)
+	UT_MAIN_TS_ENTRY(test_cycles_suite)
+	UT_MAIN_TS_ENTRY(test_bench_suite)
 
 
 	/* This test suite has to be the last one */
@@ -206,5 +206,28 @@ void test_expect_fail_assert_x(
 	char const * fmt,
 	...);
 
+/**
+ * @brief Current benchmark without budget should finish
+ *
+ * Function sets expected pattern with the benchmark results.
+ * The benchmark is not counted as passed or failed test case.
+ *
+ * @param str_name The name of the benchmark
+ */
+void test_expect_bench(char const * str_name);
+
+/**
+ * @brief Current benchmark with budget should finish
+ *
+ * Function sets expected pattern with the benchmark results
+ * and marks that current test should pass or fail.
+ * Used also for the benchmark without budget that is compared
+ * with the baseline, which is counted as normal test case.
+ *
+ * @param str_name    The name of the benchmark
+ * @param str_failure The failure pattern or NULL if the benchmark should pass
+ */
+void test_expect_bench_budget(char const * str_name, char const * str_failure);
+
 /** @} */
 #endif /* TEST_XML_H_INCLUDED */
@@ -0,0 +1,191 @@
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief Benchmark xml test file
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * File that contains benchmark part of the xml output test.
+ * @sa emunit_test_xml
+ */
+#include "test.h"
+#include <emunit.h>
+#include <emunit_private.h>
+#include <emunit_port.h>
+#include <string.h>
+
+#if EMUNIT_CONF_TIMING
+/** Pattern of the failure for the zero budget */
+#define TEST_BENCH_ZERO_PATTERN                          \
+	"[[:space:]]*<failure type=\"CYCLES\" id=\"[[:digit:]]+\">" \
+	"[[:space:]]*<file>test_bench\\.c</file>"           \
+	"[[:space:]]*<line>[[:digit:]]+</line>"              \
+	"[[:space:]]*<details>"                              \
+	"[[:space:]]*<budget>0</budget>"                     \
+	"[[:space:]]*<measured>[1-9][0-9]*</measured>"       \
+	"[[:space:]]*<unit>[a-z]+</unit>"                    \
+	"[[:space:]]*</details>"                             \
+	"[[:space:]]*</failure>"
+
+/** Generous budget that any benchmark here would fit in */
+#define TEST_BENCH_BUDGET 100000000U
+
+#if EMUNIT_CONF_BENCH_BASELINE
+/** Pattern of the failure for the baseline of the single time unit */
+#define TEST_BENCH_REGRESSION_PATTERN                        \
+	"[[:space:]]*<failure type=\"REGRESSION\" id=\"[[:digit:]]+\">" \
+	"[[:space:]]*<file>test_bench\\.c</file>"               \
+	"[[:space:]]*<line>[[:digit:]]+</line>"                  \
+	"[[:space:]]*<details>"                                  \
+	"[[:space:]]*<baseline>1</baseline>"                     \
+	"[[:space:]]*<limit>1</limit>"                           \
+	"[[:space:]]*<measured>([2-9]|[1-9][0-9]+)</measured>"   \
+	"[[:space:]]*<unit>[a-z]+</unit>"                        \
+	"[[:space:]]*</details>"                                 \
+	"[[:space:]]*</failure>"
+#endif
+
+/**
+ * @brief The code to be measured
+ *
+ * @param n Number of loop iterations
+ */
+static void test_bench_busy(unsigned int n)
+{
+	volatile unsigned int cnt = 0;
+	while(n--)
+	{
+		++cnt;
+	}
+}
+#endif
+
+
+static void suite_init(void)
+{
+	test_expect_sinit_default("test_bench_suite");
+}
+
+static void suite_cleanup(void)
+{
+	test_expect_scleanup_default();
+}
+
+/**
+ * @brief Set the expected results
+ *
+ * The benchmark function is called many times,
+ * so the expectation is set once by the test initialisation.
+ */
+static void test_init(void)
+{
+#if EMUNIT_CONF_TIMING
+	char const * str_name = emunit_tc_name_get(
+		emunit_ts_current_index_get(),
+		emunit_tc_current_index_get());
+
+	if(0 == strcmp(str_name, "test_bench"))
+	{
+		test_expect_bench(str_name);
+	}
+#if EMUNIT_CONF_BENCH_BASELINE
+	else if(0 == strcmp(str_name, "test_bench_baseline_passed"))
+	{
+		const emunit_bench_t baseline = {.median = TEST_BENCH_BUDGET, .p90 = TEST_BENCH_BUDGET};
+		emunit_pctest_bench_baseline_set(&baseline);
+		test_expect_bench_budget(str_name, NULL);
+	}
+	else if(0 == strcmp(str_name, "test_bench_baseline_noise"))
+	{
+		/* Regressed median within the baseline spread */
+		const emunit_bench_t baseline = {.median = 1, .p90 = TEST_BENCH_BUDGET};
+		emunit_pctest_bench_baseline_set(&baseline);
+		test_expect_bench_budget(str_name, NULL);
+	}
+	else if(0 == strcmp(str_name, "test_bench_baseline_failed"))
+	{
+		const emunit_bench_t baseline = {.median = 1, .p90 = 1};
+		emunit_pctest_bench_baseline_set(&baseline);
+		test_expect_bench_budget(str_name, TEST_BENCH_REGRESSION_PATTERN);
+	}
+#endif
+	else if(0 == strcmp(str_name, "test_bench_budget_passed"))
+	{
+		test_expect_bench_budget(str_name, NULL);
+	}
+	else
+	{
+		test_expect_bench_budget(str_name, TEST_BENCH_ZERO_PATTERN);
+	}
+#endif
+}
+
+
+#if EMUNIT_CONF_TIMING
+static void test_bench(void)
+{
+	test_bench_busy(10);
+}
+
+static void test_bench_budget_passed(void)
+{
+	test_bench_busy(10);
+}
+
+static void test_bench_budget_failed(void)
+{
+	test_bench_busy(100);
+}
+
+#if EMUNIT_CONF_BENCH_BASELINE
+static void test_bench_baseline_passed(void)
+{
+	test_bench_busy(10);
+}
+
+static void test_bench_baseline_noise(void)
+{
+	test_bench_busy(100);
+}
+
+static void test_bench_baseline_failed(void)
+{
+	test_bench_busy(100);
+}
+#endif
+#endif
+
+
+
+UT_DESC_TS_BEGIN(test_bench_suite, suite_init, suite_cleanup, test_init, NULL)
+#if EMUNIT_CONF_TIMING
+	UT_DESC_BENCH(test_bench)
+	UT_DESC_BENCH_BUDGET(test_bench_budget_passed, TEST_BENCH_BUDGET)
+	UT_DESC_BENCH_BUDGET(test_bench_budget_failed, 0)
+#if EMUNIT_CONF_BENCH_BASELINE
+	UT_DESC_BENCH(test_bench_baseline_passed)
+	UT_DESC_BENCH(test_bench_baseline_noise)
+	UT_DESC_BENCH(test_bench_baseline_failed)
+#endif
+#endif
+UT_DESC_TS_END();
@@ -0,0 +1,125 @@
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief Cycle budget assertions xml test file
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * File that contains cycle budget part of the xml output test.
+ * @sa emunit_test_xml
+ */
+#include "test.h"
+#include <emunit.h>
+
+#if EMUNIT_CONF_TIMING
+/** Pattern of the details for the failed zero budget */
+#define TEST_CYCLES_ZERO_PATTERN                   \
+	"[[:space:]]*<budget>0</budget>"               \
+	"[[:space:]]*<measured>[1-9][0-9]*</measured>" \
+	"[[:space:]]*<unit>[a-z]+</unit>"
+
+/** Generous budget that any measured statement here would fit in */
+#define TEST_CYCLES_BUDGET 100000000U
+
+/**
+ * @brief The code to be measured
+ *
+ * @param n Number of loop iterations
+ */
+static void test_cycles_busy(unsigned int n)
+{
+	volatile unsigned int cnt = 0;
+	while(n--)
+	{
+		++cnt;
+	}
+}
+#endif
+
+
+static void suite_init(void)
+{
+	test_expect_sinit_default("test_cycles_suite");
+}
+
+static void suite_cleanup(void)
+{
+	test_expect_scleanup_default();
+}
+
+
+#if EMUNIT_CONF_TIMING
+static void test_all_passed(void)
+{
+	test_expect_success_test();
+
+	UT_ASSERT_CYCLES_MAX(TEST_CYCLES_BUDGET, test_cycles_busy(10));
+	UT_CYCLES_BEGIN();
+	test_cycles_busy(10);
+	test_cycles_busy(20);
+	UT_ASSERT_CYCLES_END(TEST_CYCLES_BUDGET);
+}
+
+static void test_all_passed_msg(void)
+{
+	test_expect_success_test();
+
+	UT_ASSERT_CYCLES_MAX_MSG(TEST_CYCLES_BUDGET, test_cycles_busy(10), "Dummy message");
+	UT_CYCLES_BEGIN();
+	test_cycles_busy(10);
+	UT_ASSERT_CYCLES_END_MSG(TEST_CYCLES_BUDGET, "Dummy message");
+}
+
+static void test_fail_cycles_max(void)
+{
+	/* Single line, so the expected line does not depend on the compiler */
+	test_expect_fail_assert_here(TEST_STR_ID_ANY, "CYCLES", NULL, "%s", TEST_CYCLES_ZERO_PATTERN);
+	UT_ASSERT_CYCLES_MAX(0, test_cycles_busy(1000));
+}
+
+static void test_fail_cycles_max_msg(void)
+{
+	test_expect_fail_assert_here(TEST_STR_ID_ANY, "CYCLES", "Slow: 1000", "%s", TEST_CYCLES_ZERO_PATTERN);
+	UT_ASSERT_CYCLES_MAX_MSG(0, test_cycles_busy(1000), "Slow: %u", 1000U);
+}
+
+static void test_fail_cycles_end(void)
+{
+	UT_CYCLES_BEGIN();
+	test_cycles_busy(1000);
+	test_expect_fail_assert_here(TEST_STR_ID_ANY, "CYCLES", NULL, "%s", TEST_CYCLES_ZERO_PATTERN);
+	UT_ASSERT_CYCLES_END(0);
+}
+#endif
+
+
+
+UT_DESC_TS_BEGIN(test_cycles_suite, suite_init, suite_cleanup, NULL, NULL)
+#if EMUNIT_CONF_TIMING
+	UT_DESC_TC(test_all_passed)
+	UT_DESC_TC(test_all_passed_msg)
+	UT_DESC_TC(test_fail_cycles_max)
+	UT_DESC_TC(test_fail_cycles_max_msg)
+	UT_DESC_TC(test_fail_cycles_end)
+#endif
+UT_DESC_TS_END();
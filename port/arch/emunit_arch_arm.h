@@ -0,0 +1,170 @@
+#ifndef EMUNIT_PORT_ARCH_ARM_H_INCLUDED
+#define EMUNIT_PORT_ARCH_ARM_H_INCLUDED
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief EMUnit ARM Cortex-M architecture port implementation
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * File with EMUnit architecture for ARM Cortex-M microcontroller
+ * @sa emunit_arch_arm_group
+ */
+
+/**
+ * @defgroup emunit_arch_arm_group <emunit_arch_arm> EMUnit ARM Cortex-M architecture
+ * @{
+ * @ingroup emunit_arch_group
+ *
+ * The flash and RAM share the same address space,
+ * so the special keywords are dummied like for the PC.
+ * The retained variables are placed in .noinit section
+ * that has to be placed by the linker script outside of .bss,
+ * as NOLOAD section.
+ */
+
+/* Check compiler */
+#if ( defined(__GNUC__) && (__GNUC__ >= 4) )
+
+/* Check the architecture */
+#if !(defined(__arm__) || defined(__thumb__))
+#error "Unsupported architecture"
+#endif
+
+/**
+ * @name Definitions of special keywords that have to be dummied
+ * @{
+ */
+/** Variable placed in FLASH memory */
+#define __flash
+/** Pointer to any type of the variables (FLASH or RAM) */
+#define __memx
+/** @} */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <stdlib.h>
+
+#define EMUNIT_FLASHSTR(s) s
+
+#define PRIsPGM "s"
+
+/** Memory barrier for the data shared with interrupts */
+#define EMUNIT_MEMORY_BARRIER() __asm__ __volatile__ ("dmb" ::: "memory")
+
+#define EMUNIT_NOINIT_VAR(type, name) \
+	type name __attribute__((section(".noinit")))
+
+static inline void * emunit_memcpy(
+	void * p_dst,
+	void const __memx * p_src,
+	size_t size)
+{
+	return memcpy(p_dst, p_src, size);
+}
+
+static inline size_t emunit_strlen(char const __memx * s)
+{
+	return strlen(s);
+}
+
+static inline char* emunit_strstr(char const * str1, char const __memx * str2)
+{
+	return strstr(str1, str2);
+}
+
+static inline int emunit_vsnprintf(
+	char * s,
+	size_t n,
+	char const __memx * fmt,
+	va_list va)
+{
+	return vsnprintf(s, n, fmt, va);
+}
+
+#else /* Compiler selection */
+#error "Unsupported compiler"
+#endif
+
+/**
+ * @name Timestamp
+ *
+ * Not every Cortex-M core has the DWT cycle counter,
+ * so the timestamp functions are defined by the port.
+ * @{
+ */
+/** Timestamp and duration type */
+typedef uint32_t emunit_timestamp_t;
+/** Format of the timestamp for printf */
+#define PRIuTIMESTAMP PRIu32
+/** Unit of the timestamp */
+#define EMUNIT_TIMESTAMP_UNIT "cycles"
+/** Default benchmark sample duration: 100000 cycles */
+#define EMUNIT_ARCH_BENCH_TARGET 100000UL
+/** No variables required for the timestamp */
+#define EMUNIT_ARCH_TIMESTAMP_VARIABLES()
+
+/**
+ * @brief Initialise the timestamp counter
+ *
+ * Defined by the port.
+ */
+void emunit_arch_timestamp_init(void);
+
+/**
+ * @brief Get the timestamp
+ *
+ * Defined by the port.
+ *
+ * @return Cycle counter value, wraps at 32 bits
+ */
+emunit_timestamp_t emunit_arch_timestamp(void);
+
+/**
+ * @brief Prepare the counter for the cycle measurement
+ *
+ * Nothing to do on this architecture.
+ */
+static inline void emunit_arch_timestamp_align(void)
+{
+	/* Nothing to do */
+}
+/** @} */
+
+/**
+ * @brief The macro that declares all required variables
+ *
+ * This macro should be called at the very top of the port file.
+ * It declares all the variables required by the EMUNIT engine.
+ */
+#define EMUNIT_PORT_REQUIRED_VARIABLES()                               \
+	EMUNIT_NOINIT_VAR(emunit_status_t, emunit_status);                 \
+	EMUNIT_NOINIT_VAR(emunit_display_status_t, emunit_display_status)
+
+/** @} <!-- emunit_arch_arm_group --> */
+#endif /* EMUNIT_PORT_ARCH_ARM_H_INCLUDED */
@@ -61,7 +61,11 @@
 #endif
 
 #include <stddef.h>
+#include <stdint.h>
+#include <inttypes.h>
 #include <string.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
 #include <avr/pgmspace.h>
 #include <stdio.h>
 
@@ -70,6 +74,9 @@
 
 #define PRIsPGM "S"
 
+/** Compiler memory barrier for the data shared with interrupts */
+#define EMUNIT_MEMORY_BARRIER() __asm__ __volatile__ ("" ::: "memory")
+
 #define EMUNIT_NOINIT_VAR(type, name) \
 	type name __attribute__((section(".noinit")))
 
@@ -134,6 +141,102 @@ static inline int emunit_vsnprintf(
 	return ret;
 }
 
+/**
+ * @name Timestamp
+ *
+ * Timer1 running with the CPU clock, extended by the overflow counter.
+ * The overflow is counted by the interrupt if the interrupts are enabled.
+ * Reading the timestamp handles the pending overflow too,
+ * so with interrupts disabled only the intervals shorter than
+ * 65536 cycles are measured properly.
+ *
+ * The timer may be aligned to zero before the cycle measurement,
+ * so the overflow interrupt always hits the measured code in the same place.
+ * The value before the alignment is kept in the base,
+ * the timestamp itself never goes back.
+ * @{
+ */
+#if defined(TIMSK1) || defined(__DOXYGEN__)
+/** Timer1 interrupt mask register */
+#define EMUNIT_ARCH_AVR_TIMSK TIMSK1
+/** Timer1 interrupt flag register */
+#define EMUNIT_ARCH_AVR_TIFR  TIFR1
+#else
+#define EMUNIT_ARCH_AVR_TIMSK TIMSK
+#define EMUNIT_ARCH_AVR_TIFR  TIFR
+#endif
+
+/** Timestamp and duration type */
+typedef uint32_t emunit_timestamp_t;
+/** Format of the timestamp for printf */
+#define PRIuTIMESTAMP PRIu32
+/** Unit of the timestamp */
+#define EMUNIT_TIMESTAMP_UNIT "cycles"
+/** Default benchmark sample duration: 50000 cycles */
+#define EMUNIT_ARCH_BENCH_TARGET 50000UL
+
+/** Timer1 overflow counter, defined by @ref EMUNIT_ARCH_TIMESTAMP_VARIABLES */
+extern volatile uint16_t emunit_arch_timer1_ovf;
+/** Timestamp at the last alignment, defined by @ref EMUNIT_ARCH_TIMESTAMP_VARIABLES */
+extern emunit_timestamp_t emunit_arch_timer1_base;
+
+/**
+ * @brief The macro that defines the timestamp variables
+ *
+ * Defines the overflow counter and the Timer1 overflow interrupt.
+ * Used by the engine only if @ref EMUNIT_CONF_TIMING is set.
+ */
+#define EMUNIT_ARCH_TIMESTAMP_VARIABLES()  \
+	volatile uint16_t emunit_arch_timer1_ovf; \
+	emunit_timestamp_t emunit_arch_timer1_base; \
+	ISR(TIMER1_OVF_vect)                   \
+	{                                      \
+		++emunit_arch_timer1_ovf;          \
+	}
+
+static inline void emunit_arch_timestamp_init(void)
+{
+	TCCR1A = 0;
+	TCCR1B = 0;
+	TCNT1  = 0;
+	emunit_arch_timer1_base = 0;
+	emunit_arch_timer1_ovf  = 0;
+	EMUNIT_ARCH_AVR_TIFR   = _BV(TOV1);
+	EMUNIT_ARCH_AVR_TIMSK |= _BV(TOIE1);
+	TCCR1B = _BV(CS10);
+}
+
+static inline emunit_timestamp_t emunit_arch_timestamp(void)
+{
+	uint8_t sreg = SREG;
+	uint16_t cnt;
+	uint16_t ovf;
+	cli();
+	cnt = TCNT1;
+	if(0U != (EMUNIT_ARCH_AVR_TIFR & _BV(TOV1)))
+	{
+		/* Overflow not serviced yet */
+		EMUNIT_ARCH_AVR_TIFR = _BV(TOV1);
+		++emunit_arch_timer1_ovf;
+		cnt = TCNT1;
+	}
+	ovf = emunit_arch_timer1_ovf;
+	SREG = sreg;
+	return emunit_arch_timer1_base + (((emunit_timestamp_t)ovf << 16) | cnt);
+}
+
+static inline void emunit_arch_timestamp_align(void)
+{
+	uint8_t sreg = SREG;
+	cli();
+	emunit_arch_timer1_base = emunit_arch_timestamp();
+	TCNT1 = 0;
+	EMUNIT_ARCH_AVR_TIFR = _BV(TOV1);
+	emunit_arch_timer1_ovf = 0;
+	SREG = sreg;
+}
+/** @} */
+
 #else /* Compiler selection */
 #error "Unsupported compiler"
 #endif
@@ -58,13 +58,19 @@
 /** @} */
 
 #include <stddef.h>
+#include <stdint.h>
+#include <inttypes.h>
 #include <string.h>
 #include <stdio.h>
+#include <time.h>
 
 #define EMUNIT_FLASHSTR(s) s
 
 #define PRIsPGM "s"
 
+/** Full memory barrier for the data shared with the output thread */
+#define EMUNIT_MEMORY_BARRIER() __sync_synchronize()
+
 static inline void * emunit_memcpy(
 	void * p_dst,
 	void const __memx * p_src,
@@ -92,5 +98,40 @@ static inline int emunit_vsnprintf(
 	return vsnprintf(s, n, fmt, va);
 }
 
+/**
+ * @name Timestamp
+ *
+ * The monotonic clock in nanoseconds.
+ * @{
+ */
+/** Timestamp and duration type */
+typedef uint64_t emunit_timestamp_t;
+/** Format of the timestamp for printf */
+#define PRIuTIMESTAMP PRIu64
+/** Unit of the timestamp */
+#define EMUNIT_TIMESTAMP_UNIT "ns"
+/** Default benchmark sample duration: 10 ms */
+#define EMUNIT_ARCH_BENCH_TARGET 10000000U
+/** No variables required for the timestamp */
+#define EMUNIT_ARCH_TIMESTAMP_VARIABLES()
+
+static inline void emunit_arch_timestamp_init(void)
+{
+	/* Nothing to do */
+}
+
+static inline emunit_timestamp_t emunit_arch_timestamp(void)
+{
+	struct timespec ts;
+	(void)clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((emunit_timestamp_t)ts.tv_sec * 1000000000U) + (emunit_timestamp_t)ts.tv_nsec;
+}
+
+static inline void emunit_arch_timestamp_align(void)
+{
+	/* Nothing to do */
+}
+/** @} */
+
 /** @} <!-- emunit_arch_pc_group --> */
 #endif /* EMUNIT_PORT_ARCH_PC_H_INCLUDED */
@@ -0,0 +1,368 @@
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief EMUnit AVR USART port implementation
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * File with EMUnit port for hardware AVR USART
+ * @sa emunit_port_avruart_group
+ */
+#include "config_emunit_avruart.h"
+#include "emunit_port_avruart.h"
+#include <emunit_private.h>
+#include <avr/io.h>
+#include <avr/wdt.h>
+#include <avr/interrupt.h>
+#define BAUD EMUNIT_PORT_AVRUART_BAUD
+#include <util/setbaud.h>
+
+#if EMUNIT_PORT_AVRUART_SIMAVR
+/* Note simavr include directory needs to be in the include path */
+#include <simavr/avr/avr_mcu_section.h>
+AVR_MCU(F_CPU, EMUNIT_STR(MCU_NAME));
+#endif
+
+#if EMUNIT_PORT_AVRUART_BUFFER_SIZE > 255
+#error "EMUNIT_PORT_AVRUART_BUFFER_SIZE cannot be bigger than 255"
+#endif
+
+/* Variables required by the emunit engine */
+EMUNIT_PORT_REQUIRED_VARIABLES();
+
+/**
+ * @name USART registers
+ *
+ * Registers of the selected USART instance.
+ * @{
+ */
+#if defined(UDR0) || defined(__DOXYGEN__)
+#define AVRUART_UDR   EMUNIT_CN2(UDR, EMUNIT_PORT_AVRUART_USART)
+#define AVRUART_UCSRA EMUNIT_CN3(UCSR, EMUNIT_PORT_AVRUART_USART, A)
+#define AVRUART_UCSRB EMUNIT_CN3(UCSR, EMUNIT_PORT_AVRUART_USART, B)
+#define AVRUART_UBRRH EMUNIT_CN3(UBRR, EMUNIT_PORT_AVRUART_USART, H)
+#define AVRUART_UBRRL EMUNIT_CN3(UBRR, EMUNIT_PORT_AVRUART_USART, L)
+#else
+#if EMUNIT_PORT_AVRUART_USART != 0
+#error "The MCU has only one USART"
+#endif
+#define AVRUART_UDR   UDR
+#define AVRUART_UCSRA UCSRA
+#define AVRUART_UCSRB UCSRB
+#define AVRUART_UBRRH UBRRH
+#define AVRUART_UBRRL UBRRL
+#endif
+/** @} */
+
+/**
+ * @name USART bits
+ *
+ * The bits positions are the same for all the USART instances.
+ * @{
+ */
+#if defined(U2X0) || defined(__DOXYGEN__)
+#define AVRUART_U2X   U2X0
+#define AVRUART_TXC   TXC0
+#define AVRUART_UDRE  UDRE0
+#define AVRUART_TXEN  TXEN0
+#define AVRUART_UDRIE UDRIE0
+#else
+#define AVRUART_U2X   U2X
+#define AVRUART_TXC   TXC
+#define AVRUART_UDRE  UDRE
+#define AVRUART_TXEN  TXEN
+#define AVRUART_UDRIE UDRIE
+#endif
+/** @} */
+
+/**
+ * @brief USART data register empty interrupt vector
+ */
+#if (defined(USART_UDRE_vect) && (EMUNIT_PORT_AVRUART_USART == 0)) || defined(__DOXYGEN__)
+#define AVRUART_UDRE_vect USART_UDRE_vect
+#else
+#define AVRUART_UDRE_vect EMUNIT_CN3(USART, EMUNIT_PORT_AVRUART_USART, _UDRE_vect)
+#endif
+
+/**
+ * @brief MCU status register with reset flags
+ */
+#if defined(MCUSR) || defined(__DOXYGEN__)
+#define AVRUART_MCUSR MCUSR
+#else
+#define AVRUART_MCUSR MCUCSR
+#endif
+
+/**
+ * @brief Transmit state
+ *
+ * It is cleared at every restart, as the restart waits for the transmission end.
+ */
+static struct
+{
+	/** Transmit buffers */
+	char buffer[2][EMUNIT_PORT_AVRUART_BUFFER_SIZE];
+	/** Number of bytes queued in the buffer, 0 if the buffer is free */
+	volatile uint8_t len[2];
+	/** The index of the byte to be sent from the buffer being transmitted */
+	volatile uint8_t pos;
+	/** The index of the buffer being transmitted */
+	volatile uint8_t tx;
+	/** The index of the buffer being filled */
+	uint8_t fill;
+	/** Number of bytes in the buffer being filled */
+	uint8_t fill_len;
+	/** USART is initialised */
+	bool ready;
+	/** Any byte was sent since the restart */
+	volatile bool sent;
+}avruart;
+
+/**
+ * @brief Send the next byte
+ *
+ * Auxiliary internal function called from the data register empty interrupt.
+ * Switches to the other buffer when the current one is sent
+ * and disables the interrupt if there is nothing more to send.
+ */
+static inline void avruart_tx_next(void)
+{
+	uint8_t tx = avruart.tx;
+	uint8_t pos = avruart.pos;
+	/* Clear the transmit complete flag, so it marks the end of the last byte */
+	AVRUART_UCSRA = (AVRUART_UCSRA & (1U << AVRUART_U2X)) | (1U << AVRUART_TXC);
+	AVRUART_UDR = avruart.buffer[tx][pos++];
+	avruart.sent = true;
+	if(pos >= avruart.len[tx])
+	{
+		avruart.len[tx] = 0;
+		pos = 0;
+		tx ^= 1U;
+		avruart.tx = tx;
+		if(0U == avruart.len[tx])
+		{
+			AVRUART_UCSRB &= (uint8_t)~(1U << AVRUART_UDRIE);
+		}
+	}
+	avruart.pos = pos;
+}
+
+ISR(AVRUART_UDRE_vect)
+{
+	avruart_tx_next();
+}
+
+/**
+ * @brief Single step of the transmission wait loop
+ *
+ * Auxiliary internal function.
+ * If the interrupts are disabled, the data register is polled here,
+ * so the wait never blocks.
+ */
+static inline void avruart_wait_step(void)
+{
+	if((0U == (SREG & (1U << SREG_I))) &&
+		(0U != (AVRUART_UCSRB & (1U << AVRUART_UDRIE))) &&
+		(0U != (AVRUART_UCSRA & (1U << AVRUART_UDRE))))
+	{
+		avruart_tx_next();
+	}
+}
+
+/**
+ * @brief Queue the buffer being filled
+ *
+ * Auxiliary internal function.
+ * Starts the transmission if it is not running and switches
+ * the filling to the other buffer.
+ */
+static void avruart_submit(void)
+{
+	uint8_t sreg;
+	if(0U == avruart.fill_len)
+	{
+		return;
+	}
+	sreg = SREG;
+	cli();
+	avruart.len[avruart.fill] = avruart.fill_len;
+	if(0U == (AVRUART_UCSRB & (1U << AVRUART_UDRIE)))
+	{
+		avruart.tx  = avruart.fill;
+		avruart.pos = 0;
+		AVRUART_UCSRB |= (1U << AVRUART_UDRIE);
+	}
+	SREG = sreg;
+	avruart.fill ^= 1U;
+	avruart.fill_len = 0;
+}
+
+/**
+ * @brief Wait for all the data to be sent
+ *
+ * Auxiliary internal function.
+ * Returns when the last byte leaves the shift register.
+ */
+static void avruart_drain(void)
+{
+	avruart_submit();
+	while((0U != avruart.len[0]) || (0U != avruart.len[1]))
+	{
+		avruart_wait_step();
+	}
+	if(avruart.sent)
+	{
+		while(0U == (AVRUART_UCSRA & (1U << AVRUART_TXC)))
+		{
+			/* Waiting for the shift register */
+		}
+	}
+}
+
+
+void emunit_port_avruart_out_init(void)
+{
+	if(!avruart.ready)
+	{
+		AVRUART_UBRRH = UBRRH_VALUE;
+		AVRUART_UBRRL = UBRRL_VALUE;
+#if USE_2X
+		AVRUART_UCSRA = (1U << AVRUART_U2X);
+#else
+		AVRUART_UCSRA = 0;
+#endif
+		AVRUART_UCSRB = (1U << AVRUART_TXEN);
+		avruart.ready = true;
+		sei();
+	}
+}
+
+void emunit_port_avruart_out_deinit(void)
+{
+	/* Send the rest in the background */
+	avruart_submit();
+}
+
+void emunit_port_avruart_out_write(char const * p_str, size_t len)
+{
+	while(0U != len)
+	{
+		size_t n;
+		while(0U != avruart.len[avruart.fill])
+		{
+			/* Waiting for the buffer to be sent */
+			avruart_wait_step();
+		}
+		n = EMUNIT_MIN(len, (size_t)(EMUNIT_PORT_AVRUART_BUFFER_SIZE - avruart.fill_len));
+		memcpy(&avruart.buffer[avruart.fill][avruart.fill_len], p_str, n);
+		avruart.fill_len += (uint8_t)n;
+		p_str += n;
+		len   -= n;
+		if(EMUNIT_PORT_AVRUART_BUFFER_SIZE == avruart.fill_len)
+		{
+			avruart_submit();
+		}
+	}
+}
+
+void emunit_port_avruart_out_wait(void)
+{
+	/* The display buffer is copied by the write - just send everything that is waiting */
+	emunit_flush();
+}
+
+void emunit_port_avruart_out_select(uint8_t stream)
+{
+	/* There is only one serial line: mark the stream change in the output */
+	char const mark[2] = {EMUNIT_PORT_AVRUART_STREAM_MARK, (char)('0' + stream)};
+	emunit_port_avruart_out_write(mark, sizeof(mark));
+}
+
+void emunit_port_avruart_early_init(emunit_status_key_t * p_valid_key)
+{
+	uint8_t mcusr = AVRUART_MCUSR;
+	if((0U != (mcusr & (~(1U<<WDRF))))
+	  ||
+	  (0U == mcusr) /* Special case for simavr */)
+	{
+		/* Restart request (invalidate status structure) */
+		*p_valid_key = EMUNIT_STATUS_KEY_INVALID;
+	}
+	AVRUART_MCUSR = 0U;
+	wdt_disable();
+}
+
+void emunit_port_avruart_restart(void)
+{
+	/* Only the data still in the buffers delays the restart */
+	avruart_drain();
+	cli();
+	wdt_enable(WDTO_15MS);
+	while(1)
+	{
+		/* Waiting for reset */
+	}
+}
+
+void emunit_port_avruart_tc_begin(void)
+{
+
+}
+
+void emunit_port_avruart_tc_end(void)
+{
+
+}
+
+bool emunit_port_avruart_ts_selected(size_t suite_idx)
+{
+	(void)suite_idx;
+	return true;
+}
+
+#if EMUNIT_CONF_TIMING && EMUNIT_CONF_BENCH_BASELINE
+bool emunit_port_avruart_bench_baseline(emunit_bench_t * p_baseline)
+{
+	/* The results are compared with the baseline by the host tool */
+	(void)p_baseline;
+	return false;
+}
+#endif
+
+
+int main(void)
+{
+	int ret;
+	emunit_flush();
+	ret = emunit_run();
+	/* Returning from main disables the interrupts */
+	avruart_drain();
+	return ret;
+}
+
+void before_main(void) __attribute__ ((naked)) __attribute__((used)) __attribute__ ((section (".init3")));
+
+void before_main(void)
+{
+	emunit_early_init();
+}
@@ -0,0 +1,98 @@
+#ifndef EMUNIT_PORT_AVRUART_H_INCLUDED
+#define EMUNIT_PORT_AVRUART_H_INCLUDED
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief EMUnit AVR USART port
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * File with EMUnit port for hardware AVR USART.
+ * @sa emunit_port_avruart_group
+ */
+#include <emunit_types.h>
+#include "emunit_port_avruart_arch.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/**
+ * @defgroup emunit_port_avruart_group <emunit_port_avruart> EMUnit AVR USART port
+ * @{
+ * @ingroup emunit_port_group
+ *
+ * The output is sent by the USART data register empty interrupt
+ * from two buffers: one is transmitted while the other is filled.
+ * The write only queues the data, so the test starts while the output
+ * of the previous run is still being sent.
+ * The restart waits only for the transmission to finish.
+ *
+ * The global interrupts are enabled when the output is initialised.
+ * The selected USART cannot be used by the tested code.
+ * @{
+ */
+
+/**
+ * @defgroup emunit_port_avruart_out_group Output stream functions
+ * @{
+ *
+ * @sa emunit_port_out_group
+ */
+	/** See the @ref emunit_port_out_init documentation */
+	void emunit_port_avruart_out_init(void);
+
+	/** See the @ref emunit_port_out_deinit documentation */
+	void emunit_port_avruart_out_deinit(void);
+
+	/** See the @ref emunit_port_out_write documentation */
+	void emunit_port_avruart_out_write(char const * p_str, size_t len);
+
+	/** See the @ref emunit_port_out_wait documentation */
+	void emunit_port_avruart_out_wait(void);
+
+	/** See the @ref emunit_port_out_select documentation */
+	void emunit_port_avruart_out_select(uint8_t stream);
+/** @} */
+
+/** See the @ref emunit_port_first_init documentation */
+void emunit_port_avruart_early_init(emunit_status_key_t * p_valid_key);
+
+/** See the @ref emunit_port_restart documentation */
+void emunit_port_avruart_restart(void) __attribute__ ((noreturn));
+
+/** See the @ref emunit_port_tc_begin documentation */
+void emunit_port_avruart_tc_begin(void);
+
+/** See the @ref emunit_port_tc_end documentation */
+void emunit_port_avruart_tc_end(void);
+
+/** See the @ref emunit_port_ts_selected documentation */
+bool emunit_port_avruart_ts_selected(size_t suite_idx);
+
+#if (EMUNIT_CONF_TIMING && EMUNIT_CONF_BENCH_BASELINE) || defined(__DOXYGEN__)
+/** See the @ref emunit_port_bench_baseline documentation */
+bool emunit_port_avruart_bench_baseline(emunit_bench_t * p_baseline);
+#endif
+
+/** @} */
+#endif /* EMUNIT_PORT_AVRUART_H_INCLUDED */
@@ -32,54 +32,193 @@
 #include <emunit_private.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
 #include <pthread.h>
+#include <sched.h>
+#include <setjmp.h>
+#include <signal.h>
+#if EMUNIT_PORT_PCSTDOUT_PERSIST
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#endif
+
+#if EMUNIT_PORT_PCSTDOUT_PERSIST || defined(__DOXYGEN__)
+/**
+ * @brief Round the size up to the whole pages
+ */
+#define PCSTDOUT_PAGE_ROUND(size) \
+	((((size) + EMUNIT_PORT_PCSTDOUT_PAGE_SIZE - 1U) / EMUNIT_PORT_PCSTDOUT_PAGE_SIZE) * \
+	EMUNIT_PORT_PCSTDOUT_PAGE_SIZE)
+
+/**
+ * @brief Define the variable that is mapped to the status file
+ *
+ * The variable is placed in its own page aligned memory block,
+ * so the mapping never covers any other data.
+ *
+ * @param type Variable type
+ * @param name Variable name
+ */
+#define PCSTDOUT_PERSIST_VAR(type, name)                              \
+	static union                                                       \
+	{                                                                  \
+		type v;                                                        \
+		char page[PCSTDOUT_PAGE_ROUND(sizeof(type))];                  \
+	}pcstdout_persist_ ## name                                         \
+		__attribute__((aligned(EMUNIT_PORT_PCSTDOUT_PAGE_SIZE)));      \
+	extern type name __attribute__((alias("pcstdout_persist_" #name)))
 
+/* Variables required by the emunit engine */
+PCSTDOUT_PERSIST_VAR(emunit_status_t, emunit_status);
+PCSTDOUT_PERSIST_VAR(emunit_display_status_t, emunit_display_status);
+
+/**
+ * @brief Set if the test is resumed from the status file
+ *
+ * Output stream files are appended instead of being truncated then.
+ */
+static bool pcstdout_resumed;
+#else
 /* Variables required by the emunit engine */
 emunit_status_t emunit_status;
 emunit_display_status_t emunit_display_status;
+#endif
 
 /**
  * @brief Variable that holds current test state
  *
- * Tests runs using threads.
+ * Tests runs in the worker thread.
  * This variable is cleared when test finishes.
  */
-static bool pcstdout_continue_test;
+static volatile bool pcstdout_continue_test;
 
 /**
- * @brief Put single character to out register
+ * @brief Variable set when the test thread finishes its step
  *
- * Auxiliary internal function.
- * It sends to console given value without any conversion.
+ * Used by the main thread that drains the display buffer
+ * while the test step is running.
+ * The worker waits for the main thread to clear it before the next step.
+ */
+static volatile bool pcstdout_step_done;
+
+/**
+ * @brief Test loop jump buffer
  *
- * @param c Character to be printed
+ * The whole test runs in single, long living worker thread.
+ * When test restarts long jump is performed to the beginning of the worker loop.
  */
-static inline void pcstdout_putc_raw(char c)
+static sigjmp_buf pcstdout_restart_jmp;
+
+/**
+ * @brief Currently selected output file descriptor
+ *
+ * It is the descriptor given in the command line, or stdout,
+ * unless other stream is selected.
+ */
+static int pcstdout_out_fd;
+
+/**
+ * @brief Output file descriptor of the stream 0
+ */
+static int pcstdout_main_fd = STDOUT_FILENO;
+
+/**
+ * @brief Files opened for the additional output streams
+ *
+ * 0 for the stream that is not opened yet.
+ *
+ * @sa EMUNIT_PORT_PCSTDOUT_STREAM_FILE
+ */
+static int pcstdout_stream_fds[EMUNIT_DISPLAY_MULTI_MAX];
+
+/**
+ * @brief Maximum number of the parts written in one system call
+ */
+#ifdef IOV_MAX
+#define PCSTDOUT_IOV_MAX (IOV_MAX < 1024 ? IOV_MAX : 1024)
+#else
+#define PCSTDOUT_IOV_MAX 16
+#endif
+
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+/**
+ * @brief Header line of the baseline file
+ */
+static const char pcstdout_baseline_header[] = "suite,case,median,p90,unit\n";
+
+/**
+ * @brief The file where the benchmark results are recorded
+ *
+ * NULL if the results are not recorded.
+ */
+static FILE * pcstdout_record_f;
+#endif
+
+#if (EMUNIT_CONF_TIMING && EMUNIT_CONF_BENCH_BASELINE) || defined(__DOXYGEN__)
+/**
+ * @brief Single baseline file entry
+ */
+typedef struct
 {
-	putchar(c);
-}
+	char * p_suite;       /**< Test suite name */
+	char * p_case;        /**< Test case name  */
+	emunit_bench_t bench; /**< Baseline figures, only median and p90 are set */
+}pcstdout_baseline_t;
+
+/** Entries loaded from the baseline file */
+static pcstdout_baseline_t * pcstdout_baseline;
+
+/** Number of the entries loaded from the baseline file */
+static size_t pcstdout_baseline_cnt;
+#endif
 
 /**
- * @brief Print single character to the console
+ * @brief Spaces used in place of the tabulators
  *
- * Function uses pcstdout simulator special register to print the data to the
- * standard output.
- * This function performs some basic conversion.
- * See @ref pcstdout_putc_raw for function without any conversion.
+ * Every tabulator is replaced by 2 spaces.
+ * Following tabulators use the same part of the output.
+ */
+static const char pcstdout_spaces[] = "                                ";
+
+/**
+ * @brief Write all the given parts to the output
  *
- * @param c Character to be printed
+ * Auxiliary internal function.
+ * It repeats the system call until all the data is written.
+ *
+ * @param p_iov The parts to be written, modified on partial write
+ * @param cnt   Number of parts
  */
-static inline void pcstdout_putc(char c)
+static void pcstdout_writev(struct iovec * p_iov, int cnt)
 {
-	switch(c)
+	while(cnt > 0)
 	{
-	case '\t':
-		pcstdout_putc_raw(' ');
-		pcstdout_putc_raw(' ');
-		break;
-	default:
-		pcstdout_putc_raw(c);
-		break;
+		ssize_t n = writev(pcstdout_out_fd, p_iov, cnt);
+		if(n < 0)
+		{
+			if(EINTR == errno)
+				continue;
+			perror("pcstdout");
+			exit(-1);
+		}
+		while((cnt > 0) && ((size_t)n >= p_iov->iov_len))
+		{
+			n -= p_iov->iov_len;
+			++p_iov;
+			--cnt;
+		}
+		if(cnt > 0)
+		{
+			p_iov->iov_base = (char *)p_iov->iov_base + n;
+			p_iov->iov_len -= n;
+		}
 	}
 }
 
@@ -94,43 +233,219 @@ void emunit_port_pcstdout_out_deinit(void)
 
 void emunit_port_pcstdout_out_write(char const * p_str, size_t len)
 {
-	while(0 != len--)
+	struct iovec iov[PCSTDOUT_IOV_MAX];
+	int cnt = 0;
+
+	/* Contiguous runs are written directly from the buffer,
+	 * tabulators are expanded only at the runs boundaries */
+	while(0U != len)
+	{
+		char const * p_tab = memchr(p_str, '\t', len);
+		size_t run = (NULL == p_tab) ? len : (size_t)(p_tab - p_str);
+		if(0U != run)
+		{
+			iov[cnt].iov_base = (void *)p_str;
+			iov[cnt].iov_len  = run;
+			++cnt;
+			p_str += run;
+			len   -= run;
+		}
+		if(NULL != p_tab)
+		{
+			size_t tabs = 0;
+			while((tabs < len) && ('\t' == p_str[tabs]) &&
+				(2U * (tabs + 1U) <= sizeof(pcstdout_spaces) - 1U))
+			{
+				++tabs;
+			}
+			iov[cnt].iov_base = (void *)pcstdout_spaces;
+			iov[cnt].iov_len  = 2U * tabs;
+			++cnt;
+			p_str += tabs;
+			len   -= tabs;
+		}
+		if(cnt > PCSTDOUT_IOV_MAX - 2)
+		{
+			pcstdout_writev(iov, cnt);
+			cnt = 0;
+		}
+	}
+	if(0 != cnt)
+	{
+		pcstdout_writev(iov, cnt);
+	}
+}
+
+void emunit_port_pcstdout_out_wait(void)
+{
+	/* The main thread drains the buffer in the background */
+	sched_yield();
+}
+
+void emunit_port_pcstdout_out_select(uint8_t stream)
+{
+	if(0U == stream)
 	{
-		pcstdout_putc(*(p_str++));
+		pcstdout_out_fd = pcstdout_main_fd;
+		return;
 	}
+	if(0 == pcstdout_stream_fds[stream])
+	{
+		char name[FILENAME_MAX];
+		snprintf(name, sizeof(name), EMUNIT_PORT_PCSTDOUT_STREAM_FILE, (unsigned int)stream);
+		int flags = O_WRONLY | O_CREAT | O_TRUNC;
+#if EMUNIT_PORT_PCSTDOUT_PERSIST
+		if(pcstdout_resumed)
+			flags = O_WRONLY | O_CREAT | O_APPEND;
+#endif
+		pcstdout_stream_fds[stream] = open(name, flags, 0666);
+		if(pcstdout_stream_fds[stream] < 0)
+		{
+			perror(name);
+			exit(-1);
+		}
+	}
+	pcstdout_out_fd = pcstdout_stream_fds[stream];
 }
 
 void emunit_port_pcstdout_early_init(emunit_status_key_t * p_valid_key)
 {
+#if EMUNIT_PORT_PCSTDOUT_PERSIST
+	/* The status file decides if the test is started or resumed */
+	(void)p_valid_key;
+#else
 	/* We are working in a loop.
 	 * Early init is called always and only once when the program starts */
 	*p_valid_key = EMUNIT_STATUS_KEY_INVALID;
+#endif
 }
 
 void emunit_port_pcstdout_restart(void)
 {
-	/* Exit current thread */
-	pthread_exit((void*)1);
-
-	/* This should never happen */
-	fputs("Thread did not exit properly", stderr);
-	exit(-1);
+	/* Unwind to the beginning of the worker loop */
+	siglongjmp(pcstdout_restart_jmp, 1);
 }
 
 void emunit_port_pcstdout_tc_begin(void)
 {
-
+#if EMUNIT_PORT_PCSTDOUT_TIMEOUT
+	alarm(EMUNIT_PORT_PCSTDOUT_TIMEOUT);
+#endif
 }
 
 void emunit_port_pcstdout_tc_end(void)
 {
+#if EMUNIT_PORT_PCSTDOUT_TIMEOUT
+	alarm(0);
+#endif
+#if EMUNIT_CONF_TIMING
+	const emunit_bench_t * p_bench = emunit_tc_bench_get();
+	if((NULL != pcstdout_record_f) && (NULL != p_bench))
+	{
+		fprintf(pcstdout_record_f,
+			"%" PRIsPGM ",%" PRIsPGM ",%" PRIuTIMESTAMP ",%" PRIuTIMESTAMP "," EMUNIT_TIMESTAMP_UNIT "\n",
+			emunit_ts_name_get(emunit_ts_current_index_get()),
+			emunit_tc_name_get(emunit_ts_current_index_get(), emunit_tc_current_index_get()),
+			p_bench->median,
+			p_bench->p90);
+		/* The next test step may be run by another process */
+		fflush(pcstdout_record_f);
+	}
+#endif
+}
+
+bool emunit_port_pcstdout_ts_selected(size_t suite_idx)
+{
+	(void)suite_idx;
+	return true;
+}
+
+#if (EMUNIT_CONF_TIMING && EMUNIT_CONF_BENCH_BASELINE) || defined(__DOXYGEN__)
+bool emunit_port_pcstdout_bench_baseline(emunit_bench_t * p_baseline)
+{
+	const char * p_suite = emunit_ts_name_get(emunit_ts_current_index_get());
+	const char * p_case  = emunit_tc_name_get(emunit_ts_current_index_get(), emunit_tc_current_index_get());
+	size_t n;
+
+	for(n = 0; n < pcstdout_baseline_cnt; ++n)
+	{
+		if((0 == strcmp(pcstdout_baseline[n].p_suite, p_suite)) &&
+			(0 == strcmp(pcstdout_baseline[n].p_case, p_case)))
+		{
+			*p_baseline = pcstdout_baseline[n].bench;
+			return true;
+		}
+	}
+	return false;
+}
+#endif
+
+#if EMUNIT_PORT_PCSTDOUT_TIMEOUT || defined(__DOXYGEN__)
+/**
+ * @brief Test case timeout handler
+ *
+ * Works like the watchdog reset: the test step is abandoned
+ * and the engine reports the timeout failure when it is run again.
+ * The signal is delivered to the worker thread only.
+ *
+ * @param sig Unused
+ */
+static void pcstdout_timeout_handler(int sig)
+{
+	(void)sig;
+	siglongjmp(pcstdout_restart_jmp, 1);
+}
+
+/**
+ * @brief Install the test case timeout handler
+ *
+ * The signal is blocked in the calling thread,
+ * the worker thread unblocks it when it starts.
+ * The handler does not block its own signal,
+ * as the long jump does not restore the signal mask.
+ */
+static void pcstdout_timeout_init(void)
+{
+	struct sigaction sa;
+	sigset_t set;
 
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = pcstdout_timeout_handler;
+	sa.sa_flags   = SA_NODEFER;
+	sigemptyset(&sa.sa_mask);
+	sigaction(SIGALRM, &sa, NULL);
+	sigemptyset(&set);
+	sigaddset(&set, SIGALRM);
+	pthread_sigmask(SIG_BLOCK, &set, NULL);
+}
+#endif
+
+/**
+ * @brief Prepare the next test step
+ *
+ * Sends the display buffer before every step.
+ * In drain mode the main thread is the only buffer consumer,
+ * so the worker waits for it to send the buffer.
+ */
+static void pcstdout_step_begin(void)
+{
+#if EMUNIT_CONF_DISPLAY_DRAIN
+	pcstdout_step_done = true;
+	while(pcstdout_step_done)
+	{
+		sched_yield();
+	}
+#else
+	emunit_flush();
+#endif
 }
 
 /**
  * Thread That runs the test
  *
- * This is a thread that runs the test.
+ * This is a thread that runs the whole test.
+ * Every restart jumps back to the beginning of the loop,
+ * so the thread and its stack are reused by all the test steps.
  * It clears @ref pcstdout_continue_test global variable if test finishes.
  *
  * @param p_param Unused
@@ -141,31 +456,338 @@ static void* test_thread(void * p_param)
 	(void)p_param;
 	int ret;
 
+#if EMUNIT_PORT_PCSTDOUT_TIMEOUT
+	{
+		sigset_t set;
+		sigemptyset(&set);
+		sigaddset(&set, SIGALRM);
+		pthread_sigmask(SIG_UNBLOCK, &set, NULL);
+	}
+#endif
+	/* Signal mask is never changed by the tests - do not save it */
+	(void)sigsetjmp(pcstdout_restart_jmp, 0);
+	pcstdout_step_begin();
 	ret = emunit_run();
 	/* If the run function exits normally it means that the whole test has finished.
-	 * If the test continues it exits calling @ref emunit_port_pcstdout_restart.
+	 * If the test continues it jumps back calling @ref emunit_port_pcstdout_restart.
 	 */
 	pcstdout_continue_test = false;
-	return (void*)ret;
+	return (void*)(intptr_t)ret;
 }
 
+#if EMUNIT_CONF_DISPLAY_DRAIN || defined(__DOXYGEN__)
+/**
+ * @brief Drain the display buffer
+ *
+ * Sends all the data that is ready in the display buffer.
+ * Called by the main thread concurrently with the test thread.
+ */
+static void pcstdout_drain(void)
+{
+	char const * p_data;
+	size_t len;
+	while(0U != (len = emunit_display_drain_get(&p_data)))
+	{
+		emunit_port_pcstdout_out_write(p_data, len);
+		emunit_display_drain_release(len);
+	}
+}
+#endif
 
-int main(void)
+#if EMUNIT_CONF_TIMING || defined(__DOXYGEN__)
+/**
+ * @brief Open the file where the benchmark results are recorded
+ *
+ * The resumed test appends the results to the file.
+ *
+ * @param p_file File name
+ */
+static void pcstdout_record_open(char const * p_file)
 {
-	int ret;
+	bool append = false;
+#if EMUNIT_PORT_PCSTDOUT_PERSIST
+	append = pcstdout_resumed;
+#endif
+	pcstdout_record_f = fopen(p_file, append ? "a" : "w");
+	if(NULL == pcstdout_record_f)
+	{
+		perror(p_file);
+		exit(-1);
+	}
+	if(!append)
+	{
+		fputs(pcstdout_baseline_header, pcstdout_record_f);
+		fflush(pcstdout_record_f);
+	}
+}
+#endif
+
+#if (EMUNIT_CONF_TIMING && EMUNIT_CONF_BENCH_BASELINE) || defined(__DOXYGEN__)
+/**
+ * @brief Load the baseline file
+ *
+ * The baseline recorded in other unit is an error,
+ * the lines that are not baseline entries are skipped.
+ *
+ * @param p_file File name
+ */
+static void pcstdout_baseline_load(char const * p_file)
+{
+	char line[512];
+	FILE * p_f = fopen(p_file, "r");
+	if(NULL == p_f)
+	{
+		perror(p_file);
+		exit(-1);
+	}
+	while(NULL != fgets(line, sizeof(line), p_f))
+	{
+		char str_suite[200];
+		char str_case[200];
+		char str_unit[16];
+		unsigned long long median;
+		unsigned long long p90;
+		pcstdout_baseline_t * p_new;
+
+		if(5 != sscanf(line, "%199[^,],%199[^,],%llu,%llu,%15[^,\r\n]",
+			str_suite, str_case, &median, &p90, str_unit))
+		{
+			continue;
+		}
+		if(0 != strcmp(str_unit, EMUNIT_TIMESTAMP_UNIT))
+		{
+			fprintf(stderr, "Baseline file %s: unit %s, expected " EMUNIT_TIMESTAMP_UNIT "\n",
+				p_file, str_unit);
+			exit(-1);
+		}
+		p_new = realloc(pcstdout_baseline, (pcstdout_baseline_cnt + 1U) * sizeof(*p_new));
+		if(NULL == p_new)
+		{
+			perror(p_file);
+			exit(-1);
+		}
+		pcstdout_baseline = p_new;
+		p_new = &pcstdout_baseline[pcstdout_baseline_cnt++];
+		memset(p_new, 0, sizeof(*p_new));
+		p_new->p_suite = strdup(str_suite);
+		p_new->p_case  = strdup(str_case);
+		p_new->bench.median = (emunit_timestamp_t)median;
+		p_new->bench.p90    = (emunit_timestamp_t)p90;
+		if((NULL == p_new->p_suite) || (NULL == p_new->p_case))
+		{
+			perror(p_file);
+			exit(-1);
+		}
+	}
+	fclose(p_f);
+}
+#endif
+
+#if EMUNIT_PORT_PCSTDOUT_PERSIST || defined(__DOXYGEN__)
+/**
+ * @brief Map the variable to the part of the status file
+ *
+ * @param fd     Status file descriptor
+ * @param p_var  Page aligned variable
+ * @param size   Variable size rounded up to the whole pages
+ * @param offset Variable offset in the file
+ */
+static void pcstdout_persist_map_var(int fd, void * p_var, size_t size, off_t offset)
+{
+	if(MAP_FAILED == mmap(p_var, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, offset))
+	{
+		perror(EMUNIT_PORT_PCSTDOUT_PERSIST_FILE);
+		exit(-1);
+	}
+}
+
+/**
+ * @brief Map the engine status to the status file
+ *
+ * The file that has wrong size is cleared, so the test starts from the beginning.
+ */
+static void pcstdout_persist_map(void)
+{
+	const size_t status_size  = sizeof(pcstdout_persist_emunit_status);
+	const size_t display_size = sizeof(pcstdout_persist_emunit_display_status);
+	struct stat st;
+	int fd;
+
+	if(0 != (EMUNIT_PORT_PCSTDOUT_PAGE_SIZE % sysconf(_SC_PAGESIZE)))
+	{
+		fprintf(stderr, "EMUNIT_PORT_PCSTDOUT_PAGE_SIZE is not multiply of the system page size\n");
+		exit(-1);
+	}
+	fd = open(EMUNIT_PORT_PCSTDOUT_PERSIST_FILE, O_RDWR | O_CREAT, 0666);
+	if((fd < 0) || (fstat(fd, &st) < 0))
+	{
+		perror(EMUNIT_PORT_PCSTDOUT_PERSIST_FILE);
+		exit(-1);
+	}
+	if((size_t)st.st_size != status_size + display_size)
+	{
+		if((ftruncate(fd, 0) < 0) || (ftruncate(fd, (off_t)(status_size + display_size)) < 0))
+		{
+			perror(EMUNIT_PORT_PCSTDOUT_PERSIST_FILE);
+			exit(-1);
+		}
+	}
+	pcstdout_persist_map_var(fd, &pcstdout_persist_emunit_status, status_size, 0);
+	pcstdout_persist_map_var(fd, &pcstdout_persist_emunit_display_status, display_size, (off_t)status_size);
+	close(fd);
+	pcstdout_resumed = (EMUNIT_STATUS_KEY_VALID == emunit_status.key_valid);
+}
+
+/**
+ * @brief Run the test in the child process and launch it again after crash
+ *
+ * The child process returns from this function and runs the test.
+ * The parent waits for the child and launches the next one
+ * if the child was killed in the middle of the test case.
+ * The crash outside of the test case aborts the whole test.
+ *
+ * @param[out] p_ret The value to be returned by the parent process
+ *
+ * @retval true  Parent process, the test has finished.
+ * @retval false Child process, the test should be run.
+ */
+static bool pcstdout_supervise(int * p_ret)
+{
+	for(;;)
+	{
+		int wstatus;
+		pid_t pid = fork();
+		if(pid < 0)
+		{
+			perror("fork");
+			exit(-1);
+		}
+		if(0 == pid)
+		{
+			return false;
+		}
+		while(waitpid(pid, &wstatus, 0) < 0)
+		{
+			if(EINTR != errno)
+			{
+				perror("waitpid");
+				exit(-1);
+			}
+		}
+		if(!WIFSIGNALED(wstatus))
+		{
+			*p_ret = WEXITSTATUS(wstatus);
+			break;
+		}
+		/* The status is shared with the child */
+		if(EMUNIT_RR_TIMEOUT != emunit_status.rr)
+		{
+			fprintf(stderr, "Test interrupted by signal %d outside of the test case\n",
+				WTERMSIG(wstatus));
+			*p_ret = -1;
+			break;
+		}
+		fprintf(stderr, "Test case interrupted by signal %d, resuming\n", WTERMSIG(wstatus));
+		pcstdout_resumed = true;
+	}
+	unlink(EMUNIT_PORT_PCSTDOUT_PERSIST_FILE);
+	return true;
+}
+#endif
+
+
+/**
+ * @brief Program entry point
+ *
+ * The only optional argument is the file descriptor number
+ * where the test output is written instead of stdout.
+ * For example: `test.exe 3 3>result.xml`.
+ * It may be preceded by the baseline options:
+ * `-r <file>` records the benchmark results and
+ * `-b <file>` compares the benchmarks with the baseline.
+ *
+ * @param argc Number of arguments
+ * @param argv Arguments
+ * @return The value returned by the emunit test runtime
+ */
+int main(int argc, char * argv[])
+{
+	pthread_t thread_id;
+	void * test_ret;
+	char const * p_record_file = NULL;
+	int opt;
+
+	while(-1 != (opt = getopt(argc, argv, "b:r:")))
+	{
+		switch(opt)
+		{
+#if EMUNIT_CONF_TIMING && EMUNIT_CONF_BENCH_BASELINE
+		case 'b':
+			pcstdout_baseline_load(optarg);
+			break;
+#endif
+#if EMUNIT_CONF_TIMING
+		case 'r':
+			p_record_file = optarg;
+			break;
+#endif
+		default:
+			fprintf(stderr, "Usage: %s [-b baseline.csv] [-r baseline.csv] [fd]\n", argv[0]);
+			return -1;
+		}
+	}
+	if(optind < argc)
+	{
+		char * p_end;
+		long fd = strtol(argv[optind], &p_end, 10);
+		if(('\0' != *p_end) || (fd < 0) || (fd > INT_MAX) || (fcntl((int)fd, F_GETFD) < 0))
+		{
+			fprintf(stderr, "Wrong output file descriptor: %s\n", argv[optind]);
+			return -1;
+		}
+		pcstdout_main_fd = (int)fd;
+	}
+	pcstdout_out_fd = pcstdout_main_fd;
+#if EMUNIT_PORT_PCSTDOUT_PERSIST
+	pcstdout_persist_map();
+#endif
+#if EMUNIT_CONF_TIMING
+	if(NULL != p_record_file)
+	{
+		pcstdout_record_open(p_record_file);
+	}
+#else
+	(void)p_record_file;
+#endif
+#if EMUNIT_PORT_PCSTDOUT_PERSIST
+	{
+		int ret;
+		if(pcstdout_supervise(&ret))
+			return ret;
+	}
+#endif
 	emunit_early_init();
 	pcstdout_continue_test = true;
+	pcstdout_step_done = false;
+#if EMUNIT_PORT_PCSTDOUT_TIMEOUT
+	pcstdout_timeout_init();
+#endif
 
+	pthread_create(&thread_id, NULL, test_thread, NULL);
+#if EMUNIT_CONF_DISPLAY_DRAIN
+	/* Send the output while the test is running */
 	while(pcstdout_continue_test)
 	{
-		pthread_t thread_id;
-		void * test_ret;
-
-		emunit_flush();
-
-		pthread_create(&thread_id, NULL, test_thread, NULL);
-		pthread_join(thread_id, &test_ret);
-		ret = (int)test_ret;
+		pcstdout_drain();
+		if(pcstdout_step_done)
+		{
+			emunit_flush();
+			EMUNIT_MEMORY_BARRIER();
+			pcstdout_step_done = false;
+		}
+		sched_yield();
 	}
-	return ret;
+#endif
+	pthread_join(thread_id, &test_ret);
+	return (int)(intptr_t)test_ret;
 }
@@ -41,9 +41,86 @@
  * @{
  * @ingroup emunit_port_group
  *
+ * The whole test runs in single worker thread.
+ * Restart is performed by the long jump to the beginning of the worker loop.
+ * The output is written in contiguous runs directly from the display buffer.
+ * The file descriptor used instead of stdout may be given
+ * as the only command line argument.
+ *
+ * If @ref EMUNIT_PORT_PCSTDOUT_PERSIST is set, the test runs in the child
+ * process and the engine status is kept in the memory mapped file.
+ * The child that crashes in the middle of the test case is launched again,
+ * the interrupted test case is reported as timeout failure
+ * and the test continues from the next test case.
+ *
+ * The test case that does not finish in @ref EMUNIT_PORT_PCSTDOUT_TIMEOUT
+ * seconds is abandoned and reported as timeout failure.
+ *
+ * If @ref EMUNIT_CONF_TIMING is set, the benchmark results may be recorded
+ * into the baseline file given by `-r <file>` option.
+ * With @ref EMUNIT_CONF_BENCH_BASELINE set, the benchmarks are compared
+ * with the baseline file given by `-b <file>` option.
+ * The baseline is a CSV file with `suite,case,median,p90,unit` columns.
+ * The lines that do not match this format, like the header, are ignored.
+ *
  * @{
  */
 
+/**
+ * @brief File name format of the additional output streams
+ *
+ * Used if @ref EMUNIT_CONF_DISPLAY_MULTI is set.
+ * Stream 0 is always sent to stdout, any other stream is written
+ * to the file named by this format and the stream index.
+ */
+#ifndef EMUNIT_PORT_PCSTDOUT_STREAM_FILE
+#define EMUNIT_PORT_PCSTDOUT_STREAM_FILE "emunit_stream%u.out"
+#endif
+
+/**
+ * @brief Test case timeout in seconds
+ *
+ * Started by @ref emunit_port_pcstdout_tc_begin and stopped by
+ * @ref emunit_port_pcstdout_tc_end.
+ * The test case that hangs is interrupted and the test continues
+ * from the next test case, like after the watchdog reset.
+ * Set to 0 to disable the timeout.
+ */
+#ifndef EMUNIT_PORT_PCSTDOUT_TIMEOUT
+#define EMUNIT_PORT_PCSTDOUT_TIMEOUT 10
+#endif
+
+/**
+ * @brief Keep the engine status in the memory mapped file
+ *
+ * The status survives the crash of the test process.
+ * The file left by the interrupted run is used to resume the test
+ * when it is started again.
+ * The file is removed when the test finishes.
+ */
+#ifndef EMUNIT_PORT_PCSTDOUT_PERSIST
+#define EMUNIT_PORT_PCSTDOUT_PERSIST 0
+#endif
+
+/**
+ * @brief The name of the file that keeps the engine status
+ *
+ * Used if @ref EMUNIT_PORT_PCSTDOUT_PERSIST is set.
+ * Remove the file left by the interrupted run if the test is rebuilt.
+ */
+#ifndef EMUNIT_PORT_PCSTDOUT_PERSIST_FILE
+#define EMUNIT_PORT_PCSTDOUT_PERSIST_FILE "emunit_status.bin"
+#endif
+
+/**
+ * @brief Alignment of the variables mapped to the status file
+ *
+ * It has to be multiply of the system page size.
+ */
+#ifndef EMUNIT_PORT_PCSTDOUT_PAGE_SIZE
+#define EMUNIT_PORT_PCSTDOUT_PAGE_SIZE 4096
+#endif
+
 /**
  * @defgroup emunit_port_pcstdout_out_group Output stream functions
  * @{
@@ -58,6 +135,12 @@
 
 	/** See the @ref emunit_port_out_write documentation */
 	void emunit_port_pcstdout_out_write(char const * p_str, size_t len);
+
+	/** See the @ref emunit_port_out_wait documentation */
+	void emunit_port_pcstdout_out_wait(void);
+
+	/** See the @ref emunit_port_out_select documentation */
+	void emunit_port_pcstdout_out_select(uint8_t stream);
 /** @} */
 
 /** See the @ref emunit_port_first_init documentation */
@@ -72,5 +155,13 @@ void emunit_port_pcstdout_tc_begin(void);
 /** See the @ref emunit_port_tc_end documentation */
 void emunit_port_pcstdout_tc_end(void);
 
+/** See the @ref emunit_port_ts_selected documentation */
+bool emunit_port_pcstdout_ts_selected(size_t suite_idx);
+
+#if (EMUNIT_CONF_TIMING && EMUNIT_CONF_BENCH_BASELINE) || defined(__DOXYGEN__)
+/** See the @ref emunit_port_bench_baseline documentation */
+bool emunit_port_pcstdout_bench_baseline(emunit_bench_t * p_baseline);
+#endif
+
 /** @} */
 #endif /* EMUNIT_PORT_PCSTDOUT_H_INCLUDED */
@@ -37,11 +37,36 @@
 #include <regex.h>
 #include <setjmp.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <ctype.h>
 
 /* Variables required by the emunit engine */
 emunit_status_t emunit_status;
 emunit_display_status_t emunit_display_status;
 
+/**
+ * @brief Number of the compiled patterns cache buckets
+ *
+ * Have to be power of 2.
+ */
+#define PCTEST_RE_CACHE_SIZE 256U
+
+/**
+ * @brief Compiled pattern cache entry
+ *
+ * Most of the tests use the same pattern templates,
+ * so every pattern is compiled only once.
+ */
+typedef struct pctest_re_entry_tag
+{
+	struct pctest_re_entry_tag * p_next; /**< Next entry in the same bucket */
+	uint32_t hash;                       /**< Hash of the pattern string */
+	regex_t  re;                         /**< The pattern itself */
+	char     str_re[];                   /**< Printable copy of test pattern */
+}pctest_re_entry_t;
+
 /**
  * @brief Expected pattern structure
  *
@@ -49,11 +74,108 @@ emunit_display_status_t emunit_display_status;
  */
 typedef struct
 {
-	bool    ready;                           /**< Pattern is set and ready */
-	regex_t re;                              /**< The pattern itself */
-	char    str_re[EMUNIT_TEST_PATTERN_MAX]; /**< Printable copy of test pattern */
+	bool                      ready; /**< Pattern is set and ready */
+	pctest_re_entry_t const * p_re;  /**< Compiled pattern from the cache */
 }pctest_pattern_t;
 
+/**
+ * @brief Compiled patterns cache
+ *
+ * Hash table with the lists of compiled patterns.
+ */
+static pctest_re_entry_t * pctest_re_cache[PCTEST_RE_CACHE_SIZE];
+
+/**
+ * @brief Golden file mode
+ */
+typedef enum
+{
+	PCTEST_GOLDEN_OFF,     /**< Output checked only against the patterns */
+	PCTEST_GOLDEN_RECORD,  /**< Output written into the golden file */
+	PCTEST_GOLDEN_COMPARE  /**< Output compared with the golden file */
+}pctest_golden_mode_t;
+
+/** Golden file identification string */
+#define PCTEST_GOLDEN_MAGIC "EMUGOLD1"
+
+/**
+ * @brief Golden file header
+ *
+ * The header is followed by the index and then by the data area.
+ */
+typedef struct
+{
+	char     magic[8]; /**< @ref PCTEST_GOLDEN_MAGIC without terminating zero */
+	uint32_t count;    /**< Number of the index entries */
+	uint32_t reserved; /**< Unused, 0 */
+}pctest_golden_header_t;
+
+/**
+ * @brief Golden file index entry
+ *
+ * Every entry describes one output keyed by the suite name, case name
+ * and the number of the output in the case.
+ * All the offsets are relative to the beginning of the data area.
+ */
+typedef struct
+{
+	uint64_t data_hash;   /**< Hash of the data */
+	uint32_t key_hash;    /**< Hash of the key */
+	uint32_t key_offset;  /**< Offset of the key string */
+	uint32_t key_len;     /**< Key length without terminating zero */
+	uint32_t data_offset; /**< Offset of the data */
+	uint32_t data_len;    /**< Data length */
+	uint32_t reserved;    /**< Unused, 0 */
+}pctest_golden_idx_t;
+
+/**
+ * @brief Run dependent output elements
+ *
+ * Durations and benchmark figures change between the runs,
+ * so does the display buffer usage, as the durations are written into the buffer.
+ * In golden mode every number inside these elements is replaced by 0
+ * before the output is recorded or compared.
+ */
+static const struct
+{
+	char const * p_begin; /**< Element start */
+	char const * p_end;   /**< The string that ends the numbers */
+}pctest_golden_volatile[] =
+{
+	{"<time ",     "/>"},
+	{"<bench ",    "/>"},
+	{"<measured>", "<"},
+	{"<buffer-warning ", "/>"},
+	{"<used-max>", "<"},
+	{"<testcase-max ", "<"}
+};
+
+/** Maximum length of the golden record key */
+#define PCTEST_GOLDEN_KEY_MAX 512U
+
+/**
+ * @brief Golden file state
+ */
+static struct
+{
+	pctest_golden_mode_t  mode;          /**< Current mode */
+	char const *          p_file;        /**< Golden file name */
+	pctest_golden_idx_t * p_idx;         /**< Index entries */
+	size_t                count;         /**< Number of the index entries */
+	size_t                idx_capacity;  /**< Allocated index entries */
+	char *                p_data;        /**< Data area */
+	size_t                data_size;     /**< Data area size */
+	size_t                data_capacity; /**< Allocated data area size */
+	uint32_t *            p_table;       /**< Lookup table: index entry + 1, 0 for empty slot */
+	size_t                table_size;    /**< Lookup table size, power of 2 */
+	char *                p_norm;        /**< Normalised output */
+	size_t                norm_capacity; /**< Allocated normalised output size */
+	char const *          p_norm_end;    /**< End of the current run dependent element, NULL outside */
+	char                  last_key[PCTEST_GOLDEN_KEY_MAX]; /**< Suite and case of the last output */
+	unsigned int          seq;           /**< Output number in the current case */
+	bool *                p_reached;     /**< Compare mode: the record has been compared */
+}pctest_golden;
+
 /**
  * @brief Jump buffer to the beginning of the test loop
  *
@@ -92,6 +214,24 @@ pctest_pattern_t pctest_expected_footer;
  */
 pctest_pattern_t pctest_expected_test_output;
 
+/**
+ * @brief Currently selected output stream
+ *
+ * Only the stream 0 is checked against the patterns.
+ */
+static uint8_t pctest_out_stream;
+
+#if (EMUNIT_CONF_TIMING && EMUNIT_CONF_BENCH_BASELINE) || defined(__DOXYGEN__)
+/**
+ * @brief Baseline of the current benchmark
+ *
+ * Set by the test and cleared when the next test case begins.
+ */
+static emunit_bench_t pctest_bench_baseline;
+
+/** Set if @ref pctest_bench_baseline is valid */
+static bool pctest_bench_baseline_valid;
+#endif
 
 /** The test case name used if no test case has been started */
 static const char pctest_tc_before_name[] = "BEFORE ANY CASE";
@@ -141,6 +281,358 @@ static char const * emunit_pctest_current_tc_name(void)
 	return emunit_tc_name_get(sidx, idx);
 }
 
+/**
+ * @brief Calculate pattern string hash
+ *
+ * FNV-1a hash function.
+ *
+ * @param[in] p_str The string to be hashed.
+ * @return Hash value.
+ */
+static uint32_t pctest_re_hash(char const * p_str)
+{
+	uint32_t hash = 2166136261U;
+	while('\0' != *p_str)
+	{
+		hash ^= (uint8_t)*p_str++;
+		hash *= 16777619U;
+	}
+	return hash;
+}
+
+/**
+ * @brief Get compiled pattern
+ *
+ * Searches the cache for the pattern and compiles it only if it is not found.
+ *
+ * @param[in] pattern The string with the pattern.
+ * @return Compiled pattern.
+ */
+static pctest_re_entry_t const * pctest_re_cache_get(char const * pattern)
+{
+	uint32_t hash = pctest_re_hash(pattern);
+	pctest_re_entry_t ** pp_bucket = &pctest_re_cache[hash & (PCTEST_RE_CACHE_SIZE - 1U)];
+	pctest_re_entry_t * p_entry;
+	size_t len;
+	int ret;
+
+	for(p_entry = *pp_bucket; NULL != p_entry; p_entry = p_entry->p_next)
+	{
+		if((hash == p_entry->hash) && (0 == strcmp(p_entry->str_re, pattern)))
+			return p_entry;
+	}
+
+	len = strlen(pattern);
+	p_entry = malloc(sizeof(*p_entry) + len + 1U);
+	EMUNIT_IASSERT_MSG(NULL != p_entry, "Cannot allocate pattern");
+	ret = regcomp(&p_entry->re, pattern, REG_EXTENDED | REG_NOSUB);
+	if(0 != ret)
+	{
+		char err_str[512];
+		(void)regerror(ret, &p_entry->re, err_str, sizeof(err_str));
+		fprintf(stderr, "Cannot compile reqular expression (%d): %s.\n", ret, err_str);
+		free(p_entry);
+		EMUNIT_IASSERT_MSG(false, "Cannot compile regular expression");
+	}
+	memcpy(p_entry->str_re, pattern, len + 1U);
+	p_entry->hash = hash;
+	p_entry->p_next = *pp_bucket;
+	*pp_bucket = p_entry;
+	return p_entry;
+}
+
+/**
+ * @brief Free all compiled patterns
+ */
+static void pctest_re_cache_free(void)
+{
+	size_t n;
+	for(n = 0; n < PCTEST_RE_CACHE_SIZE; ++n)
+	{
+		pctest_re_entry_t * p_entry = pctest_re_cache[n];
+		while(NULL != p_entry)
+		{
+			pctest_re_entry_t * p_next = p_entry->p_next;
+			regfree(&p_entry->re);
+			free(p_entry);
+			p_entry = p_next;
+		}
+		pctest_re_cache[n] = NULL;
+	}
+}
+
+/**
+ * @brief Calculate data hash
+ *
+ * 64 bit FNV-1a hash function.
+ *
+ * @param[in] p_data Data to be hashed.
+ * @param[in] len    Data length.
+ * @return Hash value.
+ */
+static uint64_t pctest_data_hash(char const * p_data, size_t len)
+{
+	uint64_t hash = 14695981039346656037ULL;
+	while(0U != len--)
+	{
+		hash ^= (uint8_t)*p_data++;
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+/**
+ * @brief Fatal golden file error
+ *
+ * Prints the error with the system error description and exits.
+ *
+ * @param[in] p_msg Error description.
+ */
+static void pctest_golden_fatal(char const * p_msg)
+{
+	fprintf(stderr, "Golden file %s: %s", pctest_golden.p_file, p_msg);
+	if(0 != errno)
+		fprintf(stderr, " (%s)", strerror(errno));
+	fputs("\n", stderr);
+	exit(-1);
+}
+
+/**
+ * @brief Append data to the golden data area
+ *
+ * @param[in] p_data Data to be appended.
+ * @param[in] len    Data length.
+ * @return Offset of the data in the data area.
+ */
+static uint32_t pctest_golden_data_append(char const * p_data, size_t len)
+{
+	size_t offset = pctest_golden.data_size;
+	if(offset + len > pctest_golden.data_capacity)
+	{
+		size_t capacity = 2U * pctest_golden.data_capacity + len + 4096U;
+		char * p_new = realloc(pctest_golden.p_data, capacity);
+		if(NULL == p_new)
+			pctest_golden_fatal("cannot allocate the memory");
+		pctest_golden.p_data = p_new;
+		pctest_golden.data_capacity = capacity;
+	}
+	memcpy(pctest_golden.p_data + offset, p_data, len);
+	pctest_golden.data_size += len;
+	return (uint32_t)offset;
+}
+
+/**
+ * @brief Normalise the output
+ *
+ * Replaces every number inside the run dependent elements by single 0.
+ * The element may continue in the next output.
+ *
+ * @param[in] p_str Output data.
+ * @param[in] len   Output data length.
+ * @return Normalised output length, the data is placed in the normalised output buffer.
+ */
+static size_t pctest_golden_normalize(char const * p_str, size_t len)
+{
+	size_t n = 0;
+	size_t out = 0;
+	if(len > pctest_golden.norm_capacity)
+	{
+		char * p_new = realloc(pctest_golden.p_norm, len);
+		if(NULL == p_new)
+			pctest_golden_fatal("cannot allocate the memory");
+		pctest_golden.p_norm = p_new;
+		pctest_golden.norm_capacity = len;
+	}
+	while(n < len)
+	{
+		if(NULL == pctest_golden.p_norm_end)
+		{
+			size_t i;
+			for(i = 0; i < sizeof(pctest_golden_volatile) / sizeof(pctest_golden_volatile[0]); ++i)
+			{
+				size_t begin_len = strlen(pctest_golden_volatile[i].p_begin);
+				if((len - n >= begin_len) && (0 == memcmp(p_str + n, pctest_golden_volatile[i].p_begin, begin_len)))
+				{
+					memcpy(pctest_golden.p_norm + out, p_str + n, begin_len);
+					out += begin_len;
+					n   += begin_len;
+					pctest_golden.p_norm_end = pctest_golden_volatile[i].p_end;
+					break;
+				}
+			}
+			if(NULL == pctest_golden.p_norm_end)
+			{
+				pctest_golden.p_norm[out++] = p_str[n++];
+			}
+		}
+		else if((len - n >= strlen(pctest_golden.p_norm_end)) &&
+			(0 == memcmp(p_str + n, pctest_golden.p_norm_end, strlen(pctest_golden.p_norm_end))))
+		{
+			pctest_golden.p_norm_end = NULL;
+		}
+		else if(isdigit((unsigned char)p_str[n]))
+		{
+			pctest_golden.p_norm[out++] = '0';
+			while((n < len) && isdigit((unsigned char)p_str[n]))
+				++n;
+		}
+		else
+		{
+			pctest_golden.p_norm[out++] = p_str[n++];
+		}
+	}
+	return out;
+}
+
+/**
+ * @brief Add the output record
+ *
+ * @param[in] p_key    Record key.
+ * @param[in] key_hash Key hash.
+ * @param[in] p_str    Output data.
+ * @param[in] len      Output data length.
+ */
+static void pctest_golden_record(char const * p_key, uint32_t key_hash, char const * p_str, size_t len)
+{
+	pctest_golden_idx_t * p_idx;
+	size_t key_len = strlen(p_key);
+	if(pctest_golden.count >= pctest_golden.idx_capacity)
+	{
+		size_t capacity = 2U * pctest_golden.idx_capacity + 64U;
+		pctest_golden_idx_t * p_new = realloc(pctest_golden.p_idx, capacity * sizeof(*p_new));
+		if(NULL == p_new)
+			pctest_golden_fatal("cannot allocate the memory");
+		pctest_golden.p_idx = p_new;
+		pctest_golden.idx_capacity = capacity;
+	}
+	p_idx = &pctest_golden.p_idx[pctest_golden.count++];
+	memset(p_idx, 0, sizeof(*p_idx));
+	p_idx->key_hash    = key_hash;
+	p_idx->key_len     = (uint32_t)key_len;
+	p_idx->key_offset  = pctest_golden_data_append(p_key, key_len);
+	p_idx->data_len    = (uint32_t)len;
+	p_idx->data_offset = pctest_golden_data_append(p_str, len);
+	p_idx->data_hash   = pctest_data_hash(p_str, len);
+}
+
+/**
+ * @brief Find the output record
+ *
+ * @param[in] p_key    Record key.
+ * @param[in] key_hash Key hash.
+ * @return Found index entry or NULL if there is no record for given key.
+ */
+static pctest_golden_idx_t const * pctest_golden_find(char const * p_key, uint32_t key_hash)
+{
+	size_t key_len = strlen(p_key);
+	size_t n = key_hash & (pctest_golden.table_size - 1U);
+	while(0U != pctest_golden.p_table[n])
+	{
+		pctest_golden_idx_t const * p_idx = &pctest_golden.p_idx[pctest_golden.p_table[n] - 1U];
+		if((key_hash == p_idx->key_hash) && (key_len == p_idx->key_len) &&
+			(0 == memcmp(pctest_golden.p_data + p_idx->key_offset, p_key, key_len)))
+		{
+			return p_idx;
+		}
+		n = (n + 1U) & (pctest_golden.table_size - 1U);
+	}
+	return NULL;
+}
+
+/**
+ * @brief Load the golden file
+ *
+ * Reads the whole file and builds the lookup table.
+ */
+static void pctest_golden_load(void)
+{
+	pctest_golden_header_t header;
+	size_t n;
+	long size;
+	FILE * p_f = fopen(pctest_golden.p_file, "rb");
+	if(NULL == p_f)
+		pctest_golden_fatal("cannot open");
+	if((1U != fread(&header, sizeof(header), 1, p_f)) ||
+		(0 != memcmp(header.magic, PCTEST_GOLDEN_MAGIC, sizeof(header.magic))))
+	{
+		errno = 0;
+		pctest_golden_fatal("wrong file format");
+	}
+	pctest_golden.count = header.count;
+	if((0 != fseek(p_f, 0, SEEK_END)) || ((size = ftell(p_f)) < 0))
+		pctest_golden_fatal("cannot read");
+	if((size_t)size < sizeof(header) + pctest_golden.count * sizeof(pctest_golden_idx_t))
+	{
+		errno = 0;
+		pctest_golden_fatal("file truncated");
+	}
+	pctest_golden.p_idx = malloc((pctest_golden.count + 1U) * sizeof(pctest_golden_idx_t));
+	pctest_golden.p_reached = calloc(pctest_golden.count + 1U, sizeof(bool));
+	pctest_golden.data_size = (size_t)size - sizeof(header) - pctest_golden.count * sizeof(pctest_golden_idx_t);
+	pctest_golden.p_data = malloc(pctest_golden.data_size + 1U);
+	if((NULL == pctest_golden.p_idx) || (NULL == pctest_golden.p_data) || (NULL == pctest_golden.p_reached))
+		pctest_golden_fatal("cannot allocate the memory");
+	errno = 0;
+	if((0 != fseek(p_f, sizeof(header), SEEK_SET)) ||
+		(pctest_golden.count != fread(pctest_golden.p_idx, sizeof(pctest_golden_idx_t), pctest_golden.count, p_f)) ||
+		(pctest_golden.data_size != fread(pctest_golden.p_data, 1, pctest_golden.data_size, p_f)))
+	{
+		pctest_golden_fatal("cannot read");
+	}
+	fclose(p_f);
+
+	pctest_golden.table_size = 64U;
+	while(pctest_golden.table_size < 2U * pctest_golden.count)
+		pctest_golden.table_size *= 2U;
+	pctest_golden.p_table = calloc(pctest_golden.table_size, sizeof(uint32_t));
+	if(NULL == pctest_golden.p_table)
+		pctest_golden_fatal("cannot allocate the memory");
+	for(n = 0; n < pctest_golden.count; ++n)
+	{
+		pctest_golden_idx_t const * p_idx = &pctest_golden.p_idx[n];
+		size_t pos = p_idx->key_hash & (pctest_golden.table_size - 1U);
+		if(((size_t)p_idx->key_offset + p_idx->key_len > pctest_golden.data_size) ||
+			((size_t)p_idx->data_offset + p_idx->data_len > pctest_golden.data_size))
+		{
+			errno = 0;
+			pctest_golden_fatal("index out of the data area");
+		}
+		while(0U != pctest_golden.p_table[pos])
+			pos = (pos + 1U) & (pctest_golden.table_size - 1U);
+		pctest_golden.p_table[pos] = (uint32_t)(n + 1U);
+	}
+}
+
+/**
+ * @brief Write the recorded golden file and free all the golden data
+ */
+static void pctest_golden_finish(void)
+{
+	if(PCTEST_GOLDEN_RECORD == pctest_golden.mode)
+	{
+		pctest_golden_header_t header;
+		FILE * p_f = fopen(pctest_golden.p_file, "wb");
+		if(NULL == p_f)
+			pctest_golden_fatal("cannot create");
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, PCTEST_GOLDEN_MAGIC, sizeof(header.magic));
+		header.count = (uint32_t)pctest_golden.count;
+		if((1U != fwrite(&header, sizeof(header), 1, p_f)) ||
+			(pctest_golden.count != fwrite(pctest_golden.p_idx, sizeof(pctest_golden_idx_t), pctest_golden.count, p_f)) ||
+			(pctest_golden.data_size != fwrite(pctest_golden.p_data, 1, pctest_golden.data_size, p_f)) ||
+			(0 != fclose(p_f)))
+		{
+			pctest_golden_fatal("cannot write");
+		}
+		printf("Golden records written: %u\n", (unsigned int)pctest_golden.count);
+	}
+	free(pctest_golden.p_idx);
+	free(pctest_golden.p_data);
+	free(pctest_golden.p_table);
+	free(pctest_golden.p_norm);
+	free(pctest_golden.p_reached);
+}
+
 /**
  * @brief Set the pattern
  *
@@ -152,19 +644,10 @@ static char const * emunit_pctest_current_tc_name(void)
  */
 static void emunit_pctest_pattern_set(pctest_pattern_t * p_dst, char const * pattern)
 {
-	int ret;
 	EMUNIT_IASSERT_MSG(EMUNIT_TEST_PATTERN_MAX > strlen(pattern), "Pattern string too long");
 	EMUNIT_IASSERT_MSG(!p_dst->ready, "Pattern already set");
 
-	ret = regcomp(&p_dst->re, pattern, REG_EXTENDED | REG_NOSUB);
-	if(0 != ret)
-	{
-		char err_str[512];
-		(void)regerror(ret, &p_dst->re, err_str, sizeof(err_str));
-		fprintf(stderr, "Cannot compile reqular expression (%d): %s.\n", ret, err_str);
-		EMUNIT_IASSERT_MSG(false, "Cannot compile regular expression");
-	}
-	strcpy(p_dst->str_re, pattern);
+	p_dst->p_re = pctest_re_cache_get(pattern);
 	p_dst->ready = true;
 }
 
@@ -180,7 +663,7 @@ static void emunit_pctest_pattern_set(pctest_pattern_t * p_dst, char const * pat
 static bool emunit_pctest_pattern_check(pctest_pattern_t const * p_pattern, char const * p_val)
 {
 	int match_ret;
-	match_ret = regexec(&p_pattern->re, p_val, 0, NULL, REG_NOSUB);
+	match_ret = regexec(&p_pattern->p_re->re, p_val, 0, NULL, REG_NOSUB);
 	return (0 == match_ret);
 }
 
@@ -227,6 +710,126 @@ static void pctest_success(void)
 	++pctest_passed;
 }
 
+/**
+ * @brief Check the output using the golden file
+ *
+ * In record mode the output is written into the golden file and
+ * it still has to be checked against the pattern.
+ * In compare mode the output is compared with the recorded one if it exists.
+ * The hash is compared first, the data is compared byte by byte only to
+ * find the place of the mismatch.
+ * The output is normalised first, see @ref pctest_golden_volatile.
+ *
+ * @param[in] p_str Output data.
+ * @param[in] len   Output data length.
+ *
+ * @retval true  The output was checked against the golden file.
+ * @retval false The output has to be checked against the pattern.
+ */
+static bool pctest_golden_check(char const * p_str, size_t len)
+{
+	char key[PCTEST_GOLDEN_KEY_MAX];
+	uint32_t key_hash;
+	pctest_golden_idx_t const * p_idx;
+
+	if(PCTEST_GOLDEN_OFF == pctest_golden.mode)
+		return false;
+
+	/* Key: suite and case names with the output number in the case */
+	(void)snprintf(key, sizeof(key), "%s\n%s\n",
+		emunit_pctest_current_ts_name(),
+		emunit_pctest_current_tc_name());
+	if(0 == strcmp(key, pctest_golden.last_key))
+	{
+		++pctest_golden.seq;
+	}
+	else
+	{
+		strcpy(pctest_golden.last_key, key);
+		pctest_golden.seq = 0;
+	}
+	(void)snprintf(key + strlen(key), sizeof(key) - strlen(key), "%u", pctest_golden.seq);
+	key_hash = pctest_re_hash(key);
+	len   = pctest_golden_normalize(p_str, len);
+	p_str = pctest_golden.p_norm;
+
+	if(PCTEST_GOLDEN_RECORD == pctest_golden.mode)
+	{
+		pctest_golden_record(key, key_hash, p_str, len);
+		return false;
+	}
+
+	p_idx = pctest_golden_find(key, key_hash);
+	if(NULL == p_idx)
+		return false;
+	pctest_golden.p_reached[p_idx - pctest_golden.p_idx] = true;
+	if((len == p_idx->data_len) && (pctest_data_hash(p_str, len) == p_idx->data_hash))
+	{
+		pctest_success();
+	}
+	else
+	{
+		char const * p_golden = pctest_golden.p_data + p_idx->data_offset;
+		size_t n = 0;
+		while((n < len) && (n < p_idx->data_len) && (p_str[n] == p_golden[n]))
+			++n;
+		pctest_error(
+			"Output does not match the golden file at offset %u\n"
+			"    Golden:\n"
+			"    ------------------------\n"
+			"%.*s\n"
+			"    ------------------------\n"
+			"    Output:\n"
+			"    ------------------------\n"
+			"%.*s\n"
+			"    ------------------------\n",
+			(unsigned int)n,
+			(int)p_idx->data_len,
+			p_golden,
+			(int)len,
+			p_str);
+	}
+	return true;
+}
+
+/**
+ * @brief Report the golden records that have not been compared
+ *
+ * Every record that has no matching output in compare mode is an error:
+ * the output that was recorded is missing now.
+ */
+static void pctest_golden_unreached_check(void)
+{
+	size_t n;
+	if(PCTEST_GOLDEN_COMPARE != pctest_golden.mode)
+		return;
+	fflush(stdout);
+	for(n = 0; n < pctest_golden.count; ++n)
+	{
+		pctest_golden_idx_t const * p_idx = &pctest_golden.p_idx[n];
+		char const * p_key = pctest_golden.p_data + p_idx->key_offset;
+		char const * p_case;
+		char const * p_seq;
+		if(pctest_golden.p_reached[n])
+			continue;
+		/* Key: suite and case names with the output number in the case */
+		p_case = memchr(p_key, '\n', p_idx->key_len);
+		p_seq  = (NULL == p_case) ? NULL : memchr(p_case + 1, '\n', p_idx->key_len - (size_t)(p_case + 1 - p_key));
+		if(NULL == p_seq)
+		{
+			fprintf(stderr, "Golden record %u: wrong key\n", (unsigned int)n);
+		}
+		else
+		{
+			fprintf(stderr, "[%.*s][%.*s] ERROR: Golden output %.*s not written\n",
+				(int)(p_case - p_key), p_key,
+				(int)(p_seq - p_case - 1), p_case + 1,
+				(int)(p_idx->key_len - (size_t)(p_seq + 1 - p_key)), p_seq + 1);
+		}
+		++pctest_failed;
+	}
+}
+
 /**
  * @brief Summarise the whole test
  *
@@ -237,6 +840,7 @@ static void pctest_bill(void)
 	puts("");
 	puts("----------------------------------------");
 	puts("Test finished");
+	pctest_golden_unreached_check();
 
 	printf(
 		"Success: %u\n"
@@ -248,6 +852,9 @@ static void pctest_bill(void)
 	{
 		puts("All tests passed");
 	}
+
+	pctest_re_cache_free();
+	pctest_golden_finish();
 }
 
 char const * emunit_pctest_regex_esc(char * const p_dst, char const * p_src)
@@ -288,6 +895,17 @@ void emunit_pctest_expected_set(char const * p_str)
 	emunit_pctest_pattern_set(&pctest_expected_test_output, p_str);
 }
 
+#if (EMUNIT_CONF_TIMING && EMUNIT_CONF_BENCH_BASELINE) || defined(__DOXYGEN__)
+void emunit_pctest_bench_baseline_set(emunit_bench_t const * p_baseline)
+{
+	pctest_bench_baseline_valid = (NULL != p_baseline);
+	if(pctest_bench_baseline_valid)
+	{
+		pctest_bench_baseline = *p_baseline;
+	}
+}
+#endif
+
 void emunit_port_pctest_out_init(void)
 {
 }
@@ -301,6 +919,11 @@ void emunit_port_pctest_out_write(char const * p_str, size_t len)
 	/* Select the pattern */
 	pctest_pattern_t * p_pattern;
 	size_t sidx = emunit_ts_current_index_get();
+	if(0U != pctest_out_stream)
+	{
+		/* Patterns are given only for the first display */
+		return;
+	}
 	if((sidx == EMUNIT_IDX_INVALID) || (sidx < emunit_ts_total_count()))
 	{
 		p_pattern = &pctest_expected_test_output;
@@ -310,8 +933,13 @@ void emunit_port_pctest_out_write(char const * p_str, size_t len)
 		p_pattern = &pctest_expected_footer;
 	}
 
+	if(pctest_golden_check(p_str, len))
+	{
+		/* Output checked against the golden file, the pattern is not used */
+		p_pattern->ready = false;
+	}
 	/* Check against pattern */
-	if(p_pattern->ready)
+	else if(p_pattern->ready)
 	{
 		p_pattern->ready = false;
 		if(len != strlen(p_str))
@@ -330,7 +958,7 @@ void emunit_port_pctest_out_write(char const * p_str, size_t len)
 					"    ------------------------\n"
 					"%s\n"
 					"    ------------------------\n",
-					p_pattern->str_re,
+					p_pattern->p_re->str_re,
 					p_str);
 			else
 				pctest_success();
@@ -348,6 +976,17 @@ void emunit_port_pctest_out_write(char const * p_str, size_t len)
 	}
 }
 
+void emunit_port_pctest_out_wait(void)
+{
+	/* Output is synchronous - just send everything that is waiting */
+	emunit_flush();
+}
+
+void emunit_port_pctest_out_select(uint8_t stream)
+{
+	pctest_out_stream = stream;
+}
+
 void emunit_port_pctest_early_init(emunit_status_key_t * p_valid_key)
 {
 	pctest_failed = 0;
@@ -371,7 +1010,9 @@ void emunit_port_pctest_restart(void)
 
 void emunit_port_pctest_tc_begin(void)
 {
-
+#if EMUNIT_CONF_TIMING && EMUNIT_CONF_BENCH_BASELINE
+	pctest_bench_baseline_valid = false;
+#endif
 }
 
 void emunit_port_pctest_tc_end(void)
@@ -379,11 +1020,58 @@ void emunit_port_pctest_tc_end(void)
 
 }
 
+bool emunit_port_pctest_ts_selected(size_t suite_idx)
+{
+	(void)suite_idx;
+	return true;
+}
 
-int main(void)
+#if (EMUNIT_CONF_TIMING && EMUNIT_CONF_BENCH_BASELINE) || defined(__DOXYGEN__)
+bool emunit_port_pctest_bench_baseline(emunit_bench_t * p_baseline)
+{
+	if(pctest_bench_baseline_valid)
+	{
+		*p_baseline = pctest_bench_baseline;
+	}
+	return pctest_bench_baseline_valid;
+}
+#endif
+
+
+/**
+ * @brief Program entry point
+ *
+ * Optional arguments select the golden file mode:
+ * `record <file>` or `compare <file>`.
+ *
+ * @param argc Number of arguments
+ * @param argv Arguments
+ * @return Number of tests failed
+ */
+int main(int argc, char * argv[])
 {
 	int ret;
 
+	if(3 == argc && 0 == strcmp(argv[1], "record"))
+	{
+		pctest_golden.mode = PCTEST_GOLDEN_RECORD;
+	}
+	else if(3 == argc && 0 == strcmp(argv[1], "compare"))
+	{
+		pctest_golden.mode = PCTEST_GOLDEN_COMPARE;
+	}
+	else if(1 != argc)
+	{
+		fprintf(stderr, "Usage: %s [record|compare <golden file>]\n", argv[0]);
+		return -1;
+	}
+	if(PCTEST_GOLDEN_OFF != pctest_golden.mode)
+	{
+		pctest_golden.p_file = argv[2];
+		if(PCTEST_GOLDEN_COMPARE == pctest_golden.mode)
+			pctest_golden_load();
+	}
+
 	/* Set long jmp temporary here is anything fails during initialisation */
 	if(0 == setjmp(pctest_test_loop_jmp))
 	{
@@ -46,6 +46,16 @@
  *
  * The port expects specific output for the test and fails only if the
  * output does not match.
+ *
+ * The output may also be checked against the golden file.
+ * Run the test with `record <file>` arguments to write every output
+ * into the golden file and with `compare <file>` arguments to check
+ * the output against it.
+ * In compare mode the regular expression is used only for the output
+ * that has no record in the golden file
+ * and the record that has no output is an error.
+ * The numbers that change between the runs, like the durations,
+ * are replaced by 0 in the golden file.
  * @{
  */
 
@@ -97,6 +107,19 @@ void emunit_pctest_expected_footer_set(char const * p_str);
  */
 void emunit_pctest_expected_set(char const * p_str);
 
+#if (EMUNIT_CONF_TIMING && EMUNIT_CONF_BENCH_BASELINE) || defined(__DOXYGEN__)
+/**
+ * @brief Set the baseline of the current benchmark
+ *
+ * The baseline is returned to the engine when the current benchmark
+ * is measured, so the test decides if the benchmark regressed.
+ * It is valid only for the current test case.
+ *
+ * @param[in] p_baseline The baseline or NULL if there is no baseline.
+ */
+void emunit_pctest_bench_baseline_set(emunit_bench_t const * p_baseline);
+#endif
+
 /**
  * @defgroup emunit_port_pctest_out_group Output stream functions
  * @{
@@ -111,6 +134,12 @@ void emunit_pctest_expected_set(char const * p_str);
 
 	/** See the @ref emunit_port_out_write documentation */
 	void emunit_port_pctest_out_write(char const * p_str, size_t len);
+
+	/** See the @ref emunit_port_out_wait documentation */
+	void emunit_port_pctest_out_wait(void);
+
+	/** See the @ref emunit_port_out_select documentation */
+	void emunit_port_pctest_out_select(uint8_t stream);
 /** @} */
 
 /** See the @ref emunit_port_first_init documentation */
@@ -125,5 +154,13 @@ void emunit_port_pctest_tc_begin(void);
 /** See the @ref emunit_port_tc_end documentation */
 void emunit_port_pctest_tc_end(void);
 
+/** See the @ref emunit_port_ts_selected documentation */
+bool emunit_port_pctest_ts_selected(size_t suite_idx);
+
+#if (EMUNIT_CONF_TIMING && EMUNIT_CONF_BENCH_BASELINE) || defined(__DOXYGEN__)
+/** See the @ref emunit_port_bench_baseline documentation */
+bool emunit_port_pctest_bench_baseline(emunit_bench_t * p_baseline);
+#endif
+
 /** @} */
 #endif /* EMUNIT_PORT_PCTEST_H_INCLUDED */
@@ -0,0 +1,511 @@
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief EMUnit QEMU ARM port implementation
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * File with EMUnit port for ARM Cortex-M running in qemu-system-arm
+ * @sa emunit_port_qemuarm_group
+ */
+#include "config_emunit_qemuarm.h"
+#include "emunit_port_qemuarm.h"
+#include <emunit_private.h>
+
+/* Variables required by the emunit engine */
+EMUNIT_PORT_REQUIRED_VARIABLES();
+
+/**
+ * @name Registers
+ * @{
+ */
+/** Access 32 bit register */
+#define QEMUARM_REG(addr) (*(volatile uint32_t *)(addr))
+
+/** Application interrupt and reset control register */
+#define QEMUARM_SCB_AIRCR       QEMUARM_REG(0xE000ED0CUL)
+/** The key and the system reset request */
+#define QEMUARM_AIRCR_SYSRESETREQ ((0x05FAUL << 16) | (1UL << 2))
+/** Debug exception and monitor control register */
+#define QEMUARM_DEMCR           QEMUARM_REG(0xE000EDFCUL)
+/** Trace enable, required by DWT */
+#define QEMUARM_DEMCR_TRCENA    (1UL << 24)
+/** DWT control register */
+#define QEMUARM_DWT_CTRL        QEMUARM_REG(0xE0001000UL)
+/** Cycle counter enable */
+#define QEMUARM_DWT_CTRL_CYCCNTENA (1UL << 0)
+/** Cycle counter not implemented */
+#define QEMUARM_DWT_CTRL_NOCYCCNT  (1UL << 25)
+/** DWT cycle counter */
+#define QEMUARM_DWT_CYCCNT      QEMUARM_REG(0xE0001004UL)
+/** SysTick control and status register */
+#define QEMUARM_SYST_CSR        QEMUARM_REG(0xE000E010UL)
+/** SysTick enabled with the interrupt, clocked by the processor clock */
+#define QEMUARM_SYST_CSR_RUN    ((1UL << 0) | (1UL << 1) | (1UL << 2))
+/** SysTick reload value register */
+#define QEMUARM_SYST_RVR        QEMUARM_REG(0xE000E014UL)
+/** SysTick current value register */
+#define QEMUARM_SYST_CVR        QEMUARM_REG(0xE000E018UL)
+/** SysTick counter mask */
+#define QEMUARM_SYST_MASK       0x00FFFFFFUL
+/** UART data register */
+#define QEMUARM_UART_DATA       QEMUARM_REG(EMUNIT_PORT_QEMUARM_UART_BASE + 0x00UL)
+/** UART state register */
+#define QEMUARM_UART_STATE      QEMUARM_REG(EMUNIT_PORT_QEMUARM_UART_BASE + 0x04UL)
+/** UART transmit buffer full */
+#define QEMUARM_UART_STATE_TXFULL (1UL << 0)
+/** UART control register */
+#define QEMUARM_UART_CTRL       QEMUARM_REG(EMUNIT_PORT_QEMUARM_UART_BASE + 0x08UL)
+/** UART transmitter enable */
+#define QEMUARM_UART_CTRL_TXEN  (1UL << 0)
+/** UART baud rate divider */
+#define QEMUARM_UART_BAUDDIV    QEMUARM_REG(EMUNIT_PORT_QEMUARM_UART_BASE + 0x10UL)
+/** @} */
+
+/**
+ * @name Semihosting operations
+ * @{
+ */
+#define QEMUARM_SYS_OPEN          0x01U
+#define QEMUARM_SYS_WRITE         0x05U
+#define QEMUARM_SYS_EXIT          0x18U
+#define QEMUARM_SYS_EXIT_EXTENDED 0x20U
+/** SYS_OPEN mode "w" */
+#define QEMUARM_OPEN_W            4U
+/** The reason of the exit: application finished */
+#define QEMUARM_ADP_STOPPED_APPLICATION_EXIT 0x20026UL
+/** @} */
+
+/**
+ * @brief The value of the reset mark that marks the restart requested by the port
+ */
+#define QEMUARM_RESET_MARK 0x454d5552UL
+
+/**
+ * @brief Port state retained during the restart
+ */
+typedef struct
+{
+	/** Set to @ref QEMUARM_RESET_MARK just before the restart */
+	uint32_t reset_mark;
+	/** Semihosting handles of the output streams, -1 if not opened */
+	int32_t  streams[EMUNIT_DISPLAY_MULTI_MAX];
+	/** Semihosting handle of the cycles file, -1 if not opened */
+	int32_t  cycles;
+}qemuarm_retained_t;
+
+/**
+ * @brief Retained port state
+ *
+ * The semihosting handles are kept by the host during the restart,
+ * so every file is opened only once.
+ */
+static EMUNIT_NOINIT_VAR(qemuarm_retained_t, qemuarm_retained);
+
+/**
+ * @brief Port state cleared at every restart
+ */
+static struct
+{
+	uint8_t  stream;       /**< Currently selected stream */
+	bool     timer_ready;  /**< Cycle counter is initialised */
+	bool     dwt;          /**< DWT cycle counter is used */
+	volatile uint32_t systick_wraps; /**< SysTick wraps, if SysTick is used */
+	uint32_t tc_start;     /**< Cycle counter at the test case begin */
+}qemuarm;
+
+/**
+ * @name Linker script symbols
+ * @{
+ */
+extern uint32_t __stack_top;
+extern uint32_t __data_load;
+extern uint32_t __data_start;
+extern uint32_t __data_end;
+extern uint32_t __bss_start;
+extern uint32_t __bss_end;
+/** @} */
+
+int main(void);
+
+/**
+ * @brief Call semihosting operation
+ *
+ * Auxiliary internal function.
+ *
+ * @param op    Operation
+ * @param p_arg Operation argument block
+ * @return Operation result
+ */
+static inline int32_t qemuarm_semihost(uint32_t op, void const * p_arg)
+{
+	register uint32_t r0 __asm__("r0") = op;
+	register void const * r1 __asm__("r1") = p_arg;
+	__asm__ __volatile__ ("bkpt 0xab" : "+r" (r0) : "r" (r1) : "memory");
+	return (int32_t)r0;
+}
+
+/**
+ * @brief Open host file
+ *
+ * Auxiliary internal function.
+ *
+ * @param p_name File name, ":tt" for the host console
+ * @return File handle or -1 on error
+ */
+static int32_t qemuarm_open(char const * p_name)
+{
+	uint32_t const arg[3] = {(uint32_t)p_name, QEMUARM_OPEN_W, (uint32_t)strlen(p_name)};
+	return qemuarm_semihost(QEMUARM_SYS_OPEN, arg);
+}
+
+/**
+ * @brief Write to the host file
+ *
+ * Auxiliary internal function.
+ *
+ * @param handle File handle
+ * @param p_str  Data to write
+ * @param len    Data length
+ */
+static void qemuarm_write(int32_t handle, char const * p_str, size_t len)
+{
+	uint32_t const arg[3] = {(uint32_t)handle, (uint32_t)p_str, (uint32_t)len};
+	if(handle >= 0)
+	{
+		(void)qemuarm_semihost(QEMUARM_SYS_WRITE, arg);
+	}
+}
+
+/**
+ * @brief Finish the emulation
+ *
+ * Auxiliary internal function.
+ *
+ * @param ret The value returned to the host
+ */
+static void __attribute__ ((noreturn)) qemuarm_exit(int ret)
+{
+	uint32_t const arg[2] = {QEMUARM_ADP_STOPPED_APPLICATION_EXIT, (uint32_t)ret};
+	(void)qemuarm_semihost(QEMUARM_SYS_EXIT_EXTENDED, arg);
+	/* Host without the extended exit: the return value is lost */
+	(void)qemuarm_semihost(QEMUARM_SYS_EXIT, (void const *)QEMUARM_ADP_STOPPED_APPLICATION_EXIT);
+	while(1)
+	{
+		/* Should never get here */
+	}
+}
+
+/**
+ * @brief Initialise the cycle counter
+ *
+ * Auxiliary internal function.
+ * Uses DWT cycle counter if it is implemented and counting,
+ * free running SysTick otherwise.
+ */
+static void qemuarm_timer_init(void)
+{
+	QEMUARM_DEMCR |= QEMUARM_DEMCR_TRCENA;
+	if(0U == (QEMUARM_DWT_CTRL & QEMUARM_DWT_CTRL_NOCYCCNT))
+	{
+		uint32_t start;
+		QEMUARM_DWT_CTRL |= QEMUARM_DWT_CTRL_CYCCNTENA;
+		start = QEMUARM_DWT_CYCCNT;
+		__asm__ __volatile__ ("nop\n nop\n nop\n nop");
+		qemuarm.dwt = (start != QEMUARM_DWT_CYCCNT);
+	}
+	if(!qemuarm.dwt)
+	{
+		QEMUARM_SYST_RVR = QEMUARM_SYST_MASK;
+		QEMUARM_SYST_CVR = 0;
+		QEMUARM_SYST_CSR = QEMUARM_SYST_CSR_RUN;
+	}
+	qemuarm.timer_ready = true;
+}
+
+/**
+ * @brief Read the cycle counter
+ *
+ * Auxiliary internal function.
+ *
+ * @return Cycle counter value, wraps at 32 bits
+ */
+static uint32_t qemuarm_cycles(void)
+{
+	uint32_t wraps;
+	uint32_t value;
+	if(qemuarm.dwt)
+	{
+		return QEMUARM_DWT_CYCCNT;
+	}
+	do
+	{
+		wraps = qemuarm.systick_wraps;
+		value = QEMUARM_SYST_CVR;
+	}while(wraps != qemuarm.systick_wraps);
+	return (wraps << 24) + (QEMUARM_SYST_MASK - value);
+}
+
+/**
+ * @brief Put single character to the UART
+ *
+ * Auxiliary internal function.
+ *
+ * @param c Character to be sent
+ */
+static inline void qemuarm_uart_putc(char c)
+{
+	while(0U != (QEMUARM_UART_STATE & QEMUARM_UART_STATE_TXFULL))
+	{
+		/* Waiting for the place in the transmitter */
+	}
+	QEMUARM_UART_DATA = (uint8_t)c;
+}
+
+
+void emunit_port_qemuarm_out_init(void)
+{
+#if EMUNIT_PORT_QEMUARM_OUT == EMUNIT_PORT_QEMUARM_OUT_UART
+	QEMUARM_UART_BAUDDIV = 16U;
+	QEMUARM_UART_CTRL |= QEMUARM_UART_CTRL_TXEN;
+#else
+	if(qemuarm_retained.streams[0] < 0)
+	{
+		qemuarm_retained.streams[0] = qemuarm_open(":tt");
+	}
+#endif
+}
+
+void emunit_port_qemuarm_out_deinit(void)
+{
+}
+
+void emunit_port_qemuarm_out_write(char const * p_str, size_t len)
+{
+#if EMUNIT_PORT_QEMUARM_OUT == EMUNIT_PORT_QEMUARM_OUT_UART
+	while(0U != len--)
+	{
+		qemuarm_uart_putc(*(p_str++));
+	}
+#else
+	qemuarm_write(qemuarm_retained.streams[qemuarm.stream], p_str, len);
+#endif
+}
+
+void emunit_port_qemuarm_out_wait(void)
+{
+	/* Output is synchronous - just send everything that is waiting */
+	emunit_flush();
+}
+
+void emunit_port_qemuarm_out_select(uint8_t stream)
+{
+#if EMUNIT_PORT_QEMUARM_OUT == EMUNIT_PORT_QEMUARM_OUT_UART
+	/* There is only one serial line: mark the stream change in the output */
+	qemuarm_uart_putc(EMUNIT_PORT_QEMUARM_STREAM_MARK);
+	qemuarm_uart_putc((char)('0' + stream));
+#else
+	EMUNIT_IASSERT(stream < EMUNIT_DISPLAY_MULTI_MAX);
+	if(qemuarm_retained.streams[stream] < 0)
+	{
+		char name[32];
+		snprintf(name, sizeof(name), EMUNIT_PORT_QEMUARM_STREAM_FILE, (unsigned int)stream);
+		qemuarm_retained.streams[stream] = qemuarm_open(name);
+	}
+	qemuarm.stream = stream;
+#endif
+}
+
+void emunit_port_qemuarm_early_init(emunit_status_key_t * p_valid_key)
+{
+	if(QEMUARM_RESET_MARK != qemuarm_retained.reset_mark)
+	{
+		/* Power on reset (invalidate status structure) */
+		size_t n;
+		*p_valid_key = EMUNIT_STATUS_KEY_INVALID;
+		for(n = 0; n < EMUNIT_DISPLAY_MULTI_MAX; ++n)
+		{
+			qemuarm_retained.streams[n] = -1;
+		}
+		qemuarm_retained.cycles = -1;
+	}
+	qemuarm_retained.reset_mark = 0;
+}
+
+void emunit_port_qemuarm_restart(void)
+{
+	qemuarm_retained.reset_mark = QEMUARM_RESET_MARK;
+	__asm__ __volatile__ ("dsb" ::: "memory");
+	QEMUARM_SCB_AIRCR = QEMUARM_AIRCR_SYSRESETREQ;
+	__asm__ __volatile__ ("dsb" ::: "memory");
+	while(1)
+	{
+		/* Waiting for reset */
+	}
+}
+
+void emunit_port_qemuarm_tc_begin(void)
+{
+	emunit_arch_timestamp_init();
+	qemuarm.tc_start = qemuarm_cycles();
+}
+
+void emunit_port_qemuarm_tc_end(void)
+{
+	uint32_t cycles = qemuarm_cycles() - qemuarm.tc_start;
+	char line[128];
+	int len;
+
+	if('\0' == EMUNIT_PORT_QEMUARM_CYCLES_FILE[0])
+	{
+		return;
+	}
+	if(qemuarm_retained.cycles < 0)
+	{
+		static const char header[] = "suite,case,cycles\n";
+		qemuarm_retained.cycles = qemuarm_open(EMUNIT_PORT_QEMUARM_CYCLES_FILE);
+		qemuarm_write(qemuarm_retained.cycles, header, sizeof(header) - 1U);
+	}
+	len = snprintf(line, sizeof(line), "%" PRIsPGM ",%" PRIsPGM ",%lu\n",
+		emunit_ts_name_get(emunit_ts_current_index_get()),
+		emunit_tc_name_get(emunit_ts_current_index_get(), emunit_tc_current_index_get()),
+		(unsigned long)cycles);
+	if(len > 0)
+	{
+		qemuarm_write(qemuarm_retained.cycles, line, EMUNIT_MIN((size_t)len, sizeof(line) - 1U));
+	}
+}
+
+bool emunit_port_qemuarm_ts_selected(size_t suite_idx)
+{
+	(void)suite_idx;
+	return true;
+}
+
+#if EMUNIT_CONF_TIMING && EMUNIT_CONF_BENCH_BASELINE
+bool emunit_port_qemuarm_bench_baseline(emunit_bench_t * p_baseline)
+{
+	/* The results are compared with the baseline by the host tool */
+	(void)p_baseline;
+	return false;
+}
+#endif
+
+
+void emunit_arch_timestamp_init(void)
+{
+	if(!qemuarm.timer_ready)
+	{
+		qemuarm_timer_init();
+	}
+}
+
+emunit_timestamp_t emunit_arch_timestamp(void)
+{
+	return qemuarm_cycles();
+}
+
+
+int main(void)
+{
+	emunit_flush();
+	return emunit_run();
+}
+
+/**
+ * @brief Reset handler
+ *
+ * Initialises .data and .bss sections, the .noinit section is left untouched.
+ */
+void qemuarm_reset_handler(void) __attribute__ ((noreturn));
+
+void qemuarm_reset_handler(void)
+{
+	uint32_t const * p_src = &__data_load;
+	uint32_t * p_dst;
+
+	for(p_dst = &__data_start; p_dst < &__data_end; )
+	{
+		*p_dst++ = *p_src++;
+	}
+	for(p_dst = &__bss_start; p_dst < &__bss_end; )
+	{
+		*p_dst++ = 0;
+	}
+	emunit_early_init();
+	qemuarm_exit(main());
+}
+
+/**
+ * @brief Fault handler
+ *
+ * The fault inside the test case restarts the test,
+ * that reports the test case as interrupted.
+ * Any other fault finishes the test with an error.
+ */
+void qemuarm_fault_handler(void)
+{
+	if(EMUNIT_RR_TIMEOUT == emunit_status.rr)
+	{
+		emunit_port_qemuarm_restart();
+	}
+	qemuarm_exit(-1);
+}
+
+/**
+ * @brief SysTick handler
+ *
+ * Counts the SysTick wraps when SysTick is used as the cycle counter.
+ */
+void qemuarm_systick_handler(void)
+{
+	++qemuarm.systick_wraps;
+}
+
+/** Exception handler type */
+typedef void (*qemuarm_vector_t)(void);
+
+/**
+ * @brief System exceptions vector table
+ *
+ * Placed at the beginning of the flash by the linker script.
+ */
+const qemuarm_vector_t qemuarm_vectors[16] __attribute__ ((section(".isr_vector"), used)) =
+{
+	(qemuarm_vector_t)&__stack_top,
+	qemuarm_reset_handler,
+	qemuarm_fault_handler, /* NMI */
+	qemuarm_fault_handler, /* HardFault */
+	qemuarm_fault_handler, /* MemManage */
+	qemuarm_fault_handler, /* BusFault */
+	qemuarm_fault_handler, /* UsageFault */
+	NULL,
+	NULL,
+	NULL,
+	NULL,
+	qemuarm_fault_handler, /* SVCall */
+	qemuarm_fault_handler, /* DebugMonitor */
+	NULL,
+	qemuarm_fault_handler, /* PendSV */
+	qemuarm_systick_handler
+};
@@ -33,12 +33,160 @@
 #include <emunit_private.h>
 #include <avr/io.h>
 #include <avr/wdt.h>
+#include <avr/interrupt.h>
 #include "emunit_port_simavr_mmcu.c"
+#include "emunit_port_simavr_host.h"
 
 
 /* Variables required by the emunit engine */
 EMUNIT_PORT_REQUIRED_VARIABLES();
 
+#if EMUNIT_PORT_SIMAVR_HOST || defined(__DOXYGEN__)
+/**
+ * @brief Host runner mailbox
+ *
+ * The host runner finds it by the name
+ * @ref EMUNIT_PORT_SIMAVR_HOST_MAILBOX.
+ */
+volatile emunit_port_simavr_host_mailbox_t emunit_port_simavr_host_mailbox;
+
+/**
+ * @brief Host runner signal register address
+ *
+ * The host runner finds it by the name
+ * @ref EMUNIT_PORT_SIMAVR_HOST_SIGNAL.
+ */
+const __flash uint16_t emunit_port_simavr_host_signal __attribute__((used)) =
+	(uint16_t)(EMUNIT_PORT_SIMAVR_HOST_SIGNAL_ADDR);
+
+/**
+ * @brief Host runner shard descriptor
+ *
+ * The host runner finds it by the name
+ * @ref EMUNIT_PORT_SIMAVR_HOST_SHARD and fills it before the core starts.
+ */
+EMUNIT_NOINIT_VAR(volatile emunit_port_simavr_host_shard_t, emunit_port_simavr_host_shard);
+
+/** @name The .noinit section bounds provided by the linker script
+ * @{ */
+extern uint8_t __noinit_start[];
+extern uint8_t __noinit_end[];
+/** @} */
+
+/**
+ * @brief The .noinit section range
+ *
+ * The host runner finds it by the name
+ * @ref EMUNIT_PORT_SIMAVR_HOST_NOINIT.
+ * This is the only data that is kept when the checkpoint is restored.
+ */
+const __flash emunit_port_simavr_host_noinit_t emunit_port_simavr_host_noinit __attribute__((used)) =
+{
+	(uint16_t)__noinit_start,
+	(uint16_t)__noinit_end
+};
+
+/**
+ * @brief Signal the host runner
+ *
+ * Auxiliary internal function.
+ * Fills the mailbox and writes the signal register.
+ * The host runner processes the signal during the write.
+ *
+ * @param signal Signal code
+ * @param addr   Data address
+ * @param len    Data length or signal argument
+ */
+static inline void simavr_host_signal(uint8_t signal, uint16_t addr, uint16_t len)
+{
+	emunit_port_simavr_host_mailbox.addr = addr;
+	emunit_port_simavr_host_mailbox.len  = len;
+	*((volatile uint8_t *)(EMUNIT_PORT_SIMAVR_HOST_SIGNAL_ADDR)) = signal;
+}
+#endif
+
+/**
+ * @brief Restart without reset flags is used
+ *
+ * The restart performed by jump to the reset vector or by the host runner.
+ */
+#define SIMAVR_SOFT_RESET_USED (EMUNIT_PORT_SIMAVR_SOFT_RESET || EMUNIT_PORT_SIMAVR_HOST)
+
+#if SIMAVR_SOFT_RESET_USED || defined(__DOXYGEN__)
+/**
+ * @brief The value of @ref simavr_soft_reset_mark that marks soft reset
+ */
+#define SIMAVR_SOFT_RESET_MARK 0xa5U
+
+/**
+ * @brief Soft reset marker
+ *
+ * Set just before the jump to the reset vector.
+ * It tells the early initialisation that the status is valid,
+ * as the reset flags are not set by the soft reset.
+ */
+static EMUNIT_NOINIT_VAR(uint8_t, simavr_soft_reset_mark);
+
+/**
+ * @brief Reset the peripherals
+ *
+ * Auxiliary internal function.
+ * Disables all the interrupt sources that are left enabled by the test,
+ * so the next test starts with the same configuration as after hardware reset.
+ */
+static inline void simavr_peripherals_reset(void)
+{
+#ifdef EIMSK
+	EIMSK = 0U;
+#endif
+#ifdef GICR
+	GICR = 0U;
+#endif
+#ifdef PCICR
+	PCICR = 0U;
+#endif
+#ifdef TIMSK
+	TIMSK = 0U;
+#endif
+#ifdef ETIMSK
+	ETIMSK = 0U;
+#endif
+#ifdef TIMSK0
+	TIMSK0 = 0U;
+#endif
+#ifdef TIMSK1
+	TIMSK1 = 0U;
+#endif
+#ifdef TIMSK2
+	TIMSK2 = 0U;
+#endif
+#ifdef TIMSK3
+	TIMSK3 = 0U;
+#endif
+#ifdef UCSRB
+	UCSRB = 0U;
+#endif
+#ifdef UCSR0B
+	UCSR0B = 0U;
+#endif
+#ifdef UCSR1B
+	UCSR1B = 0U;
+#endif
+#ifdef SPCR
+	SPCR = 0U;
+#endif
+#ifdef TWCR
+	TWCR = 0U;
+#endif
+#ifdef ADCSRA
+	ADCSRA = 0U;
+#endif
+#ifdef EECR
+	EECR = 0U;
+#endif
+}
+#endif
+
 
 /**
  * @brief Put single character to out register
@@ -91,15 +239,45 @@ void emunit_port_simavr_out_deinit(void)
 
 void emunit_port_simavr_out_write(char const * p_str, size_t len)
 {
+#if EMUNIT_PORT_SIMAVR_HOST
+	/* The host reads the data from the simulated memory */
+	simavr_host_signal(EMUNIT_PORT_SIMAVR_HOST_OUT, (uint16_t)p_str, (uint16_t)len);
+#else
 	while(0 != len--)
 	{
 		simavr_putc(*(p_str++));
 	}
+#endif
+}
+
+void emunit_port_simavr_out_wait(void)
+{
+	/* Output is synchronous - just send everything that is waiting */
+	emunit_flush();
+}
+
+void emunit_port_simavr_out_select(uint8_t stream)
+{
+#if EMUNIT_PORT_SIMAVR_HOST
+	simavr_host_signal(EMUNIT_PORT_SIMAVR_HOST_SELECT, 0U, stream);
+#else
+	/* There is only one console: mark the stream change in the output */
+	simavr_putc_raw(EMUNIT_PORT_SIMAVR_STREAM_MARK);
+	simavr_putc_raw('0' + stream);
+#endif
 }
 
 void emunit_port_simavr_early_init(emunit_status_key_t * p_valid_key)
 {
 	uint8_t mcusr = MCUCSR;
+#if SIMAVR_SOFT_RESET_USED
+	if((0U == mcusr) && (SIMAVR_SOFT_RESET_MARK == simavr_soft_reset_mark))
+	{
+		/* Soft reset behaves like the watchdog restart */
+		mcusr = (1U<<WDRF);
+	}
+	simavr_soft_reset_mark = 0U;
+#endif
 	if((0U != (mcusr & (~(1U<<WDRF))))
 	  ||
 	  (0U == mcusr) /* Special case for simavr */)
@@ -114,29 +292,90 @@ void emunit_port_simavr_early_init(emunit_status_key_t * p_valid_key)
 
 void emunit_port_simavr_restart(void)
 {
+#if EMUNIT_PORT_SIMAVR_HOST
+	cli();
+	simavr_soft_reset_mark = SIMAVR_SOFT_RESET_MARK;
+	/* The host runner resets the core */
+	simavr_host_signal(EMUNIT_PORT_SIMAVR_HOST_RESTART, 0U, 0U);
+	while(1)
+	{
+		/* Waiting for reset */
+	}
+#elif EMUNIT_PORT_SIMAVR_SOFT_RESET
+	cli();
+	simavr_peripherals_reset();
+	simavr_soft_reset_mark = SIMAVR_SOFT_RESET_MARK;
+	/* Jump to the reset vector: C runtime initialises the stack, .data and .bss */
+	__asm__ __volatile__ ("ijmp" :: "z" (0));
+	__builtin_unreachable();
+#else
 	/* Restart using WDT */
 	wdt_enable(WDTO_15MS);
 	while(1)
 	{
 		/* Waiting for reset */
 	}
+#endif
 }
 
 void emunit_port_simavr_tc_begin(void)
 {
-
+#if EMUNIT_PORT_SIMAVR_HOST
+	/* The host runner starts counting the cycles */
+	simavr_host_signal(
+		EMUNIT_PORT_SIMAVR_HOST_TC_BEGIN,
+		(uint16_t)emunit_ts_name_get(emunit_ts_current_index_get()),
+		(uint16_t)emunit_tc_name_get(emunit_ts_current_index_get(), emunit_tc_current_index_get()));
+#endif
 }
 
 void emunit_port_simavr_tc_end(void)
 {
+#if EMUNIT_PORT_SIMAVR_HOST
+	simavr_host_signal(EMUNIT_PORT_SIMAVR_HOST_TC_END, 0U, 0U);
+#endif
+}
+
+bool emunit_port_simavr_ts_selected(size_t suite_idx)
+{
+#if EMUNIT_PORT_SIMAVR_HOST
+	if(0U != emunit_port_simavr_host_shard.end)
+	{
+		return (suite_idx >= emunit_port_simavr_host_shard.first) &&
+			(suite_idx < emunit_port_simavr_host_shard.end);
+	}
+#else
+	(void)suite_idx;
+#endif
+	return true;
+}
 
+#if EMUNIT_CONF_TIMING && EMUNIT_CONF_BENCH_BASELINE
+bool emunit_port_simavr_bench_baseline(emunit_bench_t * p_baseline)
+{
+	/* The results are compared with the baseline by the host tool */
+	(void)p_baseline;
+	return false;
 }
+#endif
 
 
 int main(void)
 {
+	int ret;
+#if EMUNIT_PORT_SIMAVR_HOST
+	/* Every restart returns here: the host restores this state instead of the core reset.
+	 * The host does not restore the IO registers,
+	 * so no peripheral may be initialised before this point.
+	 * The output retained from before the restart is flushed below. */
+	simavr_host_signal(EMUNIT_PORT_SIMAVR_HOST_CHECKPOINT, 0U, 0U);
+#endif
 	emunit_flush();
-	emunit_run();
+	ret = emunit_run();
+#if EMUNIT_PORT_SIMAVR_HOST
+	simavr_host_signal(EMUNIT_PORT_SIMAVR_HOST_EXIT, 0U, (uint16_t)ret);
+#endif
+	return ret;
 }
 
 void before_main(void) __attribute__ ((naked)) __attribute__((used)) __attribute__ ((section (".init3")));
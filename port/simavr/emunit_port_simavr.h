@@ -58,6 +58,12 @@
 
 	/** See the @ref emunit_port_out_write documentation */
 	void emunit_port_simavr_out_write(char const * p_str, size_t len);
+
+	/** See the @ref emunit_port_out_wait documentation */
+	void emunit_port_simavr_out_wait(void);
+
+	/** See the @ref emunit_port_out_select documentation */
+	void emunit_port_simavr_out_select(uint8_t stream);
 /** @} */
 
 /** See the @ref emunit_port_first_init documentation */
@@ -72,5 +78,13 @@ void emunit_port_simavr_tc_begin(void);
 /** See the @ref emunit_port_tc_end documentation */
 void emunit_port_simavr_tc_end(void);
 
+/** See the @ref emunit_port_ts_selected documentation */
+bool emunit_port_simavr_ts_selected(size_t suite_idx);
+
+#if (EMUNIT_CONF_TIMING && EMUNIT_CONF_BENCH_BASELINE) || defined(__DOXYGEN__)
+/** See the @ref emunit_port_bench_baseline documentation */
+bool emunit_port_simavr_bench_baseline(emunit_bench_t * p_baseline);
+#endif
+
 /** @} */
 #endif /* EMUNIT_PORT_SIMAVR_H_INCLUDED */
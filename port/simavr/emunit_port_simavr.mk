@@ -324,6 +324,11 @@ build: elf hex lss sym
 # Run the test
 run: simulavr_run
 
+# EMUnit simavr host runner, see tools/simavr_runner
+EMUNIT_SIMAVR_RUNNER ?= $(EMUNIT_DIR)/tools/simavr_runner/emunit_simavr_runner
+# Runner options, for example: -p profile.txt -f stacks.folded
+EMUNIT_SIMAVR_RUNNER_FLAGS ?=
+
 
 elf: $(OUTDIR)/$(TARGET).elf
 hex: $(OUTDIR)/$(TARGET).hex
@@ -393,6 +398,27 @@ extcoff: $(OUTDIR)/$(TARGET).elf
 simulavr_run: elf
 	$(SIMULAVR_CMD) $(SIMULAVR_PARAMS)
 
+# Run the test in the EMUnit simavr host runner.
+# The test has to be built with EMUNIT_PORT_SIMAVR_HOST=1
+host_run: elf
+	$(EMUNIT_SIMAVR_RUNNER) $(EMUNIT_SIMAVR_RUNNER_FLAGS) $(OUTDIR)/$(TARGET).elf
+
+# Check the EMUnit simavr host runner.
+# The run restoring the checkpoint and the run split between two cores
+# have to give the same output and the same cycles as the run resetting the core.
+# The exit status of the runs is the number of failed suites, so it is ignored.
+# The test has to be built with EMUNIT_PORT_SIMAVR_HOST=1
+host_check: elf
+	-$(EMUNIT_SIMAVR_RUNNER) -r -c $(OUTDIR)/host_reset.csv $(OUTDIR)/$(TARGET).elf > $(OUTDIR)/host_reset.out
+	-$(EMUNIT_SIMAVR_RUNNER) -c $(OUTDIR)/host_checkpoint.csv $(OUTDIR)/$(TARGET).elf > $(OUTDIR)/host_checkpoint.out
+	-$(EMUNIT_SIMAVR_RUNNER) -j 2 -c $(OUTDIR)/host_cores.csv $(OUTDIR)/$(TARGET).elf > $(OUTDIR)/host_cores.out
+	grep -q "<testcase " $(OUTDIR)/host_reset.out
+	cmp $(OUTDIR)/host_reset.out $(OUTDIR)/host_checkpoint.out
+	cmp $(OUTDIR)/host_reset.csv $(OUTDIR)/host_checkpoint.csv
+	cmp $(OUTDIR)/host_reset.out $(OUTDIR)/host_cores.out
+	cmp $(OUTDIR)/host_reset.csv $(OUTDIR)/host_cores.csv
+	@echo "host_check: OK"
+
 # Create final output files (.hex, .eep) from ELF output file.
 $(OUTDIR)/%.hex: $(OUTDIR)/%.elf
 	@echo
@@ -523,7 +549,7 @@ $(OBJ) : $(filter-out %.d,$(MAKEFILE_LIST))
 
 
 # Listing of phony targets.
-.PHONY : run all begin finish end sizebefore sizeafter gccversion \
+.PHONY : run host_run host_check all begin finish end sizebefore sizeafter gccversion \
 pre_build build post_build elf hex eep lss sym coff extcoff \
 clean clean_list clean_msg program debug gdb-config \
 print_target_name
@@ -0,0 +1,122 @@
+#ifndef EMUNIT_PORT_SIMAVR_HOST_H_INCLUDED
+#define EMUNIT_PORT_SIMAVR_HOST_H_INCLUDED
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief EMUnit simavr host runner interface
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * File shared by the simavr port and the host runner.
+ * @sa emunit_port_simavr_host_group
+ */
+#include <stdint.h>
+
+/**
+ * @defgroup emunit_port_simavr_host_group <emunit_port_simavr_host> EMUnit simavr host interface
+ * @{
+ * @ingroup emunit_port_simavr_group
+ *
+ * Communication between the test running in simavr and the host runner.
+ *
+ * The target fills the mailbox and writes the signal code to the signal register.
+ * The host runner finds both in the ELF symbols,
+ * so the data is read directly from the simulated memory
+ * without any character sent through the console register.
+ * @{
+ */
+
+/** The name of the mailbox variable */
+#define EMUNIT_PORT_SIMAVR_HOST_MAILBOX "emunit_port_simavr_host_mailbox"
+
+/** The name of the flash constant with the signal register address */
+#define EMUNIT_PORT_SIMAVR_HOST_SIGNAL  "emunit_port_simavr_host_signal"
+
+/**
+ * @name Signal codes
+ * @{
+ */
+/** Mailbox describes the data to be written to the output */
+#define EMUNIT_PORT_SIMAVR_HOST_OUT    1U
+/** Mailbox length is the index of the selected output stream */
+#define EMUNIT_PORT_SIMAVR_HOST_SELECT 2U
+/** Mailbox length is the value returned by the test */
+#define EMUNIT_PORT_SIMAVR_HOST_EXIT   3U
+/** Restart request: the host resets the core, the data memory is preserved */
+#define EMUNIT_PORT_SIMAVR_HOST_RESTART  4U
+/** Test case begins: mailbox address is the suite name, length is the case name, both in flash */
+#define EMUNIT_PORT_SIMAVR_HOST_TC_BEGIN 5U
+/** Test case ends */
+#define EMUNIT_PORT_SIMAVR_HOST_TC_END   6U
+/** Checkpoint: the host saves the core state and restores it on the next restart request */
+#define EMUNIT_PORT_SIMAVR_HOST_CHECKPOINT 7U
+/** @} */
+
+/**
+ * @brief Mailbox structure
+ *
+ * Both fields are little endian 16 bit values in the simulated memory.
+ */
+typedef struct
+{
+	uint16_t addr; /**< Data address */
+	uint16_t len;  /**< Data length or signal argument */
+}emunit_port_simavr_host_mailbox_t;
+
+/** The name of the shard descriptor variable */
+#define EMUNIT_PORT_SIMAVR_HOST_SHARD "emunit_port_simavr_host_shard"
+
+/** The name of the test suites table in flash */
+#define EMUNIT_PORT_SIMAVR_HOST_SUITES "emunit_main_ts"
+
+/**
+ * @brief Shard descriptor
+ *
+ * Written by the host runner before the core starts.
+ * Only the suites with index in the range <first, end) are run.
+ * Both fields set to 0 select all the suites.
+ */
+typedef struct
+{
+	uint16_t first; /**< The first selected suite index */
+	uint16_t end;   /**< The index after the last selected suite */
+}emunit_port_simavr_host_shard_t;
+
+/** The name of the flash constant with the .noinit section range */
+#define EMUNIT_PORT_SIMAVR_HOST_NOINIT "emunit_port_simavr_host_noinit"
+
+/**
+ * @brief The .noinit section range
+ *
+ * The data kept when the checkpoint is restored.
+ * Both fields are little endian 16 bit values in the simulated flash.
+ */
+typedef struct
+{
+	uint16_t start; /**< The first address of the section */
+	uint16_t end;   /**< The address after the section */
+}emunit_port_simavr_host_noinit_t;
+
+/** @} */
+/** @} */
+#endif /* EMUNIT_PORT_SIMAVR_HOST_H_INCLUDED */
@@ -0,0 +1,345 @@
+# -*- coding: utf-8 -*-
+# EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+#
+# This program is free software: you can redistribute it and/or modify
+# in under the terms of the GNU General Public license (version 3)
+# as published by the Free Software Foundation AND MODIFIED BY the
+# EMUnit exception.
+#
+# NOTE: The exception was added to the GPL to ensure
+# that you can test any kind of software without being
+# obligated to release the whole source code under the terms of GPL.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# and the EMUnit license exception along with this program.
+# If not, it can be viewed in the original EMunit repository:
+# <https://github.com/rkel/emunit>.
+'''
+
+Host side benchmark baseline tool
+
+Records the baseline from the results of the reference run
+and checks the results of the next runs against it.
+It is meant for the target runs, the PC ports compare the benchmarks
+themselves when EMUNIT_CONF_BENCH_BASELINE is set.
+
+The results are read from the XML output, the <bench> elements,
+and from the cycles file written by the qemuarm port or the simavr runner,
+the cycles of the whole test case are used as its median then.
+
+The baseline is a CSV file with suite,case,median,p90,unit columns,
+the same as the one recorded by the pcstdout port.
+
+The median may exceed the baseline median by the threshold percent
+or by the noise baseline spreads, whichever is larger.
+The spread is the distance between the baseline median and p90.
+Every regression is added to the XML results as REGRESSION failure
+of the test case and the test summary is updated.
+Without the XML results the failures are written as a new XML document.
+The exit status is 1 if any benchmark regressed.
+
+Usage:
+    emunit_baseline.py record [-c cycles.csv] [-o baseline.csv] [results.xml]
+    emunit_baseline.py compare -b baseline.csv [-t threshold] [-n noise]
+                               [-c cycles.csv] [-o output.xml] [results.xml]
+Standard output is used by default.
+
+'''
+import sys
+import os
+import csv
+import argparse
+import xml.etree.ElementTree as ET
+
+# Baseline file columns
+BASELINE_HEADER = ['suite', 'case', 'median', 'p90', 'unit']
+# Default allowed median increase in percent
+THRESHOLD_DEFAULT = 10
+# Default allowed median increase in the baseline spreads
+NOISE_DEFAULT = 1
+
+
+class Figures(object):
+    u"""Benchmark figures of the single test case"""
+
+    def __init__(self, median, p90, unit, line=0):
+        self.median = median
+        self.p90 = p90
+        self.unit = unit
+        self.line = line
+
+
+def results_read(xml_root, cycles_file):
+    u"""Read the results
+
+    Returns the dictionary of Figures indexed by (suite, case).
+    The XML benchmark results take precedence over the cycles file.
+    """
+    results = {}
+    if cycles_file:
+        with open(cycles_file) as f:
+            for row in csv.reader(f):
+                if len(row) != 3 or not row[2].isdigit():
+                    continue
+                cycles = int(row[2])
+                results[(row[0], row[1])] = Figures(cycles, cycles, 'cycles')
+    if xml_root is not None:
+        for ts in xml_root.iter('testsuite'):
+            for tc in ts.iter('testcase'):
+                bench = tc.find('bench')
+                if bench is None:
+                    continue
+                results[(ts.get('name'), tc.get('name'))] = Figures(
+                    int(bench.get('median')), int(bench.get('p90')), bench.get('unit'))
+    return results
+
+
+def baseline_read(name):
+    u"""Read the baseline file
+
+    The lines that are not baseline entries, like the header, are skipped.
+    """
+    baseline = {}
+    with open(name) as f:
+        for line, row in enumerate(csv.reader(f), 1):
+            if len(row) != 5 or not row[2].isdigit() or not row[3].isdigit():
+                continue
+            baseline[(row[0], row[1])] = Figures(int(row[2]), int(row[3]), row[4], line)
+    return baseline
+
+
+def baseline_write(f, results):
+    u"""Write the baseline file"""
+    writer = csv.writer(f, lineterminator='\n')
+    writer.writerow(BASELINE_HEADER)
+    for key in sorted(results):
+        fig = results[key]
+        writer.writerow([key[0], key[1], fig.median, fig.p90, fig.unit])
+
+
+def limit_get(base, threshold, noise):
+    u"""Maximum median that is not a regression
+
+    The same calculation as in the engine.
+    """
+    margin = (base.median // 100) * threshold + ((base.median % 100) * threshold) // 100
+    spread = (base.p90 - base.median) * noise if base.p90 > base.median else 0
+    return base.median + max(margin, spread)
+
+
+def regressions_find(results, baseline, threshold, noise):
+    u"""Find regressed test cases
+
+    Returns the list of (suite, case, baseline, limit, measured) tuples.
+    """
+    found = []
+    for key in sorted(results):
+        if key not in baseline:
+            continue
+        fig = results[key]
+        base = baseline[key]
+        if fig.unit != base.unit:
+            raise ValueError('%s.%s: unit %s, baseline unit %s' % (key[0], key[1], fig.unit, base.unit))
+        limit = limit_get(base, threshold, noise)
+        if fig.median > limit:
+            found.append((key[0], key[1], base, limit, fig.median))
+    return found
+
+
+def failure_create(baseline_name, failure_id, base, limit, measured, indent, step):
+    u"""Create REGRESSION failure element
+
+    The failure is placed in the baseline file line of the test case.
+    """
+    inner = indent + step
+    details_inner = inner + step
+    failure = ET.Element('failure', {'type': 'REGRESSION', 'id': str(failure_id)})
+    failure.text = inner
+    children = []
+    for tag, value in (('file', os.path.basename(baseline_name)), ('line', base.line)):
+        e = ET.SubElement(failure, tag)
+        e.text = str(value)
+        children.append(e)
+    details = ET.SubElement(failure, 'details')
+    children.append(details)
+    details.text = details_inner
+    values = (('baseline', base.median), ('limit', limit), ('measured', measured), ('unit', base.unit))
+    for n, (tag, value) in enumerate(values):
+        e = ET.SubElement(details, tag)
+        e.text = str(value)
+        e.tail = details_inner if n < len(values) - 1 else inner
+    for e in children[:-1]:
+        e.tail = inner
+    details.tail = indent
+    return failure
+
+
+def stat_move(summary, name, counted):
+    u"""Count one more failed element in the summary statistic
+
+    The element counted before is moved from passed to failed,
+    any other one is added as the new failed element.
+    """
+    stat = summary.find(name) if summary is not None else None
+    if stat is None:
+        return
+    failed = stat.find('failed')
+    failed.text = str(int(failed.text) + 1)
+    if counted:
+        passed = stat.find('passed')
+        passed.text = str(int(passed.text) - 1)
+    else:
+        total = stat.find('total')
+        total.text = str(int(total.text) + 1)
+
+
+def results_mark(xml_root, baseline_name, found):
+    u"""Add the regression failures to the XML results
+
+    The benchmarks are counted test cases if the number of test cases
+    matches the summary, that is if every benchmark has its budget
+    or its baseline was found by the port.
+    Otherwise the regressed benchmarks are added to the summary
+    as the new failed test cases.
+    """
+    summary = xml_root.find('testsummary')
+    testcases = list(xml_root.iter('testcase'))
+    total = summary.find('testcase-stat/total') if summary is not None else None
+    counted = (total is not None) and (int(total.text) == len(testcases))
+    ids = [int(f.get('id', 0)) for f in xml_root.iter('failure')]
+    failure_id = max(ids) + 1 if ids else 1
+    regressed = {(suite, case): (base, limit, measured) for suite, case, base, limit, measured in found}
+
+    for ts in xml_root.iter('testsuite'):
+        ts_failed = ts.find('.//failure') is not None
+        for tc in ts.iter('testcase'):
+            key = (ts.get('name'), tc.get('name'))
+            if key not in regressed:
+                continue
+            base, limit, measured = regressed[key]
+            children = list(tc)
+            lead = tc.text if (tc.text and not tc.text.strip()) else '\n\t\t'
+            step = '\t' if '\t' in lead else '  '
+            indent = lead if children else lead + step
+            failure = failure_create(baseline_name, failure_id, base, limit, measured, indent, step)
+            failure_id += 1
+            pos = len(children)
+            for n, child in enumerate(children):
+                if child.tag in ('time', 'bench'):
+                    pos = n
+                    break
+            if pos < len(children):
+                failure.tail = indent
+            elif children:
+                failure.tail = children[-1].tail
+                children[-1].tail = indent
+            else:
+                failure.tail = lead
+                tc.text = indent
+            tc_failed = tc.find('failure') is not None
+            tc.insert(pos, failure)
+            if not tc_failed:
+                stat_move(summary, 'testcase-stat', counted or tc.find('bench') is None)
+            if not ts_failed:
+                stat_move(summary, 'testsuite-stat', True)
+                ts_failed = True
+
+
+def results_create(baseline_name, found):
+    u"""Create the XML document with the regression failures only"""
+    root = ET.Element('test', {'name': 'EMUnit baseline'})
+    root.text = '\n\t'
+    suites = {}
+    for n, (suite, case, base, limit, measured) in enumerate(found, 1):
+        if suite not in suites:
+            ts = ET.SubElement(root, 'testsuite', {'name': suite})
+            ts.text = '\n\t\t'
+            ts.tail = '\n\t'
+            suites[suite] = ts
+        ts = suites[suite]
+        if len(ts):
+            ts[-1].tail = '\n\t\t'
+        tc = ET.SubElement(ts, 'testcase', {'name': case})
+        tc.text = '\n\t\t\t'
+        tc.tail = '\n\t'
+        failure = failure_create(baseline_name, n, base, limit, measured, '\n\t\t\t', '\t')
+        failure.tail = '\n\t\t'
+        tc.append(failure)
+    summary = ET.SubElement(root, 'testsummary')
+    summary.tail = '\n'
+    summary.text = '\n\t\t'
+    for n, (name, count) in enumerate((('testsuite-stat', len(suites)), ('testcase-stat', len(found)))):
+        stat = ET.SubElement(summary, name)
+        stat.text = '\n\t\t\t'
+        stat.tail = '\n\t\t' if n == 0 else '\n\t'
+        for m, (tag, value) in enumerate((('total', count), ('passed', 0), ('failed', count))):
+            e = ET.SubElement(stat, tag)
+            e.text = str(value)
+            e.tail = '\n\t\t\t' if m < 2 else '\n\t\t'
+    return root
+
+
+def output_open(name, binary):
+    u"""Open the output file or return standard output"""
+    if name:
+        return open(name, 'wb' if binary else 'w')
+    return getattr(sys.stdout, 'buffer', sys.stdout) if binary else sys.stdout
+
+
+def main(argv):
+    u"""Main function"""
+    parser = argparse.ArgumentParser()
+    sub = parser.add_subparsers(dest='mode')
+    sub.required = True
+    for mode in ('record', 'compare'):
+        p = sub.add_parser(mode)
+        p.add_argument('results', nargs='?', help='XML results file')
+        p.add_argument('-c', '--cycles', help='cycles file of the test cases')
+        p.add_argument('-o', '--output', help='output file')
+        if mode == 'compare':
+            p.add_argument('-b', '--baseline', required=True, help='baseline file')
+            p.add_argument('-t', '--threshold', type=int, default=THRESHOLD_DEFAULT,
+                           help='allowed median increase in percent')
+            p.add_argument('-n', '--noise', type=int, default=NOISE_DEFAULT,
+                           help='allowed median increase in the baseline spreads, 0 to disable')
+    args = parser.parse_args(argv)
+    if not args.results and not args.cycles:
+        parser.error('no results given')
+
+    xml_tree = ET.parse(args.results) if args.results else None
+    results = results_read(xml_tree.getroot() if xml_tree is not None else None, args.cycles)
+
+    if args.mode == 'record':
+        fout = output_open(args.output, False)
+        baseline_write(fout, results)
+        fout.flush()
+        return 0
+
+    try:
+        found = regressions_find(results, baseline_read(args.baseline), args.threshold, args.noise)
+    except ValueError as e:
+        sys.stderr.write('%s\n' % e)
+        return -1
+    for suite, case, base, limit, measured in found:
+        sys.stderr.write('%s.%s: median %d %s regressed, baseline %d, limit %d\n' %
+                         (suite, case, measured, base.unit, base.median, limit))
+    if xml_tree is not None:
+        results_mark(xml_tree.getroot(), args.baseline, found)
+        root = xml_tree.getroot()
+    else:
+        root = results_create(args.baseline, found)
+    fout = output_open(args.output, True)
+    fout.write(b'<?xml version="1.0" encoding="UTF-8"?>\n')
+    fout.write(ET.tostring(root))
+    fout.write(b'\n')
+    fout.flush()
+    return 1 if found else 0
+
+# Call main function
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
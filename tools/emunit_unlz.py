@@ -0,0 +1,113 @@
+# -*- coding: utf-8 -*-
+# EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+#
+# This program is free software: you can redistribute it and/or modify
+# in under the terms of the GNU General Public license (version 3)
+# as published by the Free Software Foundation AND MODIFIED BY the
+# EMUnit exception.
+#
+# NOTE: The exception was added to the GPL to ensure
+# that you can test any kind of software without being
+# obligated to release the whole source code under the terms of GPL.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# and the EMUnit license exception along with this program.
+# If not, it can be viewed in the original EMunit repository:
+# <https://github.com/rkel/emunit>.
+'''
+
+Host side decompressor for the EMUnit compressed output stream
+
+Restores the text generated by the target compiled with
+EMUNIT_CONF_DISPLAY_COMPRESS set to 1.
+See emunit_display_lz_group in emunit_display.c for the stream format.
+
+Usage:
+    emunit_unlz.py [-i input] [-o output]
+Standard input and output are used by default.
+
+'''
+import sys
+import argparse
+
+# Minimal match length
+LZ_MATCH_MIN = 3
+# First value of the match token
+LZ_MATCH = 0xa0
+# Literal escape token
+LZ_ESC = 0x80
+# Escaped NUL character
+LZ_NUL = 0x40
+# Window size - the number of bytes of history required
+LZ_WINDOW = 0x80
+
+
+class Decompressor(object):
+    u"""Stream decompressor
+
+    Keeps the history between calls, so the data can be processed
+    in any chunks.
+    """
+
+    def __init__(self):
+        self.history = bytearray()
+        self.pending = None
+
+    def feed(self, data):
+        u"""Decompress next part of the stream
+
+        Returns the bytearray with decompressed data.
+        """
+        out = bytearray()
+        for c in bytearray(data):
+            if self.pending is not None:
+                token = self.pending
+                self.pending = None
+                if token == LZ_ESC:
+                    self._put(out, 0 if c == LZ_NUL else c)
+                else:
+                    length = token - LZ_MATCH + LZ_MATCH_MIN
+                    dist = (c & 0x7f) + 1
+                    for _ in range(length):
+                        self._put(out, self.history[-dist])
+            elif c < 0x80:
+                self._put(out, c)
+            elif c == LZ_ESC or c >= LZ_MATCH:
+                self.pending = c
+            else:
+                self._put(out, c - LZ_ESC)
+        del self.history[:-LZ_WINDOW]
+        return out
+
+    def _put(self, out, c):
+        out.append(c)
+        self.history.append(c)
+
+
+def main(argv):
+    u"""Main function"""
+    parser = argparse.ArgumentParser()
+    parser.add_argument('-i', '--input', help='compressed input file')
+    parser.add_argument('-o', '--output', help='decompressed output file')
+    args = parser.parse_args(argv)
+
+    fin = open(args.input, 'rb') if args.input else getattr(sys.stdin, 'buffer', sys.stdin)
+    fout = open(args.output, 'wb') if args.output else getattr(sys.stdout, 'buffer', sys.stdout)
+
+    lz = Decompressor()
+    while True:
+        data = fin.read(4096)
+        if not data:
+            break
+        fout.write(lz.feed(data))
+        fout.flush()
+    return 0
+
+# Call main function
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,578 @@
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief EMUnit simavr host runner profiler
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * @sa emunit_simavr_profile_group
+ */
+#include "emunit_simavr_profile.h"
+#include <signal.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/** Offset of the data memory addresses in AVR ELF symbols */
+#define PROFILE_DATA_OFFSET 0x800000U
+
+/** Function index used for the instructions outside of any symbol */
+#define PROFILE_FUNC_UNKNOWN (-1)
+
+/** Function index of the call tree root */
+#define PROFILE_FUNC_ROOT    (-2)
+
+/** Name of the instructions outside of any symbol */
+#define PROFILE_UNKNOWN_NAME "[unknown]"
+
+/**
+ * @brief Call tree node
+ *
+ * Index 0 is the root, so 0 in @c child or @c sibling means no node.
+ */
+typedef struct
+{
+	uint32_t parent;  /**< Parent node */
+	uint32_t child;   /**< The first child node */
+	uint32_t sibling; /**< The next node with the same parent */
+	int32_t  func;    /**< Function index */
+	uint64_t cycles;  /**< Cycles spent in this function in this call stack */
+}profile_node_t;
+
+/**
+ * @brief Profiler instance
+ */
+struct emunit_simavr_profile_s
+{
+	uint64_t * p_hist;          /**< Cycles per flash word */
+	uint64_t   total;           /**< Cycles of the whole test case */
+	profile_node_t * p_nodes;   /**< Call tree */
+	uint32_t   node_cnt;        /**< Number of used nodes */
+	uint32_t   node_max;        /**< Number of allocated nodes */
+	uint32_t   current;         /**< The node of the currently running function */
+};
+
+/**
+ * @brief Firmware tables shared by all the instances
+ */
+static struct
+{
+	uint32_t       words;       /**< Flash size in words */
+	int32_t *      p_func;      /**< Function index of every flash word */
+	char const **  p_func_name; /**< Function names */
+	uint32_t       func_cnt;    /**< Number of functions */
+	int32_t *      p_line;      /**< Line index of every flash word */
+	char **        p_line_name; /**< Line names */
+	uint32_t       line_cnt;    /**< Number of lines */
+}profile;
+
+/**
+ * @brief Report fatal error and exit
+ */
+static void profile_nomem(void)
+{
+	fputs("Cannot allocate the memory\n", stderr);
+	exit(-1);
+}
+
+/**
+ * @brief Allocate zeroed memory
+ *
+ * Exits if there is no memory.
+ *
+ * @param n    Number of elements
+ * @param size Size of the element
+ * @return Allocated memory
+ */
+static void * profile_calloc(size_t n, size_t size)
+{
+	void * p = calloc((0U == n) ? 1U : n, size);
+	if(NULL == p)
+		profile_nomem();
+	return p;
+}
+
+/**
+ * @brief Compare symbols by address
+ *
+ * @param p_a The first symbol pointer
+ * @param p_b The second symbol pointer
+ * @return qsort comparison result
+ */
+static int profile_symbol_cmp(void const * p_a, void const * p_b)
+{
+	avr_symbol_t const * a = *(avr_symbol_t const * const *)p_a;
+	avr_symbol_t const * b = *(avr_symbol_t const * const *)p_b;
+	return (a->addr > b->addr) - (a->addr < b->addr);
+}
+
+/**
+ * @brief Build the function table
+ *
+ * Symbols with the size cover the range given by the size,
+ * symbols without the size cover the free words up to the next symbol.
+ *
+ * @param[in] p_f Firmware
+ */
+static void profile_func_build(elf_firmware_t const * p_f)
+{
+	avr_symbol_t const ** p_sym = profile_calloc(p_f->symbolcount, sizeof(*p_sym));
+	uint32_t cnt = 0;
+	uint32_t n;
+
+	for(n = 0; n < p_f->symbolcount; ++n)
+	{
+		if(p_f->symbol[n]->addr < PROFILE_DATA_OFFSET)
+			p_sym[cnt++] = p_f->symbol[n];
+	}
+	qsort(p_sym, cnt, sizeof(*p_sym), profile_symbol_cmp);
+
+	profile.p_func_name = profile_calloc(cnt, sizeof(*profile.p_func_name));
+	profile.func_cnt = cnt;
+	for(n = 0; n < profile.words; ++n)
+		profile.p_func[n] = PROFILE_FUNC_UNKNOWN;
+
+	for(n = 0; n < cnt; ++n)
+	{
+		uint32_t w;
+		profile.p_func_name[n] = p_sym[n]->symbol;
+		for(w = p_sym[n]->addr / 2U; (w < profile.words) && (w < (p_sym[n]->addr + p_sym[n]->size + 1U) / 2U); ++w)
+			profile.p_func[w] = (int32_t)n;
+	}
+	for(n = 0; n < cnt; ++n)
+	{
+		uint32_t w;
+		uint32_t end = (n + 1U < cnt) ? p_sym[n + 1U]->addr / 2U : profile.words;
+		if(0U != p_sym[n]->size)
+			continue;
+		for(w = p_sym[n]->addr / 2U; (w < profile.words) && (w < end); ++w)
+		{
+			if(PROFILE_FUNC_UNKNOWN == profile.p_func[w])
+				profile.p_func[w] = (int32_t)n;
+		}
+	}
+	free(p_sym);
+}
+
+/**
+ * @brief Hash of the string
+ *
+ * FNV-1a 32 bit hash.
+ *
+ * @param[in] p_str String
+ * @return Hash value
+ */
+static uint32_t profile_hash(char const * p_str)
+{
+	uint32_t h = 2166136261U;
+	while('\0' != *p_str)
+	{
+		h ^= (uint8_t)*p_str++;
+		h *= 16777619U;
+	}
+	return h;
+}
+
+/**
+ * @brief Quote the string for the shell
+ *
+ * The string is placed in single quotes,
+ * every single quote inside is replaced by `'\''`.
+ *
+ * @param[out] p_dst Destination buffer
+ * @param[in]  size  Destination buffer size
+ * @param[in]  p_src The string to be quoted
+ *
+ * @retval true  The string has been quoted
+ * @retval false The destination buffer is too small
+ */
+static bool profile_shell_quote(char * p_dst, size_t size, char const * p_src)
+{
+	size_t n = 0;
+	if(size < 3U)
+		return false;
+	p_dst[n++] = '\'';
+	for(; '\0' != *p_src; ++p_src)
+	{
+		if(n + 5U >= size)
+			return false;
+		if('\'' == *p_src)
+		{
+			memcpy(p_dst + n, "'\\''", 4);
+			n += 4U;
+		}
+		else
+		{
+			p_dst[n++] = *p_src;
+		}
+	}
+	p_dst[n++] = '\'';
+	p_dst[n] = '\0';
+	return true;
+}
+
+/**
+ * @brief Build the line table
+ *
+ * All the words that belong to any function are resolved by a single
+ * @ref EMUNIT_SIMAVR_PROFILE_ADDR2LINE call, the ELF file name is quoted for the shell.
+ * Equal lines are merged, so the line index may be used for the totals.
+ *
+ * @param[in] elf_name ELF file name
+ */
+static void profile_line_build(char const * elf_name)
+{
+	char tmp_name[] = "/tmp/emunit_profileXXXXXX";
+	char cmd[FILENAME_MAX * 2];
+	char elf_quoted[FILENAME_MAX];
+	char line[FILENAME_MAX];
+	uint32_t hash_size = 1;
+	int32_t * p_hash;
+	void (*old_sigpipe)(int);
+	FILE * p_pipe;
+	FILE * p_in;
+	uint32_t n;
+	int fd;
+
+	profile.p_line_name = profile_calloc(profile.words, sizeof(*profile.p_line_name));
+	for(n = 0; n < profile.words; ++n)
+		profile.p_line[n] = -1;
+
+	if(!profile_shell_quote(elf_quoted, sizeof(elf_quoted), elf_name))
+	{
+		fprintf(stderr, "Source lines not resolved, file name too long: %s\n", elf_name);
+		return;
+	}
+	fd = mkstemp(tmp_name);
+	if(fd < 0)
+	{
+		perror(tmp_name);
+		return;
+	}
+	close(fd);
+	n = (uint32_t)snprintf(cmd, sizeof(cmd), EMUNIT_SIMAVR_PROFILE_ADDR2LINE, elf_quoted);
+	snprintf(cmd + n, sizeof(cmd) - n, " > %s", tmp_name);
+	p_pipe = popen(cmd, "w");
+	if(NULL == p_pipe)
+	{
+		perror(cmd);
+		unlink(tmp_name);
+		return;
+	}
+	/* The command may not exist: do not let the broken pipe kill the runner */
+	old_sigpipe = signal(SIGPIPE, SIG_IGN);
+	for(n = 0; n < profile.words; ++n)
+	{
+		if(PROFILE_FUNC_UNKNOWN != profile.p_func[n])
+			fprintf(p_pipe, "0x%x\n", (unsigned int)(n * 2U));
+	}
+	if(0 != pclose(p_pipe))
+		fprintf(stderr, "Source lines not resolved: %s\n", cmd);
+	signal(SIGPIPE, old_sigpipe);
+
+	p_in = fopen(tmp_name, "r");
+	unlink(tmp_name);
+	if(NULL == p_in)
+		return;
+
+	while(hash_size < 2U * profile.words)
+		hash_size <<= 1;
+	p_hash = profile_calloc(hash_size, sizeof(*p_hash));
+	for(n = 0; n < hash_size; ++n)
+		p_hash[n] = -1;
+
+	for(n = 0; n < profile.words; ++n)
+	{
+		uint32_t h;
+		char * p_end;
+		if(PROFILE_FUNC_UNKNOWN == profile.p_func[n])
+			continue;
+		if(NULL == fgets(line, sizeof(line), p_in))
+			break;
+		/* Remove the new line and the discriminator, so the same lines are merged */
+		p_end = strpbrk(line, " \r\n");
+		if(NULL != p_end)
+			*p_end = '\0';
+		for(h = profile_hash(line) & (hash_size - 1U); ; h = (h + 1U) & (hash_size - 1U))
+		{
+			if(p_hash[h] < 0)
+			{
+				p_hash[h] = (int32_t)profile.line_cnt;
+				profile.p_line_name[profile.line_cnt] = strdup(line);
+				if(NULL == profile.p_line_name[profile.line_cnt])
+					profile_nomem();
+				++profile.line_cnt;
+				break;
+			}
+			if(0 == strcmp(profile.p_line_name[p_hash[h]], line))
+				break;
+		}
+		profile.p_line[n] = p_hash[h];
+	}
+	free(p_hash);
+	fclose(p_in);
+}
+
+void emunit_simavr_profile_init(elf_firmware_t const * p_f, char const * elf_name)
+{
+	profile.words  = (p_f->flashbase + p_f->flashsize + 1U) / 2U;
+	profile.p_func = profile_calloc(profile.words, sizeof(*profile.p_func));
+	profile.p_line = profile_calloc(profile.words, sizeof(*profile.p_line));
+	profile_func_build(p_f);
+	profile_line_build(elf_name);
+}
+
+emunit_simavr_profile_t * emunit_simavr_profile_create(void)
+{
+	emunit_simavr_profile_t * p_prof = profile_calloc(1, sizeof(*p_prof));
+	p_prof->p_hist   = profile_calloc(profile.words, sizeof(*p_prof->p_hist));
+	p_prof->node_max = 64U;
+	p_prof->p_nodes  = profile_calloc(p_prof->node_max, sizeof(*p_prof->p_nodes));
+	emunit_simavr_profile_tc_begin(p_prof);
+	return p_prof;
+}
+
+void emunit_simavr_profile_destroy(emunit_simavr_profile_t * p_prof)
+{
+	if(NULL == p_prof)
+		return;
+	free(p_prof->p_hist);
+	free(p_prof->p_nodes);
+	free(p_prof);
+}
+
+void emunit_simavr_profile_tc_begin(emunit_simavr_profile_t * p_prof)
+{
+	memset(p_prof->p_hist, 0, profile.words * sizeof(*p_prof->p_hist));
+	p_prof->total = 0;
+	memset(&p_prof->p_nodes[0], 0, sizeof(p_prof->p_nodes[0]));
+	p_prof->p_nodes[0].func = PROFILE_FUNC_ROOT;
+	p_prof->node_cnt = 1;
+	p_prof->current = 0;
+}
+
+/**
+ * @brief Get the function index of the program counter
+ *
+ * @param pc Program counter
+ * @return Function index
+ */
+static int32_t profile_func_get(uint32_t pc)
+{
+	return (pc / 2U < profile.words) ? profile.p_func[pc / 2U] : PROFILE_FUNC_UNKNOWN;
+}
+
+/**
+ * @brief Get the child node of the function
+ *
+ * The node is created if it does not exist.
+ *
+ * @param[in,out] p_prof Profiler instance
+ * @param         parent Parent node
+ * @param         func   Function index
+ * @return Child node
+ */
+static uint32_t profile_child(emunit_simavr_profile_t * p_prof, uint32_t parent, int32_t func)
+{
+	uint32_t n;
+	profile_node_t * p_node;
+	for(n = p_prof->p_nodes[parent].child; 0U != n; n = p_prof->p_nodes[n].sibling)
+	{
+		if(func == p_prof->p_nodes[n].func)
+			return n;
+	}
+	if(p_prof->node_cnt == p_prof->node_max)
+	{
+		p_prof->node_max *= 2U;
+		p_prof->p_nodes = realloc(p_prof->p_nodes, p_prof->node_max * sizeof(*p_prof->p_nodes));
+		if(NULL == p_prof->p_nodes)
+			profile_nomem();
+	}
+	n = p_prof->node_cnt++;
+	p_node = &p_prof->p_nodes[n];
+	p_node->parent  = parent;
+	p_node->child   = 0;
+	p_node->sibling = p_prof->p_nodes[parent].child;
+	p_node->func    = func;
+	p_node->cycles  = 0;
+	p_prof->p_nodes[parent].child = n;
+	return n;
+}
+
+/**
+ * @name Instruction decoding
+ * Only the instructions that change the call stack are decoded.
+ * @{
+ */
+/** CALL, RCALL (except RCALL . used to reserve the stack), ICALL and EICALL */
+#define PROFILE_OP_IS_CALL(op) ( \
+	(0x940eU == ((op) & 0xfe0eU)) || \
+	((0xd000U == ((op) & 0xf000U)) && (0xd000U != (op))) || \
+	(0x9509U == (op)) || (0x9519U == (op)))
+/** RET and RETI */
+#define PROFILE_OP_IS_RET(op) ((0x9508U == (op)) || (0x9518U == (op)))
+/** OUT, may write the stack pointer */
+#define PROFILE_OP_IS_OUT(op) (0xb800U == ((op) & 0xf800U))
+/** @} */
+
+void emunit_simavr_profile_step(
+	emunit_simavr_profile_t * p_prof,
+	avr_t const * p_avr,
+	uint32_t pc,
+	uint16_t sp,
+	avr_cycle_count_t cycle)
+{
+	uint64_t delta = p_avr->cycle - cycle;
+	int32_t  func = profile_func_get(pc);
+	int32_t  pushed = (int32_t)sp - (int32_t)emunit_simavr_profile_sp(p_avr);
+	int32_t  pc_size = (p_avr->flashend > 0x1ffffU) ? 3 : 2;
+	uint16_t op = 0;
+	uint32_t node = p_prof->current;
+
+	if(pc + 1U <= p_avr->flashend)
+		op = (uint16_t)(p_avr->flash[pc] | (p_avr->flash[pc + 1U] << 8));
+	if(pc / 2U < profile.words)
+		p_prof->p_hist[pc / 2U] += delta;
+	p_prof->total += delta;
+
+	/* The instruction is counted in the current function called from the current stack */
+	if(func != p_prof->p_nodes[node].func)
+		node = profile_child(p_prof, node, func);
+	p_prof->p_nodes[node].cycles += delta;
+
+	/* The called function is placed below the calling one */
+	if(PROFILE_OP_IS_CALL(op))
+	{
+		p_prof->current = profile_child(p_prof, node, profile_func_get(p_avr->pc));
+		pushed -= pc_size;
+	}
+	else if(PROFILE_OP_IS_RET(op))
+	{
+		p_prof->current = p_prof->p_nodes[p_prof->current].parent;
+		pushed += pc_size;
+	}
+	if(!PROFILE_OP_IS_OUT(op) && (pushed == pc_size))
+	{
+		/* Interrupt entry */
+		p_prof->current = profile_child(p_prof, node, profile_func_get(p_avr->pc));
+	}
+}
+
+/**
+ * @brief Get the function name
+ *
+ * @param func Function index
+ * @return Function name
+ */
+static char const * profile_func_name(int32_t func)
+{
+	return (func >= 0) ? profile.p_func_name[func] : PROFILE_UNKNOWN_NAME;
+}
+
+/**
+ * @brief Write the top entries of the totals table
+ *
+ * The table is destroyed.
+ *
+ * @param[in]     p_prof  Profiler instance
+ * @param[in,out] p_out   Output
+ * @param[in,out] p_total Totals, the last entry is the unknown one
+ * @param         cnt     Number of the known entries
+ * @param         names   Names of the known entries
+ */
+static void profile_top_write(
+	emunit_simavr_profile_t const * p_prof,
+	FILE * p_out,
+	uint64_t * p_total,
+	uint32_t cnt,
+	char const * const * names)
+{
+	unsigned int top;
+	for(top = 0; top < EMUNIT_SIMAVR_PROFILE_TOP; ++top)
+	{
+		uint32_t max = 0;
+		uint32_t n;
+		for(n = 1; n <= cnt; ++n)
+		{
+			if(p_total[n] > p_total[max])
+				max = n;
+		}
+		if(0U == p_total[max])
+			break;
+		fprintf(p_out, "    %12llu %5.1f%% %s\n",
+			(unsigned long long)p_total[max],
+			(100.0 * p_total[max]) / p_prof->total,
+			(max < cnt) ? names[max] : PROFILE_UNKNOWN_NAME);
+		p_total[max] = 0;
+	}
+}
+
+void emunit_simavr_profile_tc_end(
+	emunit_simavr_profile_t const * p_prof,
+	char const * ts_name,
+	char const * tc_name,
+	FILE * p_report,
+	FILE * p_folded)
+{
+	uint32_t n;
+	if(NULL != p_report)
+	{
+		uint64_t * p_func = profile_calloc(profile.func_cnt + 1U, sizeof(*p_func));
+		uint64_t * p_line = profile_calloc(profile.line_cnt + 1U, sizeof(*p_line));
+		for(n = 0; n < profile.words; ++n)
+		{
+			if(0U == p_prof->p_hist[n])
+				continue;
+			p_func[(profile.p_func[n] < 0) ? profile.func_cnt : (uint32_t)profile.p_func[n]] += p_prof->p_hist[n];
+			p_line[(profile.p_line[n] < 0) ? profile.line_cnt : (uint32_t)profile.p_line[n]] += p_prof->p_hist[n];
+		}
+		fprintf(p_report, "%s.%s: %llu cycles\n", ts_name, tc_name, (unsigned long long)p_prof->total);
+		if(0U != p_prof->total)
+		{
+			fputs("  functions:\n", p_report);
+			profile_top_write(p_prof, p_report, p_func, profile.func_cnt, profile.p_func_name);
+			fputs("  lines:\n", p_report);
+			profile_top_write(p_prof, p_report, p_line, profile.line_cnt, (char const * const *)profile.p_line_name);
+		}
+		free(p_func);
+		free(p_line);
+	}
+	if(NULL != p_folded)
+	{
+		for(n = 1; n < p_prof->node_cnt; ++n)
+		{
+			uint32_t path[256];
+			uint32_t depth = 0;
+			uint32_t node;
+			if(0U == p_prof->p_nodes[n].cycles)
+				continue;
+			for(node = n; (0U != node) && (depth < sizeof(path) / sizeof(path[0])); node = p_prof->p_nodes[node].parent)
+				path[depth++] = node;
+			fprintf(p_folded, "%s;%s", ts_name, tc_name);
+			while(0U != depth)
+				fprintf(p_folded, ";%s", profile_func_name(p_prof->p_nodes[path[--depth]].func));
+			fprintf(p_folded, " %llu\n", (unsigned long long)p_prof->p_nodes[n].cycles);
+		}
+	}
+}
@@ -0,0 +1,147 @@
+#ifndef EMUNIT_SIMAVR_PROFILE_H_INCLUDED
+#define EMUNIT_SIMAVR_PROFILE_H_INCLUDED
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief EMUnit simavr host runner profiler
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * Per test case cycle histogram of the program counter.
+ * @sa emunit_simavr_profile_group
+ */
+#include <simavr/sim_avr.h>
+#include <simavr/sim_elf.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * @defgroup emunit_simavr_profile_group <emunit_simavr_profile> EMUnit simavr profiler
+ * @{
+ *
+ * The cycles of every executed instruction are counted per program counter
+ * and per call stack between the test case begin and end signals.
+ * The call stack is tracked by the call, return and interrupt entry instructions.
+ *
+ * The symbols and lines are resolved once, when the profiler is initialised,
+ * so the profiler instances may be used by many threads.
+ * @{
+ */
+
+/** Number of functions and lines in the test case report */
+#ifndef EMUNIT_SIMAVR_PROFILE_TOP
+#define EMUNIT_SIMAVR_PROFILE_TOP 10U
+#endif
+
+/** Command used to resolve the source lines, the ELF name quoted for the shell is passed to it */
+#ifndef EMUNIT_SIMAVR_PROFILE_ADDR2LINE
+#define EMUNIT_SIMAVR_PROFILE_ADDR2LINE "avr-addr2line -e %s"
+#endif
+
+/** Profiler instance */
+typedef struct emunit_simavr_profile_s emunit_simavr_profile_t;
+
+/**
+ * @brief Initialise the profiler
+ *
+ * Builds the function and line tables for the whole firmware.
+ * Has to be called once, before any profiler instance is created.
+ *
+ * @param[in] p_f      Firmware
+ * @param[in] elf_name ELF file name used to resolve the source lines
+ */
+void emunit_simavr_profile_init(elf_firmware_t const * p_f, char const * elf_name);
+
+/**
+ * @brief Create profiler instance for one core
+ *
+ * @return Created instance
+ */
+emunit_simavr_profile_t * emunit_simavr_profile_create(void);
+
+/**
+ * @brief Release profiler instance
+ *
+ * @param[in] p_prof Instance to release
+ */
+void emunit_simavr_profile_destroy(emunit_simavr_profile_t * p_prof);
+
+/**
+ * @brief Test case begins
+ *
+ * Clears the histogram and the call tree.
+ *
+ * @param[in,out] p_prof Profiler instance
+ */
+void emunit_simavr_profile_tc_begin(emunit_simavr_profile_t * p_prof);
+
+/**
+ * @brief Count single simulation step
+ *
+ * Called after every @c avr_run call while the test case is running.
+ *
+ * @param[in,out] p_prof Profiler instance
+ * @param[in]     p_avr  Simulated core after the step
+ * @param         pc     Program counter before the step
+ * @param         sp     Stack pointer before the step
+ * @param         cycle  Cycle counter before the step
+ */
+void emunit_simavr_profile_step(
+	emunit_simavr_profile_t * p_prof,
+	avr_t const * p_avr,
+	uint32_t pc,
+	uint16_t sp,
+	avr_cycle_count_t cycle);
+
+/**
+ * @brief Test case ends
+ *
+ * Writes the report and the collapsed stacks of the test case.
+ *
+ * @param[in]     p_prof   Profiler instance
+ * @param[in]     ts_name  Test suite name
+ * @param[in]     tc_name  Test case name
+ * @param[in,out] p_report Top functions and lines report output or NULL
+ * @param[in,out] p_folded Collapsed stacks output or NULL
+ */
+void emunit_simavr_profile_tc_end(
+	emunit_simavr_profile_t const * p_prof,
+	char const * ts_name,
+	char const * tc_name,
+	FILE * p_report,
+	FILE * p_folded);
+
+/**
+ * @brief Read the stack pointer of the simulated core
+ *
+ * @param[in] p_avr Simulated core
+ * @return Stack pointer
+ */
+static inline uint16_t emunit_simavr_profile_sp(avr_t const * p_avr)
+{
+	return (uint16_t)(p_avr->data[R_SPL] | (p_avr->data[R_SPH] << 8));
+}
+
+/** @} */
+/** @} */
+#endif /* EMUNIT_SIMAVR_PROFILE_H_INCLUDED */
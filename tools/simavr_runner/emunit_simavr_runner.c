@@ -0,0 +1,1066 @@
+/* EMUnit embedded unit test engine - Copyright (C) 2017 Radoslaw Koppel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * in under the terms of the GNU General Public license (version 3)
+ * as published by the Free Software Foundation AND MODIFIED BY the
+ * EMUnit exception.
+ *
+ * NOTE: The exception was added to the GPL to ensure
+ * that you can test any kind of software without being
+ * obligated to release the whole source code under the terms of GPL.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the EMUnit license exception along with this program.
+ * If not, it can be viewed in the original EMunit repository:
+ * <https://github.com/rkel/emunit>.
+ */
+/**
+ * @file
+ * @brief EMUnit simavr host runner
+ * @author Radosław Koppel <r.koppel\@k-el.com>
+ * @date 2017
+ *
+ * Program that runs the test built for the simavr port
+ * with @ref EMUNIT_PORT_SIMAVR_HOST set.
+ * The simulator is linked as a library, so the test output is read
+ * directly from the simulated memory.
+ *
+ * Usage:
+ * ----
+ * emunit_simavr_runner [-r] [-j cores] [-c cycles.csv] [-p profile.txt] [-f stacks.folded] test.elf
+ * ----
+ *
+ * Stream 0 is sent to stdout, any other stream is written
+ * to the file named by @ref RUNNER_STREAM_FILE format.
+ *
+ * The restart requested by the test restores the core state saved
+ * at the checkpoint signalled before the test engine starts,
+ * keeping only the .noinit section.
+ * No peripheral is initialised before the checkpoint, so the IO registers
+ * are left as the core reset sets them, only the stack pointer
+ * and the status register are restored.
+ * It skips the C runtime startup and the early initialisation.
+ * With -r option the core is reset instead, keeping the data memory.
+ * The number of cycles of every test case, counted between
+ * the test case begin and end signals, is written into the cycles file.
+ * The cycles of every instruction may be also profiled between these signals:
+ * the top functions and source lines of every test case are written
+ * into the profile file and the collapsed call stacks,
+ * ready for the flame graph tools, into the stacks file.
+ *
+ * With more than one core the test suites are split into contiguous shards,
+ * every shard is run by its own simulated core in its own thread.
+ * The output of every core is kept in the memory and written
+ * in the shard order when all the cores finish.
+ * The XML documents of the shards are merged into one document
+ * with the summary of all the shards.
+ * @sa emunit_port_simavr_host_group
+ */
+#include "emunit_port_simavr_host.h"
+#include "emunit_simavr_profile.h"
+#include <simavr/sim_avr.h>
+#include <simavr/sim_elf.h>
+#include <simavr/sim_io.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Offset of the data memory addresses in AVR ELF symbols */
+#define RUNNER_DATA_OFFSET 0x800000U
+
+/** Maximum number of output streams */
+#define RUNNER_STREAMS_MAX 4U
+
+/** Maximum number of simulated cores */
+#define RUNNER_CORES_MAX 64U
+
+/** File name format of the additional output streams */
+#define RUNNER_STREAM_FILE "emunit_stream%u.out"
+
+/**
+ * @brief Memory buffered output
+ *
+ * Used when more than one core is running.
+ */
+typedef struct
+{
+	FILE * p_file; /**< Stream writing into the buffer */
+	char * p_buf;  /**< Buffer */
+	size_t size;   /**< Buffer size */
+}runner_membuf_t;
+
+/**
+ * @brief XML output of the single shard
+ *
+ * All the pointers point into the shard output buffer.
+ */
+typedef struct
+{
+	char const *  p_body;        /**< The first suite */
+	char const *  p_summary;     /**< The summary */
+	char const *  p_summary_end; /**< The summary end tag */
+	unsigned long ts[3];         /**< Test suites: total, passed and failed */
+	unsigned long tc[3];         /**< Test cases: total, passed and failed */
+	bool          buffer_stat;   /**< The buffer statistic is present */
+	unsigned long size;          /**< Buffer size */
+	unsigned long used_max;      /**< Maximum buffer usage */
+	unsigned long near_overflow; /**< Test cases near the buffer overflow */
+	unsigned long tc_max;        /**< Maximum test case buffer usage */
+	char const *  p_tc_max;      /**< The line of the test case with maximum usage, NULL if none */
+	size_t        tc_max_len;    /**< The line length */
+}runner_xml_shard_t;
+
+/**
+ * @brief Saved core state
+ */
+typedef struct
+{
+	uint8_t * p_data;          /**< Whole data memory, the IO part is used only for SP and SREG */
+	uint32_t  pc;              /**< Program counter */
+	uint8_t   sreg[8];         /**< Status register bits */
+}runner_checkpoint_t;
+
+/**
+ * @brief Simulated core state
+ */
+typedef struct
+{
+	avr_t *  p_avr;                       /**< Simulated core */
+	FILE *   p_out;                       /**< Currently selected output */
+	FILE *   streams[RUNNER_STREAMS_MAX]; /**< Output streams */
+	runner_membuf_t bufs[RUNNER_STREAMS_MAX]; /**< Output buffers */
+	runner_membuf_t cycles;               /**< Cycles report buffer */
+	FILE *   p_cycles;                    /**< Cycles report output */
+	runner_membuf_t report;               /**< Profile report buffer */
+	runner_membuf_t folded;               /**< Collapsed stacks buffer */
+	FILE *   p_report;                    /**< Profile report output */
+	FILE *   p_folded;                    /**< Collapsed stacks output */
+	emunit_simavr_profile_t * p_prof;     /**< Profiler, NULL if not used */
+	bool     prof_active;                 /**< Test case is running and profiled */
+	bool     finished;                    /**< Test has finished */
+	bool     reset;                       /**< Reset requested */
+	bool     checkpoint;                  /**< Checkpoint save requested */
+	runner_checkpoint_t chk;              /**< Saved state, valid if p_data is set */
+	int      ret;                         /**< The value returned by the test */
+	uint16_t first;                       /**< The first suite of the shard */
+	uint16_t end;                         /**< The suite after the shard */
+	uint16_t ts_name;                     /**< Current suite name address in flash */
+	uint16_t tc_name;                     /**< Current case name address in flash */
+	avr_cycle_count_t tc_start;           /**< Cycle counter at the test case begin */
+	char     ts_str[256];                 /**< Suite name buffer */
+	char     tc_str[256];                 /**< Case name buffer */
+	pthread_t thread;                     /**< Thread running the core */
+}runner_core_t;
+
+/**
+ * @brief Runner state
+ */
+static struct
+{
+	elf_firmware_t f;         /**< Firmware, parsed once for all the cores */
+	uint16_t mailbox;         /**< Mailbox address in the data memory */
+	uint16_t shard;           /**< Shard descriptor address in the data memory */
+	avr_io_addr_t signal;     /**< Signal register address */
+	uint16_t noinit_start;    /**< The first address of .noinit section */
+	uint16_t noinit_end;      /**< The address after .noinit section */
+	bool     no_checkpoint;   /**< Reset the core instead of restoring the checkpoint */
+	FILE *   p_cycles;        /**< Cycles report file */
+	FILE *   p_report;        /**< Profile report file */
+	FILE *   p_folded;        /**< Collapsed stacks file */
+	bool     buffered;        /**< Output of the cores is buffered */
+	FILE *   streams[RUNNER_STREAMS_MAX]; /**< Stream files the buffered output is written to */
+	unsigned int cores;       /**< Number of cores */
+	runner_core_t core[RUNNER_CORES_MAX]; /**< Cores */
+}runner;
+
+/**
+ * @brief Report fatal error and exit
+ *
+ * @param p_str Error message
+ */
+static void runner_fatal(char const * p_str)
+{
+	fprintf(stderr, "%s\n", p_str);
+	exit(-1);
+}
+
+/**
+ * @brief Find the symbol in the firmware
+ *
+ * Exits if the symbol is not found.
+ *
+ * @param[in] p_f  Firmware
+ * @param[in] name Symbol name
+ * @return Symbol address
+ */
+static uint32_t runner_symbol(elf_firmware_t const * p_f, char const * name)
+{
+	uint32_t n;
+	for(n = 0; n < p_f->symbolcount; ++n)
+	{
+		if(0 == strcmp(p_f->symbol[n]->symbol, name))
+			return p_f->symbol[n]->addr;
+	}
+	fprintf(stderr, "Symbol %s not found, is the test built with EMUNIT_PORT_SIMAVR_HOST=1?\n", name);
+	exit(-1);
+}
+
+/**
+ * @brief Read 16 bit value from the firmware flash image
+ *
+ * @param[in] p_f  Firmware
+ * @param     addr Flash address
+ * @return Value read
+ */
+static uint16_t runner_flash16(elf_firmware_t const * p_f, uint32_t addr)
+{
+	if(addr + 1U >= p_f->flashsize)
+		runner_fatal("Flash address out of the firmware");
+	return (uint16_t)(p_f->flash[addr] | (p_f->flash[addr + 1U] << 8));
+}
+
+/**
+ * @brief Count the test suites
+ *
+ * Reads the test suites table in the flash image until the NULL entry.
+ *
+ * @param[in] p_f Firmware
+ * @return Number of test suites
+ */
+static uint16_t runner_suites_count(elf_firmware_t const * p_f)
+{
+	uint32_t addr = runner_symbol(p_f, EMUNIT_PORT_SIMAVR_HOST_SUITES);
+	uint16_t cnt = 0;
+	while(0U != runner_flash16(p_f, addr + 2U * cnt))
+		++cnt;
+	return cnt;
+}
+
+/**
+ * @brief Read 16 bit value from the simulated data memory
+ *
+ * @param[in] p_avr Simulated core
+ * @param     addr  Data address
+ * @return Value read
+ */
+static uint16_t runner_read16(avr_t const * p_avr, uint16_t addr)
+{
+	return (uint16_t)(p_avr->data[addr] | (p_avr->data[addr + 1U] << 8));
+}
+
+/**
+ * @brief Write 16 bit value into the simulated data memory
+ *
+ * @param[in] p_avr Simulated core
+ * @param     addr  Data address
+ * @param     v     Value to write
+ */
+static void runner_write16(avr_t * p_avr, uint16_t addr, uint16_t v)
+{
+	p_avr->data[addr]      = (uint8_t)v;
+	p_avr->data[addr + 1U] = (uint8_t)(v >> 8);
+}
+
+/**
+ * @brief Get the string from the simulated flash
+ *
+ * @param[in]  p_avr Simulated core
+ * @param      addr  String address
+ * @param[out] str   Output buffer, 256 bytes
+ * @return The pointer to the string, it is always terminated.
+ */
+static char const * runner_flash_str(avr_t const * p_avr, uint16_t addr, char str[256])
+{
+	size_t n;
+	for(n = 0; n < 256U - 1U; ++n)
+	{
+		if(((uint32_t)addr + n > p_avr->flashend) ||
+			('\0' == (str[n] = (char)p_avr->flash[addr + n])))
+		{
+			break;
+		}
+	}
+	str[n] = '\0';
+	return str;
+}
+
+/**
+ * @brief Open memory buffered output
+ *
+ * @param[out] p_buf Buffer to open
+ * @return The stream writing into the buffer
+ */
+static FILE * runner_membuf_open(runner_membuf_t * p_buf)
+{
+	p_buf->p_file = open_memstream(&p_buf->p_buf, &p_buf->size);
+	if(NULL == p_buf->p_file)
+		runner_fatal("Cannot allocate the memory");
+	return p_buf->p_file;
+}
+
+/**
+ * @brief Close the stream writing into the memory buffer
+ *
+ * The buffer is kept, terminated by zero.
+ *
+ * @param[in,out] p_buf Buffer
+ */
+static void runner_membuf_close(runner_membuf_t * p_buf)
+{
+	if(NULL != p_buf->p_file)
+	{
+		fclose(p_buf->p_file);
+		p_buf->p_file = NULL;
+	}
+}
+
+/**
+ * @brief Flush memory buffered output into the file
+ *
+ * The buffer is released.
+ *
+ * @param[in,out] p_buf Buffer
+ * @param[in]     p_out Output file, NULL to release the buffer only
+ */
+static void runner_membuf_flush(runner_membuf_t * p_buf, FILE * p_out)
+{
+	runner_membuf_close(p_buf);
+	if(NULL == p_buf->p_buf)
+		return;
+	if(NULL != p_out)
+		fwrite(p_buf->p_buf, 1, p_buf->size, p_out);
+	free(p_buf->p_buf);
+	memset(p_buf, 0, sizeof(*p_buf));
+}
+
+/**
+ * @brief Find the XML element value
+ *
+ * @param[in]  p_begin The place where the search starts
+ * @param[in]  p_end   The place where the search ends
+ * @param[in]  p_tag   Element start tag
+ * @param[out] p_val   The value
+ *
+ * @retval true  The value has been found
+ * @retval false There is no such element before the end
+ */
+static bool runner_xml_value(char const * p_begin, char const * p_end, char const * p_tag, unsigned long * p_val)
+{
+	char const * p_found = strstr(p_begin, p_tag);
+	if((NULL == p_found) || (p_found >= p_end))
+		return false;
+	p_found = strchr(p_found, '>');
+	if(NULL == p_found)
+		return false;
+	*p_val = strtoul(p_found + 1, NULL, 10);
+	return true;
+}
+
+/**
+ * @brief Split the XML output of the shard
+ *
+ * The output is divided into the header, the body with the suites
+ * and the summary.
+ * Every part starts at the beginning of the line.
+ *
+ * @param[in]  p_buf       Closed output buffer
+ * @param[out] p_shard     The shard output parts and its summary
+ *
+ * @retval true  The output is complete XML document
+ * @retval false The output is not XML or the test has not finished
+ */
+static bool runner_xml_split(runner_membuf_t const * p_buf, runner_xml_shard_t * p_shard)
+{
+	char const * p_test = strstr(p_buf->p_buf, "<test ");
+	char const * p_sum;
+	char const * p_stat;
+	char const * p_max;
+
+	memset(p_shard, 0, sizeof(*p_shard));
+	if(NULL == p_test)
+		return false;
+	p_shard->p_body = strchr(p_test, '\n');
+	if(NULL == p_shard->p_body)
+		return false;
+	++p_shard->p_body;
+	p_sum = strstr(p_shard->p_body, "<testsummary>");
+	if(NULL == p_sum)
+		return false;
+	while((p_sum > p_shard->p_body) && ('\n' != p_sum[-1]))
+		--p_sum;
+	p_shard->p_summary = p_sum;
+	p_shard->p_summary_end = strstr(p_sum, "</testsummary>");
+	if(NULL == p_shard->p_summary_end)
+		return false;
+
+	p_stat = strstr(p_sum, "<testsuite-stat>");
+	if((NULL == p_stat) ||
+		!runner_xml_value(p_stat, p_shard->p_summary_end, "<total>",  &p_shard->ts[0]) ||
+		!runner_xml_value(p_stat, p_shard->p_summary_end, "<passed>", &p_shard->ts[1]) ||
+		!runner_xml_value(p_stat, p_shard->p_summary_end, "<failed>", &p_shard->ts[2]))
+	{
+		return false;
+	}
+	p_stat = strstr(p_sum, "<testcase-stat>");
+	if((NULL == p_stat) ||
+		!runner_xml_value(p_stat, p_shard->p_summary_end, "<total>",  &p_shard->tc[0]) ||
+		!runner_xml_value(p_stat, p_shard->p_summary_end, "<passed>", &p_shard->tc[1]) ||
+		!runner_xml_value(p_stat, p_shard->p_summary_end, "<failed>", &p_shard->tc[2]))
+	{
+		return false;
+	}
+	p_stat = strstr(p_sum, "<buffer-stat>");
+	if((NULL != p_stat) && (p_stat < p_shard->p_summary_end))
+	{
+		p_shard->buffer_stat = true;
+		if(!runner_xml_value(p_stat, p_shard->p_summary_end, "<size>",          &p_shard->size) ||
+			!runner_xml_value(p_stat, p_shard->p_summary_end, "<used-max>",      &p_shard->used_max) ||
+			!runner_xml_value(p_stat, p_shard->p_summary_end, "<near-overflow>", &p_shard->near_overflow))
+		{
+			return false;
+		}
+		p_max = strstr(p_stat, "<testcase-max ");
+		if((NULL != p_max) && (p_max < p_shard->p_summary_end))
+		{
+			char const * p_line_end = strchr(p_max, '\n');
+			if(!runner_xml_value(p_max, p_shard->p_summary_end, "<testcase-max ", &p_shard->tc_max) ||
+				(NULL == p_line_end))
+			{
+				return false;
+			}
+			while('\n' != p_max[-1])
+				--p_max;
+			p_shard->p_tc_max = p_max;
+			p_shard->tc_max_len = (size_t)(p_line_end + 1 - p_max);
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief Write the output stream of all the shards
+ *
+ * The XML documents of the shards are merged into one document:
+ * the header of the first shard, the suites of all the shards in the shard order
+ * and the summary with the statistics summed.
+ * The output that is not complete XML document, like the panic report,
+ * is written as it is, the shard after shard.
+ * The buffers are released.
+ *
+ * @param stream Stream index
+ * @param p_out  Output file
+ */
+static void runner_stream_merge(unsigned int stream, FILE * p_out)
+{
+	runner_xml_shard_t sum;
+	runner_xml_shard_t shard;
+	runner_membuf_t * p_first = NULL;
+	bool merge = true;
+	unsigned int n;
+	unsigned int i;
+
+	for(n = 0; n < runner.cores; ++n)
+	{
+		runner_membuf_t * p_buf = &runner.core[n].bufs[stream];
+		runner_membuf_close(p_buf);
+		if(NULL == p_buf->p_buf)
+			continue;
+		if(NULL == p_first)
+			p_first = p_buf;
+		if(!runner_xml_split(p_buf, &shard))
+			merge = false;
+	}
+	if(NULL == p_first)
+		return;
+	if(!merge)
+	{
+		for(n = 0; n < runner.cores; ++n)
+			runner_membuf_flush(&runner.core[n].bufs[stream], p_out);
+		return;
+	}
+
+	memset(&sum, 0, sizeof(sum));
+	(void)runner_xml_split(p_first, &shard);
+	fwrite(p_first->p_buf, 1, (size_t)(shard.p_body - p_first->p_buf), p_out);
+	for(n = 0; n < runner.cores; ++n)
+	{
+		runner_membuf_t * p_buf = &runner.core[n].bufs[stream];
+		if(NULL == p_buf->p_buf)
+			continue;
+		(void)runner_xml_split(p_buf, &shard);
+		fwrite(shard.p_body, 1, (size_t)(shard.p_summary - shard.p_body), p_out);
+		for(i = 0; i < 3U; ++i)
+		{
+			sum.ts[i] += shard.ts[i];
+			sum.tc[i] += shard.tc[i];
+		}
+		if(shard.buffer_stat)
+		{
+			sum.buffer_stat = true;
+			sum.size = shard.size;
+			if(shard.used_max > sum.used_max)
+				sum.used_max = shard.used_max;
+			sum.near_overflow += shard.near_overflow;
+			if((NULL != shard.p_tc_max) && ((NULL == sum.p_tc_max) || (shard.tc_max > sum.tc_max)))
+			{
+				sum.tc_max     = shard.tc_max;
+				sum.p_tc_max   = shard.p_tc_max;
+				sum.tc_max_len = shard.tc_max_len;
+			}
+		}
+	}
+
+	fprintf(p_out,
+		"  <testsummary>\n"
+		"    <testsuite-stat>\n"
+		"      <total>%lu</total>\n"
+		"      <passed>%lu</passed>\n"
+		"      <failed>%lu</failed>\n"
+		"    </testsuite-stat>\n"
+		"    <testcase-stat>\n"
+		"      <total>%lu</total>\n"
+		"      <passed>%lu</passed>\n"
+		"      <failed>%lu</failed>\n"
+		"    </testcase-stat>\n",
+		sum.ts[0], sum.ts[1], sum.ts[2],
+		sum.tc[0], sum.tc[1], sum.tc[2]);
+	if(sum.buffer_stat)
+	{
+		fprintf(p_out,
+			"    <buffer-stat>\n"
+			"      <size>%lu</size>\n"
+			"      <used-max>%lu</used-max>\n"
+			"      <near-overflow>%lu</near-overflow>\n",
+			sum.size, sum.used_max, sum.near_overflow);
+		if(NULL != sum.p_tc_max)
+			fwrite(sum.p_tc_max, 1, sum.tc_max_len, p_out);
+		fputs("    </buffer-stat>\n", p_out);
+	}
+	fputs(
+		"  </testsummary>\n"
+		"</test>\n",
+		p_out);
+
+	/* The testcase-max line is placed in the shard buffer */
+	for(n = 0; n < runner.cores; ++n)
+		runner_membuf_flush(&runner.core[n].bufs[stream], NULL);
+}
+
+/**
+ * @brief Reset the simulated core keeping the cycle counter
+ *
+ * The cycle counter runs through the restarts,
+ * so the cycle timers and the profiler stamps never go back.
+ *
+ * @param[in,out] p_avr Simulated core
+ */
+static void runner_avr_reset(avr_t * p_avr)
+{
+	avr_cycle_count_t cycle = p_avr->cycle;
+	avr_reset(p_avr);
+	p_avr->cycle = cycle;
+}
+
+/**
+ * @brief Reset the core
+ *
+ * The data memory above the registers is kept, as the test status
+ * is placed in .noinit section.
+ *
+ * @param[in,out] p_core Core to reset
+ */
+static void runner_reset(runner_core_t * p_core)
+{
+	avr_t * p_avr = p_core->p_avr;
+	size_t size = (size_t)p_avr->ramend - p_avr->ioend;
+	uint8_t * p_keep = malloc(size);
+	if(NULL == p_keep)
+		runner_fatal("Cannot allocate the memory");
+	memcpy(p_keep, &p_avr->data[p_avr->ioend + 1U], size);
+	runner_avr_reset(p_avr);
+	memcpy(&p_avr->data[p_avr->ioend + 1U], p_keep, size);
+	free(p_keep);
+	p_core->reset = false;
+}
+
+/**
+ * @brief Save the checkpoint
+ *
+ * Called after the instruction that signalled the checkpoint,
+ * so the restored core continues with the next one.
+ *
+ * @param[in,out] p_core Core to save
+ */
+static void runner_checkpoint_save(runner_core_t * p_core)
+{
+	avr_t * p_avr = p_core->p_avr;
+	runner_checkpoint_t * p_chk = &p_core->chk;
+	p_chk->p_data = malloc((size_t)p_avr->ramend + 1U);
+	if(NULL == p_chk->p_data)
+		runner_fatal("Cannot allocate the memory");
+	memcpy(p_chk->p_data, p_avr->data, (size_t)p_avr->ramend + 1U);
+	p_chk->pc = p_avr->pc;
+	memcpy(p_chk->sreg, p_avr->sreg, sizeof(p_chk->sreg));
+	p_core->checkpoint = false;
+}
+
+/**
+ * @brief Restore the checkpoint
+ *
+ * The core is reset, then the registers, the RAM and the CPU state
+ * are written back.
+ * The IO registers are not written: they belong to the peripherals
+ * and writing them directly would bypass the peripheral models.
+ * The checkpoint is signalled before any peripheral is initialised,
+ * so the reset leaves the peripherals as they were at the checkpoint.
+ * Only the .noinit section is kept from the current memory.
+ * The cycle counter is not restored, it keeps running through the restarts.
+ *
+ * @param[in,out] p_core Core to restore
+ */
+static void runner_checkpoint_restore(runner_core_t * p_core)
+{
+	avr_t * p_avr = p_core->p_avr;
+	runner_checkpoint_t * p_chk = &p_core->chk;
+	size_t start = runner.noinit_start;
+	size_t size = (size_t)runner.noinit_end - start;
+
+	memcpy(&p_chk->p_data[start], &p_avr->data[start], size);
+	runner_avr_reset(p_avr);
+	memcpy(p_avr->data, p_chk->p_data, 32U);
+	memcpy(&p_avr->data[p_avr->ioend + 1U], &p_chk->p_data[p_avr->ioend + 1U],
+		(size_t)p_avr->ramend - p_avr->ioend);
+	/* The core registers in the IO space, not used by any peripheral */
+	p_avr->data[R_SPL]  = p_chk->p_data[R_SPL];
+	p_avr->data[R_SPH]  = p_chk->p_data[R_SPH];
+	p_avr->data[R_SREG] = p_chk->p_data[R_SREG];
+	p_avr->pc = p_chk->pc;
+	memcpy(p_avr->sreg, p_chk->sreg, sizeof(p_avr->sreg));
+	p_avr->state = cpu_Running;
+	p_core->reset = false;
+}
+
+/**
+ * @brief Write the test output
+ *
+ * The output is written in runs between tabulators,
+ * every tabulator is replaced by 2 spaces.
+ *
+ * @param[in] p_core Core that generates the output
+ * @param[in] p_str  Output data
+ * @param[in] len    Data length
+ */
+static void runner_write(runner_core_t * p_core, char const * p_str, size_t len)
+{
+	while(0U != len)
+	{
+		char const * p_tab = memchr(p_str, '\t', len);
+		size_t run = (NULL == p_tab) ? len : (size_t)(p_tab - p_str);
+		fwrite(p_str, 1, run, p_core->p_out);
+		p_str += run;
+		len   -= run;
+		if(NULL != p_tab)
+		{
+			fputs("  ", p_core->p_out);
+			++p_str;
+			--len;
+		}
+	}
+}
+
+/**
+ * @brief Open the report file
+ *
+ * Exits if the file cannot be opened.
+ *
+ * @param[in] name File name
+ * @return Opened file
+ */
+static FILE * runner_output_open(char const * name)
+{
+	FILE * p_file = fopen(name, "w");
+	if(NULL == p_file)
+	{
+		perror(name);
+		exit(-1);
+	}
+	return p_file;
+}
+
+/**
+ * @brief Open the output stream file
+ *
+ * @param stream Stream index
+ * @return Opened file
+ */
+static FILE * runner_stream_open(unsigned int stream)
+{
+	char name[FILENAME_MAX];
+	snprintf(name, sizeof(name), RUNNER_STREAM_FILE, stream);
+	return runner_output_open(name);
+}
+
+/**
+ * @brief Select the output stream
+ *
+ * @param[in,out] p_core Core that selects the stream
+ * @param         stream Stream index
+ */
+static void runner_select(runner_core_t * p_core, unsigned int stream)
+{
+	if(stream >= RUNNER_STREAMS_MAX)
+	{
+		fprintf(stderr, "Wrong output stream: %u\n", stream);
+		exit(-1);
+	}
+	if(NULL == p_core->streams[stream])
+	{
+		p_core->streams[stream] = runner.buffered ?
+			runner_membuf_open(&p_core->bufs[stream]) :
+			runner_stream_open(stream);
+	}
+	p_core->p_out = p_core->streams[stream];
+}
+
+/**
+ * @brief Signal register write callback
+ *
+ * Processes the signal written by the target.
+ *
+ * @param p_avr Simulated core
+ * @param addr  Register address
+ * @param v     Signal code
+ * @param param The core state
+ */
+static void runner_signal(struct avr_t * p_avr, avr_io_addr_t addr, uint8_t v, void * param)
+{
+	runner_core_t * p_core = param;
+	uint16_t data_addr = runner_read16(p_avr, runner.mailbox);
+	uint16_t len = runner_read16(p_avr, runner.mailbox + 2U);
+	(void)addr;
+
+	switch(v)
+	{
+	case EMUNIT_PORT_SIMAVR_HOST_OUT:
+		if((uint32_t)data_addr + len > (uint32_t)p_avr->ramend + 1U)
+		{
+			fprintf(stderr, "Output out of the data memory: 0x%04x+%u\n", data_addr, len);
+			exit(-1);
+		}
+		runner_write(p_core, (char const *)&p_avr->data[data_addr], len);
+		break;
+	case EMUNIT_PORT_SIMAVR_HOST_SELECT:
+		runner_select(p_core, len);
+		break;
+	case EMUNIT_PORT_SIMAVR_HOST_EXIT:
+		p_core->ret = (int16_t)len;
+		p_core->finished = true;
+		break;
+	case EMUNIT_PORT_SIMAVR_HOST_RESTART:
+		/* Reset after the current instruction */
+		p_core->reset = true;
+		break;
+	case EMUNIT_PORT_SIMAVR_HOST_CHECKPOINT:
+		/* Save after the current instruction, only the first one is used */
+		p_core->checkpoint = (!runner.no_checkpoint) && (NULL == p_core->chk.p_data);
+		break;
+	case EMUNIT_PORT_SIMAVR_HOST_TC_BEGIN:
+		p_core->ts_name = data_addr;
+		p_core->tc_name = len;
+		p_core->tc_start = p_avr->cycle;
+		if(NULL != p_core->p_prof)
+		{
+			emunit_simavr_profile_tc_begin(p_core->p_prof);
+			p_core->prof_active = true;
+		}
+		break;
+	case EMUNIT_PORT_SIMAVR_HOST_TC_END:
+		runner_flash_str(p_avr, p_core->ts_name, p_core->ts_str);
+		runner_flash_str(p_avr, p_core->tc_name, p_core->tc_str);
+		if(NULL != p_core->p_cycles)
+		{
+			fprintf(p_core->p_cycles, "%s,%s,%llu\n",
+				p_core->ts_str,
+				p_core->tc_str,
+				(unsigned long long)(p_avr->cycle - p_core->tc_start));
+		}
+		if(NULL != p_core->p_prof)
+		{
+			p_core->prof_active = false;
+			emunit_simavr_profile_tc_end(p_core->p_prof,
+				p_core->ts_str, p_core->tc_str, p_core->p_report, p_core->p_folded);
+		}
+		break;
+	default:
+		fprintf(stderr, "Unknown signal: %u\n", v);
+		break;
+	}
+}
+
+/**
+ * @brief Create the core and load the firmware
+ *
+ * The shard descriptor is written before the core starts.
+ *
+ * @param[out] p_core Core to create
+ */
+static void runner_core_init(runner_core_t * p_core)
+{
+	p_core->p_avr = avr_make_mcu_by_name(runner.f.mmcu);
+	if(NULL == p_core->p_avr)
+	{
+		fprintf(stderr, "Unknown MCU: %s\n", runner.f.mmcu);
+		exit(-1);
+	}
+	avr_init(p_core->p_avr);
+	avr_load_firmware(p_core->p_avr, &runner.f);
+	avr_register_io_write(p_core->p_avr, runner.signal, runner_signal, p_core);
+	runner_write16(p_core->p_avr, runner.shard, p_core->first);
+	runner_write16(p_core->p_avr, runner.shard + 2U, p_core->end);
+
+	if(runner.buffered)
+	{
+		p_core->streams[0] = runner_membuf_open(&p_core->bufs[0]);
+		if(NULL != runner.p_cycles)
+			p_core->p_cycles = runner_membuf_open(&p_core->cycles);
+		if(NULL != runner.p_report)
+			p_core->p_report = runner_membuf_open(&p_core->report);
+		if(NULL != runner.p_folded)
+			p_core->p_folded = runner_membuf_open(&p_core->folded);
+	}
+	else
+	{
+		p_core->streams[0] = stdout;
+		p_core->p_cycles = runner.p_cycles;
+		p_core->p_report = runner.p_report;
+		p_core->p_folded = runner.p_folded;
+	}
+	if((NULL != runner.p_report) || (NULL != runner.p_folded))
+		p_core->p_prof = emunit_simavr_profile_create();
+	p_core->p_out = p_core->streams[0];
+	p_core->ret = -1;
+}
+
+/**
+ * @brief Run the core until the test finishes
+ *
+ * @param param The core state
+ * @return Always NULL
+ */
+static void * runner_core_run(void * param)
+{
+	runner_core_t * p_core = param;
+	avr_t * p_avr = p_core->p_avr;
+	while(!p_core->finished)
+	{
+		/* State before the step, used by the profiler */
+		bool prof = p_core->prof_active;
+		uint32_t pc = p_avr->pc;
+		uint16_t sp = emunit_simavr_profile_sp(p_avr);
+		avr_cycle_count_t cycle = p_avr->cycle;
+		int state = avr_run(p_avr);
+		if(prof)
+			emunit_simavr_profile_step(p_core->p_prof, p_avr, pc, sp, cycle);
+		if((cpu_Done == state) || (cpu_Crashed == state))
+			break;
+		if(p_core->checkpoint)
+		{
+			runner_checkpoint_save(p_core);
+		}
+		else if(p_core->reset)
+		{
+			if(NULL != p_core->chk.p_data)
+				runner_checkpoint_restore(p_core);
+			else
+				runner_reset(p_core);
+		}
+	}
+	if(!p_core->finished)
+	{
+		fprintf(stderr, "Test has not finished properly, suites %u-%u\n",
+			p_core->first, p_core->end);
+	}
+	return NULL;
+}
+
+/**
+ * @brief Write the buffered core output and release the core
+ *
+ * @param[in,out] p_core The core
+ */
+static void runner_core_finish(runner_core_t * p_core)
+{
+	unsigned int n;
+	if(runner.buffered)
+	{
+		/* The output streams are merged before */
+		runner_membuf_flush(&p_core->cycles, runner.p_cycles);
+		runner_membuf_flush(&p_core->report, runner.p_report);
+		runner_membuf_flush(&p_core->folded, runner.p_folded);
+	}
+	else
+	{
+		for(n = 1; n < RUNNER_STREAMS_MAX; ++n)
+		{
+			if(NULL != p_core->streams[n])
+				fclose(p_core->streams[n]);
+		}
+	}
+	free(p_core->chk.p_data);
+	emunit_simavr_profile_destroy(p_core->p_prof);
+	avr_terminate(p_core->p_avr);
+}
+
+/**
+ * @brief Program entry point
+ *
+ * @param argc Number of arguments
+ * @param argv Arguments
+ * @return The value returned by the test or -1 on error.
+ *         With more than one core the sum of the values returned by all the shards.
+ */
+int main(int argc, char * argv[])
+{
+	uint16_t suites;
+	uint32_t noinit;
+	unsigned int n;
+	int argn = 1;
+	int ret = 0;
+
+	runner.cores = 1;
+	while((argn + 1 < argc) && ('-' == argv[argn][0]))
+	{
+		if(0 == strcmp(argv[argn], "-r"))
+		{
+			runner.no_checkpoint = true;
+			++argn;
+			continue;
+		}
+		if(0 == strcmp(argv[argn], "-c"))
+		{
+			runner.p_cycles = runner_output_open(argv[argn + 1]);
+			fputs("suite,case,cycles\n", runner.p_cycles);
+		}
+		else if(0 == strcmp(argv[argn], "-p"))
+		{
+			runner.p_report = runner_output_open(argv[argn + 1]);
+		}
+		else if(0 == strcmp(argv[argn], "-f"))
+		{
+			runner.p_folded = runner_output_open(argv[argn + 1]);
+		}
+		else if(0 == strcmp(argv[argn], "-j"))
+		{
+			runner.cores = (unsigned int)strtoul(argv[argn + 1], NULL, 0);
+			if((0U == runner.cores) || (runner.cores > RUNNER_CORES_MAX))
+				runner.cores = 0;
+		}
+		else
+		{
+			break;
+		}
+		argn += 2;
+	}
+	if((argn + 1 != argc) || (0U == runner.cores))
+	{
+		fprintf(stderr, "Usage: %s [-r] [-j cores] [-c cycles.csv] [-p profile.txt] [-f stacks.folded] <test.elf>\n", argv[0]);
+		return -1;
+	}
+	if(0 != elf_read_firmware(argv[argn], &runner.f))
+	{
+		fprintf(stderr, "Cannot read firmware: %s\n", argv[argn]);
+		return -1;
+	}
+
+	runner.mailbox = (uint16_t)(runner_symbol(&runner.f, EMUNIT_PORT_SIMAVR_HOST_MAILBOX) - RUNNER_DATA_OFFSET);
+	runner.shard = (uint16_t)(runner_symbol(&runner.f, EMUNIT_PORT_SIMAVR_HOST_SHARD) - RUNNER_DATA_OFFSET);
+	runner.signal = (avr_io_addr_t)runner_flash16(&runner.f,
+		runner_symbol(&runner.f, EMUNIT_PORT_SIMAVR_HOST_SIGNAL));
+	noinit = runner_symbol(&runner.f, EMUNIT_PORT_SIMAVR_HOST_NOINIT);
+	runner.noinit_start = runner_flash16(&runner.f, noinit);
+	runner.noinit_end   = runner_flash16(&runner.f, noinit + 2U);
+	if(runner.noinit_end < runner.noinit_start)
+		runner_fatal("Wrong .noinit section range");
+
+	if((NULL != runner.p_report) || (NULL != runner.p_folded))
+		emunit_simavr_profile_init(&runner.f, argv[argn]);
+
+	suites = runner_suites_count(&runner.f);
+	if(runner.cores > suites)
+		runner.cores = (0U == suites) ? 1U : suites;
+	runner.buffered = (runner.cores > 1U);
+
+	/* Contiguous shards, sizes differ by 1 at most */
+	for(n = 0; n < runner.cores; ++n)
+	{
+		runner_core_t * p_core = &runner.core[n];
+		if(runner.buffered)
+		{
+			p_core->first = (uint16_t)((suites * n) / runner.cores);
+			p_core->end   = (uint16_t)((suites * (n + 1U)) / runner.cores);
+		}
+		runner_core_init(p_core);
+	}
+
+	if(runner.buffered)
+	{
+		for(n = 0; n < runner.cores; ++n)
+		{
+			if(0 != pthread_create(&runner.core[n].thread, NULL, runner_core_run, &runner.core[n]))
+				runner_fatal("Cannot create the thread");
+		}
+		for(n = 0; n < runner.cores; ++n)
+			pthread_join(runner.core[n].thread, NULL);
+	}
+	else
+	{
+		runner_core_run(&runner.core[0]);
+	}
+
+	if(runner.buffered)
+	{
+		runner_stream_merge(0, stdout);
+		for(n = 1; n < RUNNER_STREAMS_MAX; ++n)
+		{
+			unsigned int i;
+			for(i = 0; i < runner.cores; ++i)
+			{
+				if(NULL != runner.core[i].bufs[n].p_file)
+				{
+					/* The file is created only if any shard uses the stream */
+					runner.streams[n] = runner_stream_open(n);
+					runner_stream_merge(n, runner.streams[n]);
+					break;
+				}
+			}
+		}
+	}
+	for(n = 0; n < runner.cores; ++n)
+	{
+		runner_core_finish(&runner.core[n]);
+		if((ret >= 0) && (runner.core[n].ret >= 0))
+			ret += runner.core[n].ret;
+		else
+			ret = -1;
+	}
+	for(n = 1; n < RUNNER_STREAMS_MAX; ++n)
+	{
+		if(NULL != runner.streams[n])
+			fclose(runner.streams[n]);
+	}
+	if(NULL != runner.p_cycles)
+		fclose(runner.p_cycles);
+	if(NULL != runner.p_report)
+		fclose(runner.p_report);
+	if(NULL != runner.p_folded)
+		fclose(runner.p_folded);
+	return ret;
+}